@@ -282,8 +282,7 @@ SpCol<eT>::shed_rows(const uword in_row1, const uword in_row2)
       arrayops::inplace_minus(new_row_indices + start, diff, (SpMat<eT>::n_nonzero - end));
       }
 
-    memory::release(SpMat<eT>::values);
-    memory::release(SpMat<eT>::row_indices);
+    SpMat<eT>::mem_release();
 
     access::rw(SpMat<eT>::values) = new_values;
     access::rw(SpMat<eT>::row_indices) = new_row_indices;
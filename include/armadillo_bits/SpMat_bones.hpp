@@ -35,6 +35,7 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   const uword n_elem;    //!< number of elements         (read-only)
   const uword n_nonzero; //!< number of nonzero elements (read-only)
   const uword vec_state; //!< 0: matrix; 1: column vector; 2: row vector
+  const uword mem_state; //!< 0: normal; 1: 'values' and 'row_indices' use auxiliary memory
   
   
   // The memory used to store the values of the matrix.
@@ -43,6 +44,7 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   // 
   // The length of this array is (n_nonzero + 1).
   // The final value values[n_nonzero] must be zero to ensure integrity of iterators.
+  // When using auxiliary memory (mem_state == 1), the length is n_nonzero and there is no final value.
   // Use mem_resize(new_n_nonzero) to resize this array.
   // 
   // WARNING: the 'values' array is only valid after sync() is called;
@@ -55,6 +57,7 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   // 
   // The length of this array is (n_nonzero + 1).
   // The final value row_indices[n_nonzero] must be zero to ensure integrity of iterators.
+  // When using auxiliary memory (mem_state == 1), the length is n_nonzero and there is no final value.
   // Use mem_resize(new_n_nonzero) to resize this array.
   // 
   // WARNING: the 'row_indices' array is only valid after sync() is called;
@@ -111,6 +114,8 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   template<typename T1, typename T2>
   inline SpMat(const bool add_values, const Base<uword,T1>& locations, const Base<eT,T2>& values, const uword n_rows, const uword n_cols, const bool sort_locations = true, const bool check_for_zeros = true);
   
+  inline SpMat(uword* aux_row_indices, const uword* aux_col_ptrs, eT* aux_values, const uword aux_n_rows, const uword aux_n_cols, const bool copy_aux_mem = true);
+  
   inline SpMat&  operator=(const eT val); //! sets size to 1x1
   inline SpMat& operator*=(const eT val);
   inline SpMat& operator/=(const eT val);
@@ -373,8 +378,9 @@ class SpMat : public SpBase< eT, SpMat<eT> >
     
     arma_inline eT operator*() const;
     
-    // don't hold location internally; call "dummy" methods to get that information
-    arma_inline uword row() const { return M->row_indices[internal_pos]; }
+    // don't hold location internally; call "dummy" methods to get that information;
+    // the end position has row 0 without reading row_indices[n_nonzero], which is absent in auxiliary memory
+    arma_inline uword row() const { return (internal_pos < M->n_nonzero) ? M->row_indices[internal_pos] : uword(0); }
     arma_inline uword col() const { return internal_col;                 }
     arma_inline uword pos() const { return internal_pos;                 }
     
@@ -473,6 +479,8 @@ class SpMat : public SpBase< eT, SpMat<eT> >
     
     arma_inline uword row() const { return internal_row; }
     
+    inline void set_end();
+    
     inline arma_hot bool operator==(const const_iterator& rhs) const;
     inline arma_hot bool operator!=(const const_iterator& rhs) const;
     
@@ -608,6 +616,12 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   inline                  void delete_element(const uword in_row, const uword in_col);
   
   
+  // auxiliary memory related
+  
+  inline void mem_release();  // release 'values' and 'row_indices', unless they are auxiliary memory
+  inline void mem_detach();   // copy auxiliary memory into internal memory, before the sparsity pattern is changed
+  
+  
   // cache related
   
   arma_aligned mutable MapMat<eT> cache;
@@ -627,12 +641,30 @@ class SpMat : public SpBase< eT, SpMat<eT> >
   inline void sync_csc()   const;
   
   
+  // CSR mirror related
+  // the mirror holds only the structure of the matrix in row-major order;
+  // values are reached through csr_locs, so in-place changes to values don't invalidate it
+  
+  arma_aligned mutable podarray<uword> csr_row_ptrs;     // n_rows+1 elements; start of each row in csr_col_indices
+  arma_aligned mutable podarray<uword> csr_col_indices;  // column index of each element, in row-major order
+  arma_aligned mutable podarray<uword> csr_locs;         // location of each element within the CSC arrays
+  arma_aligned mutable state_type      csr_state;
+  // 0: mirror needs to be built from CSC
+  // 1: no update required
+  
+  arma_inline void invalidate_csr() const;
+  
+  inline void sync_csr() const;
+  inline void init_csr() const;
+  
+  
   friend class SpValProxy< SpMat<eT> >;  // allow SpValProxy to call insert_element() and delete_element()
   friend class SpSubview<eT>;
   friend class SpRow<eT>;
   friend class SpCol<eT>;
   friend class SpMat_MapMat_val<eT>;
   friend class SpSubview_MapMat_val<eT>;
+  friend class spop_strans;
   
   
   public:
@@ -116,7 +116,8 @@ SpMat<eT>::const_iterator::const_iterator(const SpMat<eT>& in_M, uword in_row, u
     }
 
   // Now we have to get to the right row.
-  while((iterator_base::M->row_indices[iterator_base::internal_pos] < in_row) && (iterator_base::internal_col == in_col))
+  // The position is checked first, as row_indices may not have an element past the end (eg. when using auxiliary memory).
+  while((iterator_base::internal_pos < iterator_base::M->n_nonzero) && (iterator_base::internal_col == in_col) && (iterator_base::M->row_indices[iterator_base::internal_pos] < in_row))
     {
     ++(*this); // Increment iterator.
     }
@@ -406,78 +407,18 @@ SpMat<eT>::const_row_iterator::const_row_iterator(const SpMat<eT>& in_M, uword i
   , internal_row(0)
   , actual_pos(0)
   {
-  // Corner case for the end of a matrix.
-  if (initial_pos == in_M.n_nonzero)
-    {
-    iterator_base::internal_col = 0;
-    internal_row = in_M.n_rows;
-    actual_pos = in_M.n_nonzero;
-    iterator_base::internal_pos = in_M.n_nonzero;
-
-    return;
-    }
-
-  // We don't count zeros in our position count, so we have to find the nonzero
-  // value corresponding to the given initial position.  We assume initial_pos
-  // is valid.
-
-  // This is irritating because we don't know where the elements are in each
-  // row.  What we will do is loop across all columns looking for elements in
-  // row 0 (and add to our sum), then in row 1, and so forth, until we get to
-  // the desired position.
-  uword cur_pos = std::numeric_limits<uword>::max(); // Invalid value.
-  uword cur_actual_pos = 0;
-
-  for (uword row = 0; row < iterator_base::M->n_rows; ++row)
-    {
-    for (uword col = 0; col < iterator_base::M->n_cols; ++col)
-      {
-      // Find the first element with row greater than or equal to in_row.
-      const uword      col_offset = iterator_base::M->col_ptrs[col    ];
-      const uword next_col_offset = iterator_base::M->col_ptrs[col + 1];
-
-      const uword* start_ptr = &iterator_base::M->row_indices[     col_offset];
-      const uword*   end_ptr = &iterator_base::M->row_indices[next_col_offset];
-
-      if (start_ptr != end_ptr)
-        {
-        const uword* pos_ptr = std::lower_bound(start_ptr, end_ptr, row);
-
-        // This is the number of elements in the column with row index less than
-        // in_row.
-        const uword offset = (pos_ptr - start_ptr);
-
-        if (iterator_base::M->row_indices[col_offset + offset] == row)
-          {
-          cur_actual_pos = col_offset + offset;
-
-          // Increment position portably.
-          if (cur_pos == std::numeric_limits<uword>::max())
-            cur_pos = 0;
-          else
-            ++cur_pos;
-
-          // Do we terminate?
-          if (cur_pos == initial_pos)
-            {
-            internal_row = row;
-            iterator_base::internal_col = col;
-            iterator_base::internal_pos = cur_pos;
-            actual_pos = cur_actual_pos;
-
-            return;
-            }
-          }
-        }
-      }
-    }
-
-  // If we got to here, then we have gone past the end of the matrix.  This
-  // shouldn't happen...
-  iterator_base::internal_pos = iterator_base::M->n_nonzero;
-  iterator_base::internal_col = 0;
-  internal_row = iterator_base::M->n_rows;
-  actual_pos = iterator_base::M->n_nonzero;
+  // Row-wise traversal uses the CSR mirror of the matrix, so the position in
+  // the row-wise ordering is directly the location within the mirror.
+  in_M.sync_csr();
+  
+  if(initial_pos >= in_M.n_nonzero)  { set_end(); return; }
+  
+  const uword* row_ptrs = in_M.csr_row_ptrs.memptr();
+  
+  internal_row = uword(std::upper_bound(row_ptrs, row_ptrs + in_M.n_rows + 1, initial_pos) - row_ptrs) - 1;
+  
+  iterator_base::internal_col = in_M.csr_col_indices[initial_pos];
+  actual_pos                  = in_M.csr_locs[initial_pos];
   }
 
 
@@ -489,59 +430,28 @@ SpMat<eT>::const_row_iterator::const_row_iterator(const SpMat<eT>& in_M, uword i
   , internal_row(0)
   , actual_pos(0)
   {
-  // Start our search in the given row.  We need to find two things:
-  //
-  //   1. The first nonzero element (iterating by rows) after (in_row, in_col).
-  //   2. The number of nonzero elements (iterating by rows) that come before
-  //      (in_row, in_col).
-  //
-  // We'll find these simultaneously, though we will have to loop over all
-  // columns.
-
-  // This will hold the total number of points with rows less than in_row.
-  uword cur_pos = 0;
-  uword cur_min_row = iterator_base::M->n_rows;
-  uword cur_min_col = 0;
-  uword cur_actual_pos = 0;
-
-  for (uword col = 0; col < iterator_base::M->n_cols; ++col)
-    {
-    // Find the first element with row greater than or equal to in_row.
-    const uword      col_offset = iterator_base::M->col_ptrs[col    ];
-    const uword next_col_offset = iterator_base::M->col_ptrs[col + 1];
-
-    const uword* start_ptr = &iterator_base::M->row_indices[     col_offset];
-    const uword*   end_ptr = &iterator_base::M->row_indices[next_col_offset];
-
-    if (start_ptr != end_ptr)
-      {
-      const uword* pos_ptr = std::lower_bound(start_ptr, end_ptr, in_row);
-
-      // This is the number of elements in the column with row index less than
-      // in_row.
-      const uword offset = (pos_ptr - start_ptr);
-
-      cur_pos += offset;
-
-      if (pos_ptr != end_ptr)
-        {
-        // This is the row index of the first element in the column with row index
-        // greater than or equal to in_row.
-        if ((*pos_ptr) < cur_min_row)
-          {
-          cur_min_row = (*pos_ptr);
-          cur_min_col = col;
-          cur_actual_pos = col_offset + offset;
-          }
-        }
-      }
-    }
-
-  // Now we know what the minimum row is.
-  internal_row = cur_min_row;
-  iterator_base::internal_col = cur_min_col;
-  iterator_base::internal_pos = cur_pos;
-  actual_pos = cur_actual_pos;
+  // Find the first element in the given row with column index greater than or
+  // equal to in_col; the column indices within each row of the mirror are sorted.
+  in_M.sync_csr();
+  
+  if(in_row >= in_M.n_rows)  { set_end(); return; }
+  
+  const uword* row_ptrs    = in_M.csr_row_ptrs.memptr();
+  const uword* col_indices = in_M.csr_col_indices.memptr();
+  
+  const uword* start_ptr = &col_indices[ row_ptrs[in_row    ] ];
+  const uword*   end_ptr = &col_indices[ row_ptrs[in_row + 1] ];
+  
+  const uword pos = uword(std::lower_bound(start_ptr, end_ptr, in_col) - col_indices);
+  
+  if(pos >= in_M.n_nonzero)  { set_end(); return; }
+  
+  // If the rest of the row is empty, the element belongs to a subsequent row.
+  internal_row = uword(std::upper_bound(row_ptrs + in_row, row_ptrs + in_M.n_rows + 1, pos) - row_ptrs) - 1;
+  
+  iterator_base::internal_col = col_indices[pos];
+  iterator_base::internal_pos = pos;
+  actual_pos                  = in_M.csr_locs[pos];
   }
 
 
@@ -561,6 +471,22 @@ SpMat<eT>::const_row_iterator::const_row_iterator(const typename SpMat<eT>::cons
 
 
 
+/**
+ * Put the iterator in the state shared by all iterators past the last element.
+ */
+template<typename eT>
+inline
+void
+SpMat<eT>::const_row_iterator::set_end()
+  {
+  iterator_base::internal_pos = iterator_base::M->n_nonzero;
+  iterator_base::internal_col = 0;
+  internal_row                = iterator_base::M->n_rows;
+  actual_pos                  = iterator_base::M->n_nonzero;
+  }
+
+
+
 /**
  * Increment the row_iterator.
  */
@@ -570,119 +496,25 @@ arma_hot
 typename SpMat<eT>::const_row_iterator&
 SpMat<eT>::const_row_iterator::operator++()
   {
-  // We just need to find the next nonzero element.
-  iterator_base::internal_pos++;
-
-  if(iterator_base::internal_pos == iterator_base::M->n_nonzero)
-    {
-    internal_row = iterator_base::M->n_rows;
-    iterator_base::internal_col = 0;
-
-    return *this;
-    }
-
-  // Otherwise, we need to search.  We can start in the next column and use
-  // lower_bound() to find the next element.
-  uword next_min_row = iterator_base::M->n_rows;
-  uword next_min_col = iterator_base::M->n_cols;
-  uword next_actual_pos = 0;
-
-  // Search from the current column to the end of the matrix.
-  for (uword col = iterator_base::internal_col + 1; col < iterator_base::M->n_cols; ++col)
-    {
-    // Find the first element with row greater than or equal to in_row.
-    const uword      col_offset = iterator_base::M->col_ptrs[col    ];
-    const uword next_col_offset = iterator_base::M->col_ptrs[col + 1];
-
-    const uword* start_ptr = &iterator_base::M->row_indices[     col_offset];
-    const uword*   end_ptr = &iterator_base::M->row_indices[next_col_offset];
-
-    if (start_ptr != end_ptr)
-      {
-      // Find the first element in the column with row greater than or equal to
-      // the current row.
-      const uword* pos_ptr = std::lower_bound(start_ptr, end_ptr, internal_row);
-
-      if (pos_ptr != end_ptr)
-        {
-        // We found something in the column, but is the row index correct?
-        if ((*pos_ptr) == internal_row)
-          {
-          // Exact match---so we are done.
-          iterator_base::internal_col = col;
-          actual_pos = col_offset + (pos_ptr - start_ptr);
-          return *this;
-          }
-        else if ((*pos_ptr) < next_min_row)
-          {
-          // The first element in this column is in a subsequent row, but it's
-          // the minimum row we've seen so far.
-          next_min_row = (*pos_ptr);
-          next_min_col = col;
-          next_actual_pos = col_offset + (pos_ptr - start_ptr);
-          }
-        else if ((*pos_ptr) == next_min_row && col < next_min_col)
-          {
-          // The first element in this column is in a subsequent row that we
-          // already have another element for, but the column index is less so
-          // this element will come first.
-          next_min_col = col;
-          next_actual_pos = col_offset + (pos_ptr - start_ptr);
-          }
-        }
-      }
-    }
-
-  // Restart the search in the next row.
-  for (uword col = 0; col <= iterator_base::internal_col; ++col)
-    {
-    // Find the first element with row greater than or equal to in_row + 1.
-    const uword      col_offset = iterator_base::M->col_ptrs[col    ];
-    const uword next_col_offset = iterator_base::M->col_ptrs[col + 1];
-
-    const uword* start_ptr = &iterator_base::M->row_indices[     col_offset];
-    const uword*   end_ptr = &iterator_base::M->row_indices[next_col_offset];
-
-    if (start_ptr != end_ptr)
-      {
-      const uword* pos_ptr = std::lower_bound(start_ptr, end_ptr, internal_row + 1);
-
-      if (pos_ptr != end_ptr)
-        {
-        // We found something in the column, but is the row index correct?
-        if ((*pos_ptr) == internal_row + 1)
-          {
-          // Exact match---so we are done.
-          iterator_base::internal_col = col;
-          internal_row++;
-          actual_pos = col_offset + (pos_ptr - start_ptr);
-          return *this;
-          }
-        else if ((*pos_ptr) < next_min_row)
-          {
-          // The first element in this column is in a subsequent row, but it's
-          // the minimum row we've seen so far.
-          next_min_row = (*pos_ptr);
-          next_min_col = col;
-          next_actual_pos = col_offset + (pos_ptr - start_ptr);
-          }
-        else if ((*pos_ptr) == next_min_row && col < next_min_col)
-          {
-          // The first element in this column is in a subsequent row that we
-          // already have another element for, but the column index is less so
-          // this element will come first.
-          next_min_col = col;
-          next_actual_pos = col_offset + (pos_ptr - start_ptr);
-          }
-        }
-      }
-    }
-
-  iterator_base::internal_col = next_min_col;
-  internal_row = next_min_row;
-  actual_pos = next_actual_pos;
-
-  return *this; // Now we are done.
+  const SpMat<eT>& X = *(iterator_base::M);
+  
+  // the mirror is rebuilt if the matrix was modified through a row_iterator
+  X.sync_csr();
+  
+  const uword pos = iterator_base::internal_pos + 1;
+  
+  if(pos >= X.n_nonzero)  { set_end(); return *this; }
+  
+  // Skip over any empty rows.
+  const uword* row_ptrs = X.csr_row_ptrs.memptr();
+  
+  while(row_ptrs[internal_row + 1] <= pos)  { ++internal_row; }
+  
+  iterator_base::internal_col = X.csr_col_indices[pos];
+  iterator_base::internal_pos = pos;
+  actual_pos                  = X.csr_locs[pos];
+  
+  return *this;
   }
 
 
@@ -719,90 +551,24 @@ SpMat<eT>::const_row_iterator::operator--()
     // Do nothing; we are already at the beginning.
     return *this;
     }
-
-  iterator_base::internal_pos--;
-
-  // We have to search backwards.  We'll do this by going backwards over columns
-  // and seeing if we find an element in the same row.
-  uword max_row = 0;
-  uword max_col = 0;
-  uword next_actual_pos = 0;
-
-  //for (uword col = iterator_base::internal_col; col > 1; --col)
-  for (uword col = iterator_base::internal_col; col >= 1; --col)
-    {
-    // Find the first element with row greater than or equal to in_row + 1.
-    const uword      col_offset = iterator_base::M->col_ptrs[col - 1];
-    const uword next_col_offset = iterator_base::M->col_ptrs[col    ];
-
-    const uword* start_ptr = &iterator_base::M->row_indices[     col_offset];
-    const uword*   end_ptr = &iterator_base::M->row_indices[next_col_offset];
-
-    if (start_ptr != end_ptr)
-      {
-      // There are elements in this column.
-      const uword* pos_ptr = std::lower_bound(start_ptr, end_ptr, internal_row + 1);
-
-      if (pos_ptr != start_ptr)
-        {
-        // The element before pos_ptr is the one we are interested in.
-        if (*(pos_ptr - 1) > max_row)
-          {
-          max_row = *(pos_ptr - 1);
-          max_col = col - 1;
-          next_actual_pos = col_offset + (pos_ptr - 1 - start_ptr);
-          }
-        else if (*(pos_ptr - 1) == max_row && (col - 1) > max_col)
-          {
-          max_col = col - 1;
-          next_actual_pos = col_offset + (pos_ptr - 1 - start_ptr);
-          }
-        }
-      }
-    }
-
-  // Now loop around to the columns at the end of the matrix.
-  for (uword col = iterator_base::M->n_cols - 1; col >= iterator_base::internal_col; --col)
-    {
-    // Find the first element with row greater than or equal to in_row + 1.
-    const uword      col_offset = iterator_base::M->col_ptrs[col    ];
-    const uword next_col_offset = iterator_base::M->col_ptrs[col + 1];
-
-    const uword* start_ptr = &iterator_base::M->row_indices[     col_offset];
-    const uword*   end_ptr = &iterator_base::M->row_indices[next_col_offset];
-
-    if (start_ptr != end_ptr)
-      {
-      // There are elements in this column.
-      const uword* pos_ptr = std::lower_bound(start_ptr, end_ptr, internal_row);
-
-      if (pos_ptr != start_ptr)
-        {
-        // There are elements in this column with row index < internal_row.
-        if (*(pos_ptr - 1) > max_row)
-          {
-          max_row = *(pos_ptr - 1);
-          max_col = col;
-          next_actual_pos = col_offset + (pos_ptr - 1 - start_ptr);
-          }
-        else if (*(pos_ptr - 1) == max_row && col > max_col)
-          {
-          max_col = col;
-          next_actual_pos = col_offset + (pos_ptr - 1 - start_ptr);
-          }
-        }
-      }
-
-    if (col == 0) // Catch edge case that the loop termination condition won't.
-      {
-      break;
-      }
-    }
-
-  iterator_base::internal_col = max_col;
-  internal_row = max_row;
-  actual_pos = next_actual_pos;
-
+  
+  const SpMat<eT>& X = *(iterator_base::M);
+  
+  X.sync_csr();
+  
+  const uword pos = (std::min)(iterator_base::internal_pos, X.n_nonzero) - 1;
+  
+  // Skip back over any empty rows; the end position is in row n_rows.
+  const uword* row_ptrs = X.csr_row_ptrs.memptr();
+  
+  internal_row = (std::min)(internal_row, X.n_rows);
+  
+  while(row_ptrs[internal_row] > pos)  { --internal_row; }
+  
+  iterator_base::internal_col = X.csr_col_indices[pos];
+  iterator_base::internal_pos = pos;
+  actual_pos                  = X.csr_locs[pos];
+  
   return *this;
   }
 
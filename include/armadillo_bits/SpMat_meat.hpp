@@ -29,6 +29,7 @@ SpMat<eT>::SpMat()
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(memory::acquire_chunked<eT>(1))
   , row_indices(memory::acquire_chunked<uword>(1))
   , col_ptrs(memory::acquire<uword>(2))
@@ -55,8 +56,7 @@ SpMat<eT>::~SpMat()
   {
   arma_extra_debug_sigprint_this(this);
   
-  if(values     )  { memory::release(access::rw(values));      }
-  if(row_indices)  { memory::release(access::rw(row_indices)); }
+  if(values     )  { mem_release();                            }
   if(col_ptrs   )  { memory::release(access::rw(col_ptrs));    }
   }
 
@@ -73,6 +73,7 @@ SpMat<eT>::SpMat(const uword in_rows, const uword in_cols)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -92,6 +93,7 @@ SpMat<eT>::SpMat(const SizeMat& s)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -114,6 +116,7 @@ SpMat<eT>::SpMat(const char* text)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -147,6 +150,7 @@ SpMat<eT>::SpMat(const std::string& text)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -180,6 +184,7 @@ SpMat<eT>::SpMat(const SpMat<eT>& x)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -201,6 +206,7 @@ SpMat<eT>::SpMat(const SpMat<eT>& x)
     , n_elem(0)
     , n_nonzero(0)
     , vec_state(0)
+    , mem_state(0)
     , values(NULL)
     , row_indices(NULL)
     , col_ptrs(NULL)
@@ -237,6 +243,7 @@ SpMat<eT>::SpMat(const MapMat<eT>& x)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -276,6 +283,7 @@ SpMat<eT>::SpMat(const Base<uword,T1>& locations_expr, const Base<eT,T2>& vals_e
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -352,6 +360,7 @@ SpMat<eT>::SpMat(const Base<uword,T1>& locations_expr, const Base<eT,T2>& vals_e
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -424,6 +433,7 @@ SpMat<eT>::SpMat(const bool add_values, const Base<uword,T1>& locations_expr, co
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -510,6 +520,7 @@ SpMat<eT>::SpMat
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -547,6 +558,61 @@ SpMat<eT>::SpMat
 
 
 
+//! construct from existing CSC arrays;
+//! if copy_aux_mem is false, the 'values' and 'row_indices' arrays are used directly (without copying);
+//! the column pointers are always copied, as they are extended with a sentinel
+template<typename eT>
+inline
+SpMat<eT>::SpMat
+  (
+        uword* aux_row_indices,
+  const uword* aux_col_ptrs,
+           eT* aux_values,
+  const uword  aux_n_rows,
+  const uword  aux_n_cols,
+  const bool   copy_aux_mem
+  )
+  : n_rows(0)
+  , n_cols(0)
+  , n_elem(0)
+  , n_nonzero(0)
+  , vec_state(0)
+  , mem_state(0)
+  , values(NULL)
+  , row_indices(NULL)
+  , col_ptrs(NULL)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  init(aux_n_rows, aux_n_cols);
+  
+  arma_debug_check( (aux_col_ptrs[0] != 0), "SpMat::SpMat(): first column pointer is not zero" );
+  
+  const uword aux_n_nonzero = aux_col_ptrs[aux_n_cols];
+  
+  // not checked for consistency, as for the constructor taking rowind, colptr and values objects
+  arrayops::copy(access::rwp(col_ptrs), aux_col_ptrs, aux_n_cols + 1);
+  
+  if( copy_aux_mem || (aux_n_nonzero == 0) )
+    {
+    mem_resize(aux_n_nonzero);
+    
+    arrayops::copy(access::rwp(row_indices), aux_row_indices, aux_n_nonzero);
+    arrayops::copy(access::rwp(values),      aux_values,      aux_n_nonzero);
+    }
+  else
+    {
+    mem_release();
+    
+    access::rw(values)      = aux_values;
+    access::rw(row_indices) = aux_row_indices;
+    access::rw(n_nonzero)   = aux_n_nonzero;
+    access::rw(mem_state)   = 1;
+    }
+  }
+
+
+
 template<typename eT>
 inline
 SpMat<eT>&
@@ -774,6 +840,7 @@ SpMat<eT>::SpMat
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL) // extra element is set when mem_resize is called
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -866,6 +933,7 @@ SpMat<eT>::SpMat(const Base<eT, T1>& x)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL) // extra element is set when mem_resize is called in operator=()
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -1160,6 +1228,7 @@ SpMat<eT>::SpMat(const SpSubview<eT>& X)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL) // extra element added when mem_resize is called
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -1193,15 +1262,44 @@ SpMat<eT>::operator=(const SpSubview<eT>& X)
 
     mem_resize(x_n_nonzero);
 
-    typename SpSubview<eT>::const_iterator it     = X.begin();
-    typename SpSubview<eT>::const_iterator it_end = X.end();
-
-    while(it != it_end)
+    if( (in_n_rows == 1) && (X.m.n_rows > 1) )
       {
-      access::rw(row_indices[it.pos()]) = it.row();
-      access::rw(values[it.pos()]) = (*it);
-      ++access::rw(col_ptrs[it.col() + 1]);
-      ++it;
+      // A single row is read from the CSR mirror of the parent matrix, where
+      // the elements of the row are contiguous and sorted by column.
+      const SpMat<eT>& m = X.m;
+      
+      m.sync_csr();
+      
+      const uword* m_col_indices = m.csr_col_indices.memptr();
+      const uword* m_locs        = m.csr_locs.memptr();
+      
+      const uword* start_ptr = &m_col_indices[ m.csr_row_ptrs[X.aux_row1    ] ];
+      const uword*   end_ptr = &m_col_indices[ m.csr_row_ptrs[X.aux_row1 + 1] ];
+      
+      const uword* first_ptr = std::lower_bound(start_ptr, end_ptr, X.aux_col1            );
+      const uword*  last_ptr = std::lower_bound(first_ptr, end_ptr, X.aux_col1 + in_n_cols);
+      
+      uword count = 0;
+      
+      for(const uword* ptr = first_ptr; ptr != last_ptr; ++ptr, ++count)
+        {
+        access::rw(row_indices[count]) = 0;
+        access::rw(values[count])      = m.values[ m_locs[ptr - m_col_indices] ];
+        ++access::rw(col_ptrs[(*ptr) - X.aux_col1 + 1]);
+        }
+      }
+    else
+      {
+      typename SpSubview<eT>::const_iterator it     = X.begin();
+      typename SpSubview<eT>::const_iterator it_end = X.end();
+
+      while(it != it_end)
+        {
+        access::rw(row_indices[it.pos()]) = it.row();
+        access::rw(values[it.pos()]) = (*it);
+        ++access::rw(col_ptrs[it.col() + 1]);
+        ++it;
+        }
       }
 
     // Now sum column pointers.
@@ -1323,6 +1421,7 @@ SpMat<eT>::SpMat(const spdiagview<eT>& X)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL) // extra element added when mem_resize is called
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -1427,6 +1526,7 @@ SpMat<eT>::SpMat(const SpOp<T1, spop_type>& X)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL) // set in application of sparse operation
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -1567,6 +1667,7 @@ SpMat<eT>::SpMat(const SpGlue<T1, T2, spglue_type>& X)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL) // extra element set in application of sparse glue
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -1592,6 +1693,7 @@ SpMat<eT>::SpMat(const mtSpOp<eT, T1, spop_type>& X)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(0)
+  , mem_state(0)
   , values(NULL) // extra element set in application of sparse glue
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -2739,8 +2841,7 @@ SpMat<eT>::shed_cols(const uword in_col1, const uword in_col2)
       arrayops::copy(new_row_indices + col_beg, row_indices + col_end, n_nonzero - col_end);
       }
 
-    memory::release(values);
-    memory::release(row_indices);
+    mem_release();
 
     access::rw(values)      = new_values;
     access::rw(row_indices) = new_row_indices;
@@ -3487,6 +3588,8 @@ SpMat<eT>::reshape(const uword in_rows, const uword in_cols)
   sync_csc();
   invalidate_cache();
   
+  mem_detach();
+  
   // We have to modify all of the relevant row indices and the relevant column pointers.
   // Iterate over all the points to do this.  We won't be deleting any points, but we will be modifying
   // columns and rows. We'll have to store a new set of column vectors.
@@ -3866,66 +3969,7 @@ SpMat<eT>::sprandu(const uword in_rows, const uword in_cols, const double densit
   
   zeros(in_rows, in_cols);
   
-  mem_resize( uword(density * double(in_rows) * double(in_cols) + 0.5) );
-  
-  if(n_nonzero == 0)
-    {
-    return *this;
-    }
-  
-  arma_rng::randu<eT>::fill( access::rwp(values), n_nonzero );
-  
-  uvec indices = linspace<uvec>( 0u, in_rows*in_cols-1, n_nonzero );
-  
-  // perturb the indices
-  for(uword i=1; i < n_nonzero-1; ++i)
-    {
-    const uword index_left  = indices[i-1];
-    const uword index_right = indices[i+1];
-    
-    const uword center = (index_left + index_right) / 2;
-    
-    const uword delta1 = center      - index_left - 1;
-    const uword delta2 = index_right - center     - 1;
-    
-    const uword min_delta = (std::min)(delta1, delta2);
-    
-    uword index_new = uword( double(center) + double(min_delta) * (2.0*randu()-1.0) );
-    
-    // paranoia, but better be safe than sorry
-    if( (index_left < index_new) && (index_new < index_right) )
-      {
-      indices[i] = index_new;
-      }
-    }
-  
-  uword cur_index = 0;
-  uword count     = 0;  
-  
-  for(uword lcol = 0; lcol < in_cols; ++lcol)
-  for(uword lrow = 0; lrow < in_rows; ++lrow)
-    {
-    if(count == indices[cur_index])
-      {
-      access::rw(row_indices[cur_index]) = lrow;
-      access::rw(col_ptrs[lcol + 1])++;
-      ++cur_index;
-      }
-    
-    ++count;
-    }
-  
-  if(cur_index != n_nonzero)
-    {
-    // Fix size to correct size.
-    mem_resize(cur_index);
-    }
-  
-  // Sum column pointers.
-  for(uword lcol = 1; lcol <= in_cols; ++lcol)
-    {
-    access::rw(col_ptrs[lcol]) += col_ptrs[lcol - 1];
-    }
+  sp_rand_helper::generate(*this, density, false);
   
   return *this;
   }
@@ -3955,66 +3999,7 @@ SpMat<eT>::sprandn(const uword in_rows, const uword in_cols, const double densit
   
   zeros(in_rows, in_cols);
   
-  mem_resize( uword(density * double(in_rows) * double(in_cols) + 0.5) );
-  
-  if(n_nonzero == 0)
-    {
-    return *this;
-    }
-  
-  arma_rng::randn<eT>::fill( access::rwp(values), n_nonzero );
-  
-  uvec indices = linspace<uvec>( 0u, in_rows*in_cols-1, n_nonzero );
-  
-  // perturb the indices
-  for(uword i=1; i < n_nonzero-1; ++i)
-    {
-    const uword index_left  = indices[i-1];
-    const uword index_right = indices[i+1];
-    
-    const uword center = (index_left + index_right) / 2;
-    
-    const uword delta1 = center      - index_left - 1;
-    const uword delta2 = index_right - center     - 1;
-    
-    const uword min_delta = (std::min)(delta1, delta2);
-    
-    uword index_new = uword( double(center) + double(min_delta) * (2.0*randu()-1.0) );
-    
-    // paranoia, but better be safe than sorry
-    if( (index_left < index_new) && (index_new < index_right) )
-      {
-      indices[i] = index_new;
-      }
-    }
-  
-  uword cur_index = 0;
-  uword count     = 0;  
-  
-  for(uword lcol = 0; lcol < in_cols; ++lcol)
-  for(uword lrow = 0; lrow < in_rows; ++lrow)
-    {
-    if(count == indices[cur_index])
-      {
-      access::rw(row_indices[cur_index]) = lrow;
-      access::rw(col_ptrs[lcol + 1])++;
-      ++cur_index;
-      }
-    
-    ++count;
-    }
-  
-  if(cur_index != n_nonzero)
-    {
-    // Fix size to correct size.
-    mem_resize(cur_index);
-    }
-  
-  // Sum column pointers.
-  for(uword lcol = 1; lcol <= in_cols; ++lcol)
-    {
-    access::rw(col_ptrs[lcol]) += col_ptrs[lcol - 1];
-    }
+  sp_rand_helper::generate(*this, density, true);
   
   return *this;
   }
@@ -4115,6 +4100,14 @@ SpMat<eT>::save(const std::string name, const file_type type, const bool print_s
       save_okay = diskio::save_coord_ascii(*this, name);
       break;
     
+    case mm_ascii:
+      save_okay = diskio::save_mm_ascii(*this, name);
+      break;
+    
+    case csc_binary:
+      save_okay = diskio::save_csc_binary(*this, name);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::save(): unsupported file type"); }
       save_okay = false;
@@ -4158,6 +4151,14 @@ SpMat<eT>::save(std::ostream& os, const file_type type, const bool print_status)
       save_okay = diskio::save_coord_ascii(*this, os);
       break;
     
+    case mm_ascii:
+      save_okay = diskio::save_mm_ascii(*this, os);
+      break;
+    
+    case csc_binary:
+      save_okay = diskio::save_csc_binary(*this, os);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::save(): unsupported file type"); }
       save_okay = false;
@@ -4206,6 +4207,14 @@ SpMat<eT>::load(const std::string name, const file_type type, const bool print_s
       load_okay = diskio::load_coord_ascii(*this, name, err_msg);
       break;
     
+    case mm_ascii:
+      load_okay = diskio::load_mm_ascii(*this, name, err_msg);
+      break;
+    
+    case csc_binary:
+      load_okay = diskio::load_csc_binary(*this, name, err_msg);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::load(): unsupported file type"); }
       load_okay = false;
@@ -4269,6 +4278,14 @@ SpMat<eT>::load(std::istream& is, const file_type type, const bool print_status)
       load_okay = diskio::load_coord_ascii(*this, is, err_msg);
       break;
     
+    case mm_ascii:
+      load_okay = diskio::load_mm_ascii(*this, is, err_msg);
+      break;
+    
+    case csc_binary:
+      load_okay = diskio::load_csc_binary(*this, is, err_msg);
+      break;
+    
     default:
       if(print_status)  { arma_debug_warn("SpMat::load(): unsupported file type"); }
       load_okay = false;
@@ -4399,8 +4416,7 @@ SpMat<eT>::init(uword in_rows, uword in_cols)
   // Clean out the existing memory.
   if (values)
     {
-    memory::release(values);
-    memory::release(row_indices);
+    mem_release();
     }
   
   access::rw(values)      = memory::acquire_chunked<eT>   (1);
@@ -4486,10 +4502,14 @@ SpMat<eT>::init(const SpMat<eT>& x)
     access::rw(row_indices) = memory::acquire_chunked<uword>(x.n_nonzero + 1);
 
     // Now copy over the elements.
-    arrayops::copy(access::rwp(values),      x.values,      x.n_nonzero + 1);
-    arrayops::copy(access::rwp(row_indices), x.row_indices, x.n_nonzero + 1);
+    // The final value and row index are set explicitly, as x may be using auxiliary memory without them.
+    arrayops::copy(access::rwp(values),      x.values,      x.n_nonzero);
+    arrayops::copy(access::rwp(row_indices), x.row_indices, x.n_nonzero);
     arrayops::copy(access::rwp(col_ptrs),    x.col_ptrs,    x.n_cols + 1);
     
+    access::rw(     values[x.n_nonzero]) = eT(0);
+    access::rw(row_indices[x.n_nonzero]) = uword(0);
+    
     access::rw(n_nonzero) = x.n_nonzero;
     }
   }
@@ -4632,54 +4652,10 @@ SpMat<eT>::init_batch_std(const Mat<uword>& locs, const Mat<eT>& vals, const boo
     
     if(actually_sorted == false)
       {
-      // see op_sort_index_bones.hpp for the definition of arma_sort_index_packet and arma_sort_index_helper_ascend
-      
-      std::vector< arma_sort_index_packet<uword> > packet_vec(locs_n_cols);
+      // the column pointers are fully formed by the counting sort
+      sp_batch_helper::fill_unsorted(*this, locs, vals, false);
       
-      const uword* locs_mem = locs.memptr();
-      
-      for (uword i = 0; i < locs_n_cols; ++i)
-        {
-        const uword row = (*locs_mem);  locs_mem++;
-        const uword col = (*locs_mem);  locs_mem++;
-        
-        packet_vec[i].val   = (col * n_rows) + row;
-        packet_vec[i].index = i;
-        }
-      
-      arma_sort_index_helper_ascend<uword> comparator;
-      
-      std::sort( packet_vec.begin(), packet_vec.end(), comparator );
-      
-      // insert the elements in the sorted order
-      for (uword i = 0; i < locs_n_cols; ++i)
-        {
-        const uword index = packet_vec[i].index;
-        
-        const uword* locs_i = locs.colptr(index);
-        
-        const uword row_i = locs_i[0];
-        const uword col_i = locs_i[1];
-        
-        arma_debug_check( ( (row_i >= n_rows) || (col_i >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        if(i > 0)
-          {
-          const uword prev_index = packet_vec[i-1].index;
-          
-          const uword* locs_im1 = locs.colptr(prev_index);
-          
-          const uword row_im1 = locs_im1[0];
-          const uword col_im1 = locs_im1[1];
-          
-          arma_debug_check( ( (row_i == row_im1) && (col_i == col_im1) ), "SpMat::SpMat(): detected identical locations" );
-          }
-        
-        access::rw(values[i])      = vals[index];
-        access::rw(row_indices[i]) = row_i;
-        
-        access::rw(col_ptrs[ col_i + 1 ])++;
-        }
+      return;
       }
     }
   
@@ -4767,68 +4743,12 @@ SpMat<eT>::init_batch_add(const Mat<uword>& locs, const Mat<eT>& vals, const boo
     
     if(actually_sorted == false)
       {
-      // This may not be the fastest possible implementation but it maximizes code reuse.
-      Col<uword> abslocs(locs.n_cols);
-      
-      for (uword i = 0; i < locs.n_cols; ++i)
-        {
-        const uword* locs_i = locs.colptr(i);
-        
-        abslocs[i] = locs_i[1] * n_rows + locs_i[0];
-        }
-      
-      uvec sorted_indices = sort_index(abslocs); // Ascending sort.
-      
-      // work out the number of unique elments 
-      uword n_unique = 1;  // first element is unique
-      
-      for(uword i=1; i < sorted_indices.n_elem; ++i)
-        {
-        const uword* locs_i   = locs.colptr( sorted_indices[i  ] );
-        const uword* locs_im1 = locs.colptr( sorted_indices[i-1] );
-        
-        if( (locs_i[1] != locs_im1[1]) || (locs_i[0] != locs_im1[0]) )  { ++n_unique; }
-        }
-      
-      // resize to correct number of elements
-      mem_resize(n_unique);
-      
-      // Now we add the elements in this sorted order.
-      uword count = 0;
+      // the counting sort sums the elements at identical locations while forming the column pointers
+      mem_resize(locs.n_cols);
       
-      // first element
-        {
-        const uword  i      = 0;
-        const uword* locs_i = locs.colptr( sorted_indices[i] );
-        
-        arma_debug_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        access::rw(values[count])      = vals[ sorted_indices[i] ];
-        access::rw(row_indices[count]) = locs_i[0];
-        
-        access::rw(col_ptrs[ locs_i[1] + 1 ])++;
-        }
+      sp_batch_helper::fill_unsorted(*this, locs, vals, true);
       
-      for(uword i=1; i < sorted_indices.n_elem; ++i)
-        {
-        const uword* locs_i   = locs.colptr( sorted_indices[i  ] );
-        const uword* locs_im1 = locs.colptr( sorted_indices[i-1] );
-        
-        arma_debug_check( ( (locs_i[0] >= n_rows) || (locs_i[1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
-        
-        if( (locs_i[1] == locs_im1[1]) && (locs_i[0] == locs_im1[0]) )
-          {
-          access::rw(values[count]) += vals[ sorted_indices[i] ];
-          }
-        else
-          {
-          count++;
-          access::rw(values[count])      = vals[ sorted_indices[i] ];
-          access::rw(row_indices[count]) = locs_i[0];
-          
-          access::rw(col_ptrs[ locs_i[1] + 1 ])++;
-          }
-        }
+      return;
       }
     }
   
@@ -4913,6 +4833,7 @@ SpMat<eT>::SpMat(const arma_vec_indicator&, const uword in_vec_state)
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(in_vec_state)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -4936,6 +4857,7 @@ SpMat<eT>::SpMat(const arma_vec_indicator&, const uword in_n_rows, const uword i
   , n_elem(0)
   , n_nonzero(0)
   , vec_state(in_vec_state)
+  , mem_state(0)
   , values(NULL)
   , row_indices(NULL)
   , col_ptrs(NULL)
@@ -4960,8 +4882,7 @@ SpMat<eT>::mem_resize(const uword new_n_nonzero)
     {
     if(new_n_nonzero == 0)
       {
-      memory::release(values);
-      memory::release(row_indices);
+      mem_release();
       
       access::rw(values)      = memory::acquire_chunked<eT>   (1);
       access::rw(row_indices) = memory::acquire_chunked<uword>(1);
@@ -4972,8 +4893,9 @@ SpMat<eT>::mem_resize(const uword new_n_nonzero)
     else
       {
       // Figure out the actual amount of memory currently allocated.
-      // NOTE: this relies on memory::acquire_chunked() being used for the 'values' and 'row_indices' arrays
-      const uword n_alloc = memory::enlarge_to_mult_of_chunksize(n_nonzero);
+      // NOTE: this relies on memory::acquire_chunked() being used for the 'values' and 'row_indices' arrays;
+      // NOTE: auxiliary memory has no spare capacity, so it is always replaced
+      const uword n_alloc = (mem_state == 0) ? memory::enlarge_to_mult_of_chunksize(n_nonzero) : uword(0);
       
       if(n_alloc < new_n_nonzero)
         {
@@ -4989,8 +4911,7 @@ SpMat<eT>::mem_resize(const uword new_n_nonzero)
           arrayops::copy(new_row_indices, row_indices, copy_len);
           }
         
-        memory::release(values);
-        memory::release(row_indices);
+        mem_release();
         
         access::rw(values)      = new_values;
         access::rw(row_indices) = new_row_indices;
@@ -5109,8 +5030,15 @@ SpMat<eT>::steal_mem_simple(SpMat<eT>& x)
   
   if(this != &x)
     {
-    if(values     )  { memory::release(access::rw(values));      }
-    if(row_indices)  { memory::release(access::rw(row_indices)); }
+    if(x.mem_state != 0)
+      {
+      // auxiliary memory is not owned by x, so it can't be transferred
+      init(x);
+      
+      return;
+      }
+    
+    if(values     )  { mem_release();                            }
     if(col_ptrs   )  { memory::release(access::rw(col_ptrs));    }
     
     access::rw(n_rows)    = x.n_rows;
@@ -5131,6 +5059,10 @@ SpMat<eT>::steal_mem_simple(SpMat<eT>& x)
     access::rw(x.values)      = NULL;
     access::rw(x.row_indices) = NULL;
     access::rw(x.col_ptrs)    = NULL;
+    
+    invalidate_csr();
+    
+    x.invalidate_csr();
     }
   }
 
@@ -5208,9 +5140,11 @@ SpMat<eT>::init_xform_mt(const SpBase<eT2,T1>& A, const Functor& func)
       access::rw(values)      = memory::acquire_chunked<eT>   (x.n_nonzero + 1);
       access::rw(row_indices) = memory::acquire_chunked<uword>(x.n_nonzero + 1);
       
-      arrayops::copy(access::rwp(row_indices), x.row_indices, x.n_nonzero + 1);
+      arrayops::copy(access::rwp(row_indices), x.row_indices, x.n_nonzero    );
       arrayops::copy(access::rwp(col_ptrs),    x.col_ptrs,    x.n_cols    + 1);
       
+      access::rw(row_indices[x.n_nonzero]) = uword(0);
+      
       access::rw(n_nonzero) = x.n_nonzero;
       }
     
@@ -5795,6 +5729,8 @@ SpMat<eT>::insert_element(const uword in_row, const uword in_col, const eT val)
   // Element doesn't exist, so we have to insert it
   // 
   
+  mem_detach();
+  
   // We have to update the rest of the column pointers.
   for (uword i = in_col + 1; i < n_cols + 1; i++)
     {
@@ -5885,6 +5821,8 @@ SpMat<eT>::delete_element(const uword in_row, const uword in_col)
       {
       if (in_row == row_indices[pos])
         {
+        mem_detach();
+        
         const uword old_n_nonzero = n_nonzero;
         
         --access::rw(n_nonzero); // Remove one from the count of nonzero elements.
@@ -5944,6 +5882,49 @@ SpMat<eT>::delete_element(const uword in_row, const uword in_col)
 
 
 
+template<typename eT>
+inline
+void
+SpMat<eT>::mem_release()
+  {
+  arma_extra_debug_sigprint();
+  
+  if(mem_state == 0)
+    {
+    memory::release(access::rw(values));
+    memory::release(access::rw(row_indices));
+    }
+  
+  access::rw(mem_state) = 0;
+  }
+
+
+
+template<typename eT>
+inline
+void
+SpMat<eT>::mem_detach()
+  {
+  arma_extra_debug_sigprint();
+  
+  if(mem_state == 0)  { return; }
+  
+  eT*    new_values      = memory::acquire_chunked<eT>   (n_nonzero + 1);
+  uword* new_row_indices = memory::acquire_chunked<uword>(n_nonzero + 1);
+  
+  arrayops::copy(new_values,      values,      n_nonzero);
+  arrayops::copy(new_row_indices, row_indices, n_nonzero);
+  
+  new_values[n_nonzero]      = eT(0);
+  new_row_indices[n_nonzero] = uword(0);
+  
+  access::rw(values)      = new_values;
+  access::rw(row_indices) = new_row_indices;
+  access::rw(mem_state)   = 0;
+  }
+
+
+
 template<typename eT>
 arma_inline
 void
@@ -5953,6 +5934,8 @@ SpMat<eT>::invalidate_cache() const
   
   cache.reset();
   sync_state = 0;
+  
+  invalidate_csr();
   }
 
 
@@ -5965,6 +5948,24 @@ SpMat<eT>::invalidate_csc() const
   arma_extra_debug_sigprint();
   
   sync_state = 1;
+  
+  invalidate_csr();
+  }
+
+
+
+template<typename eT>
+arma_inline
+void
+SpMat<eT>::invalidate_csr() const
+  {
+  arma_extra_debug_sigprint();
+  
+  csr_row_ptrs.reset();
+  csr_col_indices.reset();
+  csr_locs.reset();
+  
+  csr_state = 0;
   }
 
 
@@ -6084,6 +6085,75 @@ SpMat<eT>::sync_csc() const
 
 
 
+//! build the CSR mirror if required; the CSC representation is synchronised first
+template<typename eT>
+inline
+void
+SpMat<eT>::sync_csr() const
+  {
+  arma_extra_debug_sigprint();
+  
+  sync_csc();
+  
+  // see the note in sync_cache() above
+  
+  #if defined(ARMA_USE_OPENMP)
+    if(csr_state == 0)
+      {
+      #pragma omp critical
+      if(csr_state == 0)
+        {
+        init_csr();
+        
+        csr_state = 1;
+        }
+      }
+  #elif defined(ARMA_USE_CXX11)
+    if(csr_state == 0)
+      {
+      cache_mutex.lock();
+      if(csr_state == 0)
+        {
+        init_csr();
+        
+        csr_state = 1;
+        }
+      cache_mutex.unlock();
+      }
+  #else
+    if(csr_state == 0)
+      {
+      init_csr();
+      
+      csr_state = 1;
+      }
+  #endif
+  }
+
+
+
+//! counting sort of the CSC elements by row; as columns are visited in order,
+//! the column indices within each row come out sorted
+template<typename eT>
+inline
+void
+SpMat<eT>::init_csr() const
+  {
+  arma_extra_debug_sigprint();
+  
+  csr_row_ptrs.set_size(n_rows + 1);
+  csr_col_indices.set_size(n_nonzero);
+  csr_locs.set_size(n_nonzero);
+  
+  // a counting sort of the elements by row; with OpenMP, each thread handles a range of the elements
+  
+  const sp_batch_helper::csr_pass pass(col_ptrs, n_cols, row_indices, csr_col_indices.memptr(), csr_locs.memptr());
+  
+  sp_batch_helper::counting_pass(pass, n_nonzero, n_rows, csr_row_ptrs.memptr());
+  }
+
+
+
 //
 // SpMat_aux
 
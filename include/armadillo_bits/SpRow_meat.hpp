@@ -258,8 +258,7 @@ SpRow<eT>::shed_cols(const uword in_col1, const uword in_col2)
       arrayops::copy(new_row_indices + start, SpMat<eT>::row_indices + end, (SpMat<eT>::n_nonzero - end));
       }
 
-    memory::release(SpMat<eT>::values);
-    memory::release(SpMat<eT>::row_indices);
+    SpMat<eT>::mem_release();
 
     access::rw(SpMat<eT>::values) = new_values;
     access::rw(SpMat<eT>::row_indices) = new_row_indices;
@@ -184,7 +184,7 @@ class SpSubview : public SpBase<eT, SpSubview<eT> >
     arma_inline eT operator*() const;
 
     // Don't hold location internally; call "dummy" methods to get that information.
-    arma_inline uword row() const { return iterator_base::M->m.row_indices[iterator_base::internal_pos + skip_pos] - iterator_base::M->aux_row1; }
+    arma_inline uword row() const { const uword p = iterator_base::internal_pos + skip_pos; return ((p < iterator_base::M->m.n_nonzero) ? iterator_base::M->m.row_indices[p] : uword(0)) - iterator_base::M->aux_row1; }
 
     inline arma_hot         const_iterator& operator++();
     inline arma_warn_unused const_iterator  operator++(int);
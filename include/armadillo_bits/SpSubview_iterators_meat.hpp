@@ -199,7 +199,6 @@ SpSubview<eT>::const_iterator::const_iterator(const SpSubview<eT>& in_M, const u
   while(true)
     {
     const uword next_colptr = iterator_base::M->m.col_ptrs[cur_col + aux_col + 1];
-    row_index = iterator_base::M->m.row_indices[cur_pos + skip_pos];
 
     // Are we at the last position?
     if(cur_col >= ln_cols)
@@ -210,6 +209,9 @@ SpSubview<eT>::const_iterator::const_iterator(const SpSubview<eT>& in_M, const u
       break;
       }
 
+    // read the row index only once we are known to be within the parent matrix
+    row_index = iterator_base::M->m.row_indices[cur_pos + skip_pos];
+
     if(row_index < aux_row)
       {
       ++skip_pos;
@@ -295,7 +297,6 @@ SpSubview<eT>::const_iterator::operator++()
   while(true)
     {
     const uword next_colptr = iterator_base::M->m.col_ptrs[cur_col + aux_col + 1];
-    row_index = iterator_base::M->m.row_indices[cur_pos + lskip_pos];
 
     // Did we move any columns?
     while((cur_col < ln_cols) && ((lskip_pos + cur_pos) >= iterator_base::M->m.col_ptrs[cur_col + aux_col + 1]))
@@ -312,6 +313,8 @@ SpSubview<eT>::const_iterator::operator++()
       break;
       }
 
+    row_index = iterator_base::M->m.row_indices[cur_pos + lskip_pos];
+
     if(row_index < aux_row)
       {
       ++lskip_pos;
@@ -359,47 +362,42 @@ SpSubview<eT>::const_iterator::operator--()
   const uword aux_col = iterator_base::M->aux_col1;
   const uword aux_row = iterator_base::M->aux_row1;
   const uword ln_rows = iterator_base::M->n_rows;
+  const uword ln_cols = iterator_base::M->n_cols;
 
-  uword cur_col  = iterator_base::internal_col;
-  uword cur_pos  = iterator_base::internal_pos - 1;
+  const uword* m_col_ptrs    = iterator_base::M->m.col_ptrs;
+  const uword* m_row_indices = iterator_base::M->m.row_indices;
 
-  // Special condition for end of iterator.
-  if((skip_pos + cur_pos + 1) == iterator_base::M->m.n_nonzero)
-    {
-    // We are at the last element.  So we need to set skip_pos back to what it
-    // would be if we didn't manually modify it back in operator++().
-    skip_pos = iterator_base::M->m.col_ptrs[cur_col + aux_col] - iterator_base::internal_pos;
-    }
+  uword cur_col = iterator_base::internal_col;
+  uword cur_pos = iterator_base::internal_pos - 1;
 
-  uword row_index;
+  // Position in the parent matrix from which to search backwards.
+  // At the end of the iterator, skip_pos points at the end of the parent matrix,
+  // so start from the first element after the last column of the subview instead.
+  uword m_pos = (cur_col >= ln_cols) ? m_col_ptrs[aux_col + ln_cols] : (iterator_base::internal_pos + skip_pos);
 
+  // The previous element exists (decrementing begin() is not allowed),
+  // so m_pos stays within [0, m.n_nonzero) and cur_col does not go below zero.
   while(true)
     {
-    const uword colptr = iterator_base::M->m.col_ptrs[cur_col + aux_col];
-    row_index = iterator_base::M->m.row_indices[cur_pos + skip_pos];
+    --m_pos;
 
     // Did we move back any columns?
-    while((skip_pos + cur_pos) < iterator_base::M->m.col_ptrs[cur_col + aux_col])
+    while(m_pos < m_col_ptrs[cur_col + aux_col])
       {
       --cur_col;
       }
 
-    if(row_index < aux_row)
-      {
-      skip_pos -= (colptr - (cur_pos + skip_pos) + 1);
-      }
-    else if(row_index < (aux_row + ln_rows))
+    const uword row_index = m_row_indices[m_pos];
+
+    if( (row_index >= aux_row) && (row_index < (aux_row + ln_rows)) )
       {
       break; // found
       }
-    else
-      {
-      --skip_pos;
-      }
     }
 
   iterator_base::internal_pos = cur_pos;
   iterator_base::internal_col = cur_col;
+  skip_pos                    = m_pos - cur_pos;
 
   return *this;
   }
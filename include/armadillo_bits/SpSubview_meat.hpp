@@ -33,6 +33,23 @@ SpSubview<eT>::SpSubview(const SpMat<eT>& in_m, const uword in_row1, const uword
   
   m.sync_csc();
   
+  // For a single row, use the CSR mirror of the parent matrix if it's already available.
+  // It's not built here, as subviews are also used for writing into the matrix.
+  if( (in_n_rows == 1) && (m.csr_state == 1) )
+    {
+    const uword* m_col_indices = m.csr_col_indices.memptr();
+    
+    const uword* start_ptr = &m_col_indices[ m.csr_row_ptrs[in_row1    ] ];
+    const uword*   end_ptr = &m_col_indices[ m.csr_row_ptrs[in_row1 + 1] ];
+    
+    const uword* first_ptr = std::lower_bound(start_ptr, end_ptr, in_col1            );
+    const uword*  last_ptr = std::lower_bound(first_ptr, end_ptr, in_col1 + in_n_cols);
+    
+    access::rw(n_nonzero) = uword(last_ptr - first_ptr);
+    
+    return;
+    }
+  
   // There must be a O(1) way to do this
   uword lend     = m.col_ptrs[in_col1 + in_n_cols];
   uword lend_row = in_row1 + in_n_rows;
@@ -67,6 +84,23 @@ SpSubview<eT>::SpSubview(SpMat<eT>& in_m, const uword in_row1, const uword in_co
   
   m.sync_csc();
   
+  // For a single row, use the CSR mirror of the parent matrix if it's already available.
+  // It's not built here, as subviews are also used for writing into the matrix.
+  if( (in_n_rows == 1) && (m.csr_state == 1) )
+    {
+    const uword* m_col_indices = m.csr_col_indices.memptr();
+    
+    const uword* start_ptr = &m_col_indices[ m.csr_row_ptrs[in_row1    ] ];
+    const uword*   end_ptr = &m_col_indices[ m.csr_row_ptrs[in_row1 + 1] ];
+    
+    const uword* first_ptr = std::lower_bound(start_ptr, end_ptr, in_col1            );
+    const uword*  last_ptr = std::lower_bound(first_ptr, end_ptr, in_col1 + in_n_cols);
+    
+    access::rw(n_nonzero) = uword(last_ptr - first_ptr);
+    
+    return;
+    }
+  
   // There must be a O(1) way to do this
   uword lend     = m.col_ptrs[in_col1 + in_n_cols];
   uword lend_row = in_row1 + in_n_rows;
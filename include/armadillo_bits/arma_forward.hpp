@@ -321,7 +321,9 @@ enum file_type
   ppm_binary,         //!< Portable Pixel Map (colour image), used by the field and cube classes
   hdf5_binary,        //!< Open binary format, not specific to Armadillo, which can store arbitrary data
   hdf5_binary_trans,  //!< as per hdf5_binary, but save/load the data with columns transposed to rows
-  coord_ascii         //!< simple co-ordinate format for sparse matrices
+  coord_ascii,        //!< simple co-ordinate format for sparse matrices
+  mm_ascii,           //!< Matrix Market co-ordinate format for sparse matrices
+  csc_binary          //!< binary compressed sparse column format for sparse matrices, which can be memory mapped via sp_mmap
   };
 
 
@@ -467,4 +469,31 @@ struct superlu_opts : public spsolve_opts_base
   };
 
 
+struct iterative_opts : public spsolve_opts_base
+  {
+  double       tol;         // stop when norm(B - A*X) <= tol * norm(B)
+  unsigned int max_iter;
+  unsigned int restart;     // length of the Krylov subspace before GMRES restarts
+  bool         warm_start;  // use X as the initial guess
+  
+  // convergence report, written by spsolve()
+  mutable unsigned int n_iter;
+  mutable double       rel_resid;
+  mutable bool         converged;
+  
+  inline iterative_opts()
+    : spsolve_opts_base(2)
+    {
+    tol        = 1e-8;
+    max_iter   = 1000;
+    restart    = 30;
+    warm_start = false;
+    
+    n_iter     = 0;
+    rel_resid  = 0.0;
+    converged  = false;
+    }
+  };
+
+
 //! @}
@@ -46,6 +46,11 @@ auxlib::inv(Mat<eT>& out, const Base<eT,T1>& X)
       return true;
       }
     }
+  else
+  if(N <= fixed_helper::max_size)
+    {
+    return fixed_helper::inv_smallmat(out.memptr(), out.memptr(), N);
+    }
   
   return auxlib::inv_inplace_lapack(out);
   }
@@ -87,6 +92,13 @@ auxlib::inv(Mat<eT>& out, const Mat<eT>& X)
         }
       }
     }
+  else
+  if(N <= fixed_helper::max_size)
+    {
+    if(&out != &X)  { out.set_size(N,N); }
+    
+    return fixed_helper::inv_smallmat(out.memptr(), X.memptr(), N);
+    }
   
   out = X;
   
@@ -480,6 +492,11 @@ auxlib::det(const Base<eT,T1>& X)
     
     if(std::abs(det_val) >= det_min)  { return det_val; }
     }
+  else
+  if(N <= fixed_helper::max_size)
+    {
+    return fixed_helper::det_smallmat(A.memptr(), N);
+    }
   
   return auxlib::det_lapack(A, make_copy);
   }
@@ -3408,6 +3425,471 @@ auxlib::solve_square_refine(Mat< std::complex<typename T1::pod_type> >& out, typ
 
 
 
+//! solve a system of linear equations via Cholesky decomposition;
+//! only the upper triangle of A is used; if the decomposition fails, A is restored from a saved copy and false is returned
+template<typename T1>
+inline
+bool
+auxlib::solve_sympd_fast(Mat<typename T1::elem_type>& out, Mat<typename T1::elem_type>& A, const Base<typename T1::elem_type,T1>& B_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::elem_type eT;
+    
+    Mat<eT> B = B_expr.get_ref();  // B is overwritten by lapack::posv(); out is not touched if the decomposition fails
+    
+    arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())
+      {
+      out.zeros(A.n_rows, B.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,B);
+    
+    podarray<eT> A_upper;
+    
+    auxlib::sympd_save_upper(A_upper, A);
+    
+    char     uplo = 'U';
+    blas_int n    = blas_int(A.n_rows);
+    blas_int nrhs = blas_int(B.n_cols);
+    blas_int info = blas_int(0);
+    
+    arma_extra_debug_print("lapack::posv()");
+    lapack::posv(&uplo, &n, &nrhs, A.memptr(), &n, B.memptr(), &n, &info);
+    
+    if(info != 0)
+      {
+      auxlib::sympd_load_upper(A, A_upper);
+      
+      return false;
+      }
+    
+    out.steal_mem(B);
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve a system of linear equations via Cholesky decomposition with refinement (real matrices);
+//! only the upper triangle of A is used; if A is not positive definite or is badly conditioned, A is restored and false is returned
+template<typename T1>
+inline
+bool
+auxlib::solve_sympd_refine(Mat<typename T1::pod_type>& out, typename T1::pod_type& out_rcond, Mat<typename T1::pod_type>& A, const Base<typename T1::pod_type,T1>& B_expr, const bool equilibrate)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::pod_type eT;
+    
+    Mat<eT> B = B_expr.get_ref();  // B is overwritten by lapack::posvx() if equilibration is done; out is not touched if the decomposition fails
+    
+    arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())
+      {
+      out.zeros(A.n_rows, B.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,B);
+    
+    char     fact  = (equilibrate) ? 'E' : 'N';
+    char     uplo  = 'U';
+    char     equed = char(0);
+    blas_int n     = blas_int(A.n_rows);
+    blas_int nrhs  = blas_int(B.n_cols);
+    blas_int info  = blas_int(0);
+    eT       rcond = eT(0);
+    
+    Mat<eT> AF(A.n_rows, A.n_rows);
+    Mat<eT>  X(A.n_rows, B.n_cols);
+    
+    podarray<eT>           S(  A.n_rows);
+    podarray<eT>        FERR(  B.n_cols);
+    podarray<eT>        BERR(  B.n_cols);
+    podarray<eT>        WORK(3*A.n_rows);
+    podarray<blas_int> IWORK(  A.n_rows);
+    
+    arma_extra_debug_print("lapack::posvx()");
+    lapack::posvx(&fact, &uplo, &n, &nrhs, A.memptr(), &n, AF.memptr(), &n, &equed, S.memptr(), B.memptr(), &n, X.memptr(), &n, &rcond, FERR.memptr(), BERR.memptr(), WORK.memptr(), IWORK.memptr(), &info);
+    
+    out_rcond = rcond;
+    
+    if(info != 0)
+      {
+      // not positive definite or badly conditioned; undo the equilibration of A, if any
+      
+      if(equed == 'Y')
+        {
+        // only the upper triangle is scaled by posvx()
+        
+        for(uword col=0; col < A.n_cols; ++col)
+        for(uword row=0; row <= col;     ++row)
+          {
+          A.at(row,col) /= (S[row] * S[col]);
+          }
+        }
+      
+      return false;
+      }
+    
+    out.steal_mem(X);
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(out_rcond);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_ignore(equilibrate);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve a system of linear equations via Cholesky decomposition with refinement (complex matrices);
+//! only the upper triangle of A is used; if A is not positive definite or is badly conditioned, A is restored and false is returned
+template<typename T1>
+inline
+bool
+auxlib::solve_sympd_refine(Mat< std::complex<typename T1::pod_type> >& out, typename T1::pod_type& out_rcond, Mat< std::complex<typename T1::pod_type> >& A, const Base<std::complex<typename T1::pod_type>,T1>& B_expr, const bool equilibrate)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_CRIPPLED_LAPACK)
+    {
+    arma_ignore(out_rcond);
+    arma_ignore(equilibrate);
+    
+    arma_debug_warn("solve(): refinement and/or equilibration not done due to crippled LAPACK");
+    
+    return auxlib::solve_sympd_fast(out, A, B_expr);
+    }
+  #elif defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::pod_type     T;
+    typedef typename std::complex<T> eT;
+    
+    Mat<eT> B = B_expr.get_ref();  // B is overwritten by lapack::cx_posvx() if equilibration is done; out is not touched if the decomposition fails
+    
+    arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())
+      {
+      out.zeros(A.n_rows, B.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,B);
+    
+    char     fact  = (equilibrate) ? 'E' : 'N';
+    char     uplo  = 'U';
+    char     equed = char(0);
+    blas_int n     = blas_int(A.n_rows);
+    blas_int nrhs  = blas_int(B.n_cols);
+    blas_int info  = blas_int(0);
+    T        rcond = T(0);
+    
+    Mat<eT> AF(A.n_rows, A.n_rows);
+    Mat<eT>  X(A.n_rows, B.n_cols);
+    
+    podarray< T>           S(  A.n_rows);
+    podarray< T>        FERR(  B.n_cols);
+    podarray< T>        BERR(  B.n_cols);
+    podarray<eT>        WORK(2*A.n_rows);
+    podarray< T>       RWORK(  A.n_rows);
+    
+    arma_extra_debug_print("lapack::cx_posvx()");
+    lapack::cx_posvx(&fact, &uplo, &n, &nrhs, A.memptr(), &n, AF.memptr(), &n, &equed, S.memptr(), B.memptr(), &n, X.memptr(), &n, &rcond, FERR.memptr(), BERR.memptr(), WORK.memptr(), RWORK.memptr(), &info);
+    
+    out_rcond = rcond;
+    
+    if(info != 0)
+      {
+      // not positive definite or badly conditioned; undo the equilibration of A, if any
+      
+      if(equed == 'Y')
+        {
+        // only the upper triangle is scaled by posvx()
+        
+        for(uword col=0; col < A.n_cols; ++col)
+        for(uword row=0; row <= col;     ++row)
+          {
+          A.at(row,col) /= (S[row] * S[col]);
+          }
+        }
+      
+      return false;
+      }
+    
+    out.steal_mem(X);
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(out_rcond);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_ignore(equilibrate);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve a system of linear equations via decomposition in single precision, followed by iterative refinement in double precision (real matrices);
+//! the decomposition is redone in double precision if the refinement does not converge.
+//! if sympd is true, Cholesky decomposition is used and only the upper triangle of A is used; if the decomposition fails, A is restored from a saved copy and false is returned
+template<typename T1>
+inline
+bool
+auxlib::solve_mixed(Mat<typename T1::pod_type>& out, Mat<typename T1::pod_type>& A, const Base<typename T1::pod_type,T1>& B_expr, const bool sympd)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::pod_type eT;
+    
+    if(is_double<eT>::value == false)
+      {
+      // no lower precision available
+      
+      return (sympd) ? auxlib::solve_sympd_fast(out, A, B_expr) : auxlib::solve_square_fast(out, A, B_expr);
+      }
+    
+    Mat<eT> B = B_expr.get_ref();  // out is not touched if the decomposition fails
+    
+    arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())
+      {
+      out.zeros(A.n_rows, B.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,B);
+    
+    Mat<eT> X(A.n_rows, B.n_cols);
+    
+    podarray<eT>     work( A.n_rows * B.n_cols );
+    podarray<float> swork( A.n_rows * (A.n_rows + B.n_cols) );
+    
+    blas_int n    = blas_int(A.n_rows);
+    blas_int nrhs = blas_int(B.n_cols);
+    blas_int iter = blas_int(0);
+    blas_int info = blas_int(0);
+    
+    if(sympd)
+      {
+      podarray<eT> A_upper;
+      
+      auxlib::sympd_save_upper(A_upper, A);
+      
+      char uplo = 'U';
+      
+      arma_extra_debug_print("lapack::dsposv()");
+      lapack::dsposv(&uplo, &n, &nrhs, A.memptr(), &n, B.memptr(), &n, X.memptr(), &n, work.memptr(), swork.memptr(), &iter, &info);
+      
+      if(info > 0)  { auxlib::sympd_load_upper(A, A_upper); }
+      }
+    else
+      {
+      podarray<blas_int> ipiv(A.n_rows);
+      
+      arma_extra_debug_print("lapack::dsgesv()");
+      lapack::dsgesv(&n, &nrhs, A.memptr(), &n, ipiv.memptr(), B.memptr(), &n, X.memptr(), &n, work.memptr(), swork.memptr(), &iter, &info);
+      }
+    
+    // NOTE: iter < 0 indicates that the refinement did not converge and that the decomposition was redone in double precision
+    
+    if(info != 0)  { return false; }
+    
+    out.steal_mem(X);
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_ignore(sympd);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! solve a system of linear equations via decomposition in single precision, followed by iterative refinement in double precision (complex matrices);
+//! the decomposition is redone in double precision if the refinement does not converge.
+//! if sympd is true, Cholesky decomposition is used and only the upper triangle of A is used; if the decomposition fails, A is restored from a saved copy and false is returned
+template<typename T1>
+inline
+bool
+auxlib::solve_mixed(Mat< std::complex<typename T1::pod_type> >& out, Mat< std::complex<typename T1::pod_type> >& A, const Base<std::complex<typename T1::pod_type>,T1>& B_expr, const bool sympd)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_CRIPPLED_LAPACK)
+    {
+    return (sympd) ? auxlib::solve_sympd_fast(out, A, B_expr) : auxlib::solve_square_fast(out, A, B_expr);
+    }
+  #elif defined(ARMA_USE_LAPACK)
+    {
+    typedef typename T1::pod_type     T;
+    typedef typename std::complex<T> eT;
+    
+    if(is_double<T>::value == false)
+      {
+      // no lower precision available
+      
+      return (sympd) ? auxlib::solve_sympd_fast(out, A, B_expr) : auxlib::solve_square_fast(out, A, B_expr);
+      }
+    
+    Mat<eT> B = B_expr.get_ref();  // out is not touched if the decomposition fails
+    
+    arma_debug_check( (A.n_rows != B.n_rows), "solve(): number of rows in the given matrices must be the same" );
+    
+    if(A.is_empty() || B.is_empty())
+      {
+      out.zeros(A.n_rows, B.n_cols);
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(A,B);
+    
+    Mat<eT> X(A.n_rows, B.n_cols);
+    
+    podarray<eT>                     work( A.n_rows * B.n_cols );
+    podarray< std::complex<float> > swork( A.n_rows * (A.n_rows + B.n_cols) );
+    podarray<T>                     rwork( A.n_rows );
+    
+    blas_int n    = blas_int(A.n_rows);
+    blas_int nrhs = blas_int(B.n_cols);
+    blas_int iter = blas_int(0);
+    blas_int info = blas_int(0);
+    
+    if(sympd)
+      {
+      podarray<eT> A_upper;
+      
+      auxlib::sympd_save_upper(A_upper, A);
+      
+      char uplo = 'U';
+      
+      arma_extra_debug_print("lapack::zcposv()");
+      lapack::zcposv(&uplo, &n, &nrhs, A.memptr(), &n, B.memptr(), &n, X.memptr(), &n, work.memptr(), swork.memptr(), rwork.memptr(), &iter, &info);
+      
+      if(info > 0)  { auxlib::sympd_load_upper(A, A_upper); }
+      }
+    else
+      {
+      podarray<blas_int> ipiv(A.n_rows);
+      
+      arma_extra_debug_print("lapack::zcgesv()");
+      lapack::zcgesv(&n, &nrhs, A.memptr(), &n, ipiv.memptr(), B.memptr(), &n, X.memptr(), &n, work.memptr(), swork.memptr(), rwork.memptr(), &iter, &info);
+      }
+    
+    // NOTE: iter < 0 indicates that the refinement did not converge and that the decomposition was redone in double precision
+    
+    if(info != 0)  { return false; }
+    
+    out.steal_mem(X);
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(out);
+    arma_ignore(A);
+    arma_ignore(B_expr);
+    arma_ignore(sympd);
+    arma_stop_logic_error("solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! save the upper triangle of A (including the diagonal) in packed column-major order,
+//! as this is the part of A overwritten by a Cholesky decomposition with uplo = 'U'
+template<typename eT>
+inline
+void
+auxlib::sympd_save_upper(podarray<eT>& A_upper, const Mat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  A_upper.set_size( (N*(N+1))/2 );
+  
+  eT* A_upper_mem = A_upper.memptr();
+  
+  for(uword col=0; col < N; ++col)
+    {
+    arrayops::copy(A_upper_mem, A.colptr(col), col+1);
+    
+    A_upper_mem += (col+1);
+    }
+  }
+
+
+
+//! restore the upper triangle of A from a copy made by sympd_save_upper();
+//! the strictly lower triangle is not used, so A does not need to be symmetric
+template<typename eT>
+inline
+void
+auxlib::sympd_load_upper(Mat<eT>& A, const podarray<eT>& A_upper)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = A.n_rows;
+  
+  const eT* A_upper_mem = A_upper.memptr();
+  
+  for(uword col=0; col < N; ++col)
+    {
+    arrayops::copy(A.colptr(col), A_upper_mem, col+1);
+    
+    A_upper_mem += (col+1);
+    }
+  }
+
+
+
 //! solve a non-square full-rank system via QR or LQ decomposition
 template<typename T1>
 inline
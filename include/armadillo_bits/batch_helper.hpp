@@ -0,0 +1,474 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup batch_helper
+//! @{
+
+
+namespace batch_helper
+{
+
+
+
+// slice-wise operations on cubes, where each slice is treated as a separate matrix.
+// slices with size <= 4x4 are handled by unrolled kernels; larger slices are handed to LAPACK/BLAS.
+// when OpenMP is enabled, the slices are split across threads.
+
+
+
+template<typename eT>
+inline
+bool
+use_mp(const uword n_slices, const uword n_elem)
+  {
+  #if defined(ARMA_USE_OPENMP)
+    {
+    return ( (n_slices >= 2) && (mp_thread_limit::get() >= 2) && mp_gate<eT>::eval(n_elem) );
+    }
+  #else
+    {
+    arma_ignore(n_slices);
+    arma_ignore(n_elem);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! Cholesky decomposition of a tiny matrix, done in-place;
+//! layout 0: X = R'*R, using only the upper triangle of X;
+//! layout 1: X = L*L', using only the lower triangle of X
+template<uword N, typename eT>
+arma_hot
+inline
+bool
+chol_tinymat(eT* X, const uword layout)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  // work on a local copy, with every loop bounded by N, so that the compiler can see all accesses are within the matrix
+  eT A[N*N];
+  
+  arrayops::copy(A, X, N*N);
+  
+  if(layout == 0)
+    {
+    for(uword j=0; j < N; ++j)
+      {
+      T d = access::tmp_real(A[j + j*N]);
+      
+      for(uword k=0; k < N; ++k)  { if(k == j)  { break; }  const T a = std::abs(A[k + j*N]); d -= a*a; }
+      
+      if( (d > T(0)) == false )  { return false; }
+      
+      const T R_jj = std::sqrt(d);
+      
+      A[j + j*N] = eT(R_jj);
+      
+      for(uword i=(j+1); i < N; ++i)
+        {
+        eT acc = A[j + i*N];
+        
+        for(uword k=0; k < N; ++k)  { if(k == j)  { break; }  acc -= access::alt_conj(A[k + j*N]) * A[k + i*N]; }
+        
+        A[j + i*N] = acc / R_jj;
+        }
+      }
+    
+    for(uword j=0; j < N; ++j)
+    for(uword i=(j+1); i < N; ++i)
+      {
+      A[i + j*N] = eT(0);
+      }
+    }
+  else
+    {
+    for(uword j=0; j < N; ++j)
+      {
+      T d = access::tmp_real(A[j + j*N]);
+      
+      for(uword k=0; k < N; ++k)  { if(k == j)  { break; }  const T a = std::abs(A[j + k*N]); d -= a*a; }
+      
+      if( (d > T(0)) == false )  { return false; }
+      
+      const T L_jj = std::sqrt(d);
+      
+      A[j + j*N] = eT(L_jj);
+      
+      for(uword i=(j+1); i < N; ++i)
+        {
+        eT acc = A[i + j*N];
+        
+        for(uword k=0; k < N; ++k)  { if(k == j)  { break; }  acc -= A[i + k*N] * access::alt_conj(A[j + k*N]); }
+        
+        A[i + j*N] = acc / L_jj;
+        }
+      }
+    
+    for(uword j=1; j < N; ++j)
+    for(uword i=0; i < j; ++i)
+      {
+      A[i + j*N] = eT(0);
+      }
+    }
+  
+  arrayops::copy(X, A, N*N);
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+chol_slice(eT* X_mem, const uword N, const uword layout)
+  {
+  switch(N)
+    {
+    case 1:  return chol_tinymat<1>(X_mem, layout);
+    case 2:  return chol_tinymat<2>(X_mem, layout);
+    case 3:  return chol_tinymat<3>(X_mem, layout);
+    case 4:  return chol_tinymat<4>(X_mem, layout);
+    
+    default:
+      {
+      Mat<eT> X(X_mem, N, N, false, true);
+      
+      return auxlib::chol(X, layout);
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+inv_slice(eT* out_mem, const eT* X_mem, const uword N)
+  {
+        Mat<eT> out(out_mem,                N, N, false, true);
+  const Mat<eT> X  (const_cast<eT*>(X_mem), N, N, false, true);
+  
+  if(N <= 4)
+    {
+    if(auxlib::inv_noalias_tinymat(out, X, N))  { return true; }
+    }
+  
+  arrayops::copy(out_mem, X_mem, N*N);
+  
+  return auxlib::inv_inplace_lapack(out);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+det_slice(const eT* X_mem, const uword N)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  const Mat<eT> X(const_cast<eT*>(X_mem), N, N, false, true);
+  
+  if(N <= 4)
+    {
+    const eT det_val = auxlib::det_tinymat(X, N);
+    
+    if(std::abs(det_val) >= std::numeric_limits<T>::epsilon())  { return det_val; }
+    }
+  
+  return auxlib::det_lapack(X, true);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve_slice(eT* out_mem, const eT* A_mem, const eT* B_mem, const uword N, const uword B_n_cols)
+  {
+        Mat<eT> out(out_mem,                N, B_n_cols, false, true);
+  const Mat<eT> B  (const_cast<eT*>(B_mem), N, B_n_cols, false, true);
+  
+  if(N <= 4)
+    {
+    const Mat<eT> A(const_cast<eT*>(A_mem), N, N, false, true);
+    
+    Mat<eT> A_inv(N, N);
+    
+    if(auxlib::inv_noalias_tinymat(A_inv, A, N))
+      {
+      gemm<false,false,false,false>::apply(out, A_inv, B);
+      
+      return true;
+      }
+    }
+  
+  Mat<eT> A(A_mem, N, N);
+  Mat<eT> tmp;
+  
+  const bool status = auxlib::solve_square_fast(tmp, A, B);
+  
+  if(status)  { arrayops::copy(out_mem, tmp.memptr(), tmp.n_elem); }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+inv(Cube<eT>& out, const Cube<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (X.n_rows != X.n_cols), "inv(): given cube must have square sized slices" );
+  
+  out.set_size(X.n_rows, X.n_cols, X.n_slices);
+  
+  if(out.is_empty())  { return true; }
+  
+  const uword N        = X.n_rows;
+  const uword n_slices = X.n_slices;
+  
+  uword n_fail = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(use_mp<eT>(n_slices, X.n_elem))
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads) reduction(+:n_fail)
+      for(uword s=0; s < n_slices; ++s)
+        {
+        if(inv_slice(out.slice_memptr(s), X.slice_memptr(s), N) == false)  { ++n_fail; }
+        }
+      
+      return (n_fail == 0);
+      }
+    }
+  #endif
+  
+  for(uword s=0; s < n_slices; ++s)
+    {
+    if(inv_slice(out.slice_memptr(s), X.slice_memptr(s), N) == false)  { ++n_fail; break; }
+    }
+  
+  return (n_fail == 0);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+chol(Cube<eT>& X, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (X.n_rows != X.n_cols), "chol(): given cube must have square sized slices" );
+  
+  if(X.is_empty())  { return true; }
+  
+  const uword N        = X.n_rows;
+  const uword n_slices = X.n_slices;
+  
+  uword n_fail = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(use_mp<eT>(n_slices, X.n_elem))
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads) reduction(+:n_fail)
+      for(uword s=0; s < n_slices; ++s)
+        {
+        if(chol_slice(X.slice_memptr(s), N, layout) == false)  { ++n_fail; }
+        }
+      
+      return (n_fail == 0);
+      }
+    }
+  #endif
+  
+  for(uword s=0; s < n_slices; ++s)
+    {
+    if(chol_slice(X.slice_memptr(s), N, layout) == false)  { ++n_fail; break; }
+    }
+  
+  return (n_fail == 0);
+  }
+
+
+
+template<typename eT>
+inline
+void
+det(Col<eT>& out, const Cube<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (X.n_rows != X.n_cols), "det(): given cube must have square sized slices" );
+  
+  const uword N        = X.n_rows;
+  const uword n_slices = X.n_slices;
+  
+  out.set_size(n_slices);
+  
+  eT* out_mem = out.memptr();
+  
+  if(N == 0)  { out.ones(); return; }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(use_mp<eT>(n_slices, X.n_elem))
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword s=0; s < n_slices; ++s)
+        {
+        out_mem[s] = det_slice(X.slice_memptr(s), N);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword s=0; s < n_slices; ++s)
+    {
+    out_mem[s] = det_slice(X.slice_memptr(s), N);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "solve(): given cube must have square sized slices" );
+  
+  arma_debug_check( ((A.n_rows != B.n_rows) || (A.n_slices != B.n_slices)), "solve(): number of rows and slices in the given cubes must be the same" );
+  
+  out.set_size(A.n_cols, B.n_cols, B.n_slices);
+  
+  if(out.is_empty())  { return true; }
+  
+  if(A.is_empty())  { out.zeros(); return true; }
+  
+  const uword N        = A.n_rows;
+  const uword B_n_cols = B.n_cols;
+  const uword n_slices = A.n_slices;
+  
+  uword n_fail = 0;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(use_mp<eT>(n_slices, A.n_elem + B.n_elem))
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads) reduction(+:n_fail)
+      for(uword s=0; s < n_slices; ++s)
+        {
+        if(solve_slice(out.slice_memptr(s), A.slice_memptr(s), B.slice_memptr(s), N, B_n_cols) == false)  { ++n_fail; }
+        }
+      
+      return (n_fail == 0);
+      }
+    }
+  #endif
+  
+  for(uword s=0; s < n_slices; ++s)
+    {
+    if(solve_slice(out.slice_memptr(s), A.slice_memptr(s), B.slice_memptr(s), N, B_n_cols) == false)  { ++n_fail; break; }
+    }
+  
+  return (n_fail == 0);
+  }
+
+
+
+template<typename eT>
+inline
+void
+times(Cube<eT>& out, const Cube<eT>& A, const Cube<eT>& B)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (A.n_cols != B.n_rows), "mul_slices(): incompatible slice dimensions" );
+  
+  arma_debug_check( (A.n_slices != B.n_slices), "mul_slices(): number of slices in the given cubes must be the same" );
+  
+  out.set_size(A.n_rows, B.n_cols, A.n_slices);
+  
+  if(out.is_empty())  { return; }
+  
+  if(A.n_cols == 0)  { out.zeros(); return; }
+  
+  const uword A_n_rows = A.n_rows;
+  const uword A_n_cols = A.n_cols;
+  const uword B_n_cols = B.n_cols;
+  const uword n_slices = A.n_slices;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if(use_mp<eT>(n_slices, out.n_elem * A_n_cols))
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword s=0; s < n_slices; ++s)
+        {
+              Mat<eT> C_s(out.slice_memptr(s),                     A_n_rows, B_n_cols, false, true);
+        const Mat<eT> A_s(const_cast<eT*>(A.slice_memptr(s)), A_n_rows, A_n_cols, false, true);
+        const Mat<eT> B_s(const_cast<eT*>(B.slice_memptr(s)), A_n_cols, B_n_cols, false, true);
+        
+        gemm<false,false,false,false>::apply(C_s, A_s, B_s);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword s=0; s < n_slices; ++s)
+    {
+          Mat<eT> C_s(out.slice_memptr(s),                     A_n_rows, B_n_cols, false, true);
+    const Mat<eT> A_s(const_cast<eT*>(A.slice_memptr(s)), A_n_rows, A_n_cols, false, true);
+    const Mat<eT> B_s(const_cast<eT*>(B.slice_memptr(s)), A_n_cols, B_n_cols, false, true);
+    
+    gemm<false,false,false,false>::apply(C_s, A_s, B_s);
+    }
+  }
+
+
+
+}  // end of namespace batch_helper
+
+
+//! @}
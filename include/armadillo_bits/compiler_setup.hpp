@@ -123,6 +123,14 @@
 #endif
 
 
+// mmap() is part of IEEE standard 1003.1 for systems which define _POSIX_MAPPED_FILES in unistd.h
+// http://pubs.opengroup.org/onlinepubs/9699919799/functions/mmap.html
+#if ( defined(_POSIX_MAPPED_FILES) && (_POSIX_MAPPED_FILES > 0) )
+  #undef  ARMA_HAVE_MMAP
+  #define ARMA_HAVE_MMAP
+#endif
+
+
 #if defined(__APPLE__) || defined(__apple_build_version__)
   #undef  ARMA_BLAS_SDOT_BUG
   #define ARMA_BLAS_SDOT_BUG
@@ -137,6 +145,7 @@
 
 #if defined(__MINGW32__) || defined(__CYGWIN__) || defined(_MSC_VER)
   #undef ARMA_HAVE_POSIX_MEMALIGN
+  #undef ARMA_HAVE_MMAP
 #endif
 
 
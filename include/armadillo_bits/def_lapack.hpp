@@ -193,6 +193,63 @@
   #define arma_slarnv slarnv
   #define arma_dlarnv dlarnv
   
+  #define arma_spotrs spotrs
+  #define arma_dpotrs dpotrs
+  #define arma_cpotrs cpotrs
+  #define arma_zpotrs zpotrs
+  
+  #define arma_spocon spocon
+  #define arma_dpocon dpocon
+  #define arma_cpocon cpocon
+  #define arma_zpocon zpocon
+  
+  #define arma_ssycon ssycon
+  #define arma_dsycon dsycon
+  
+  #define arma_chetrf chetrf
+  #define arma_zhetrf zhetrf
+  
+  #define arma_chetrs chetrs
+  #define arma_zhetrs zhetrs
+  
+  #define arma_checon checon
+  #define arma_zhecon zhecon
+  
+  #define arma_strcon strcon
+  #define arma_dtrcon dtrcon
+  #define arma_ctrcon ctrcon
+  #define arma_ztrcon ztrcon
+  
+  #define arma_sgbtrf sgbtrf
+  #define arma_dgbtrf dgbtrf
+  #define arma_cgbtrf cgbtrf
+  #define arma_zgbtrf zgbtrf
+  
+  #define arma_sgbtrs sgbtrs
+  #define arma_dgbtrs dgbtrs
+  #define arma_cgbtrs cgbtrs
+  #define arma_zgbtrs zgbtrs
+  
+  #define arma_sgbcon sgbcon
+  #define arma_dgbcon dgbcon
+  #define arma_cgbcon cgbcon
+  #define arma_zgbcon zgbcon
+  
+  #define arma_sposv sposv
+  #define arma_dposv dposv
+  #define arma_cposv cposv
+  #define arma_zposv zposv
+  
+  #define arma_sposvx sposvx
+  #define arma_dposvx dposvx
+  #define arma_cposvx cposvx
+  #define arma_zposvx zposvx
+  
+  #define arma_dsgesv dsgesv
+  #define arma_zcgesv zcgesv
+  #define arma_dsposv dsposv
+  #define arma_zcposv zcposv
+  
 #else
   
   #define arma_sgetrf SGETRF
@@ -364,6 +421,63 @@
   #define arma_slarnv SLARNV
   #define arma_dlarnv DLARNV
   
+  #define arma_spotrs SPOTRS
+  #define arma_dpotrs DPOTRS
+  #define arma_cpotrs CPOTRS
+  #define arma_zpotrs ZPOTRS
+  
+  #define arma_spocon SPOCON
+  #define arma_dpocon DPOCON
+  #define arma_cpocon CPOCON
+  #define arma_zpocon ZPOCON
+  
+  #define arma_ssycon SSYCON
+  #define arma_dsycon DSYCON
+  
+  #define arma_chetrf CHETRF
+  #define arma_zhetrf ZHETRF
+  
+  #define arma_chetrs CHETRS
+  #define arma_zhetrs ZHETRS
+  
+  #define arma_checon CHECON
+  #define arma_zhecon ZHECON
+  
+  #define arma_strcon STRCON
+  #define arma_dtrcon DTRCON
+  #define arma_ctrcon CTRCON
+  #define arma_ztrcon ZTRCON
+  
+  #define arma_sgbtrf SGBTRF
+  #define arma_dgbtrf DGBTRF
+  #define arma_cgbtrf CGBTRF
+  #define arma_zgbtrf ZGBTRF
+  
+  #define arma_sgbtrs SGBTRS
+  #define arma_dgbtrs DGBTRS
+  #define arma_cgbtrs CGBTRS
+  #define arma_zgbtrs ZGBTRS
+  
+  #define arma_sgbcon SGBCON
+  #define arma_dgbcon DGBCON
+  #define arma_cgbcon CGBCON
+  #define arma_zgbcon ZGBCON
+  
+  #define arma_sposv SPOSV
+  #define arma_dposv DPOSV
+  #define arma_cposv CPOSV
+  #define arma_zposv ZPOSV
+  
+  #define arma_sposvx SPOSVX
+  #define arma_dposvx DPOSVX
+  #define arma_cposvx CPOSVX
+  #define arma_zposvx ZPOSVX
+  
+  #define arma_dsgesv DSGESV
+  #define arma_zcgesv ZCGESV
+  #define arma_dsposv DSPOSV
+  #define arma_zcposv ZCPOSV
+  
 #endif
 
 
@@ -592,6 +706,90 @@ extern "C"
   // generate a vector of random numbers
   void arma_fortran(arma_slarnv)(blas_int* idist, blas_int* iseed, blas_int* n, float*  x);
   void arma_fortran(arma_dlarnv)(blas_int* idist, blas_int* iseed, blas_int* n, double* x);
+  
+  // solve linear equations using Cholesky decomposition
+  void arma_fortran(arma_spotrs)(char* uplo, blas_int* n, blas_int* nrhs,  float* a, blas_int* lda,  float* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dpotrs)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cpotrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zpotrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info);
+  
+  // reciprocal of condition number using Cholesky decomposition (real)
+  void arma_fortran(arma_spocon)(char* uplo, blas_int* n,  float* a, blas_int* lda,  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dpocon)(char* uplo, blas_int* n, double* a, blas_int* lda, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // reciprocal of condition number using Cholesky decomposition (complex)
+  void arma_fortran(arma_cpocon)(char* uplo, blas_int* n,   void* a, blas_int* lda,  float* anorm,  float* rcond,   void* work,  float* rwork, blas_int* info);
+  void arma_fortran(arma_zpocon)(char* uplo, blas_int* n,   void* a, blas_int* lda, double* anorm, double* rcond,   void* work, double* rwork, blas_int* info);
+  
+  // reciprocal of condition number using LDL decomposition (real symmetric)
+  void arma_fortran(arma_ssycon)(char* uplo, blas_int* n,  float* a, blas_int* lda, blas_int* ipiv,  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dsycon)(char* uplo, blas_int* n, double* a, blas_int* lda, blas_int* ipiv, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // LDL decomposition (complex hermitian)
+  void arma_fortran(arma_chetrf)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv,   void* work, blas_int* lwork, blas_int* info);
+  void arma_fortran(arma_zhetrf)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv,   void* work, blas_int* lwork, blas_int* info);
+  
+  // solve linear equations using LDL decomposition (complex hermitian)
+  void arma_fortran(arma_chetrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zhetrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info);
+  
+  // reciprocal of condition number using LDL decomposition (complex hermitian)
+  void arma_fortran(arma_checon)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv,  float* anorm,  float* rcond,   void* work, blas_int* info);
+  void arma_fortran(arma_zhecon)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv, double* anorm, double* rcond,   void* work, blas_int* info);
+  
+  // reciprocal of condition number of triangular matrix (real)
+  void arma_fortran(arma_strcon)(char* norm, char* uplo, char* diag, blas_int* n,  float* a, blas_int* lda,  float* rcond,  float* work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dtrcon)(char* norm, char* uplo, char* diag, blas_int* n, double* a, blas_int* lda, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // reciprocal of condition number of triangular matrix (complex)
+  void arma_fortran(arma_ctrcon)(char* norm, char* uplo, char* diag, blas_int* n,   void* a, blas_int* lda,  float* rcond,   void* work,  float* rwork, blas_int* info);
+  void arma_fortran(arma_ztrcon)(char* norm, char* uplo, char* diag, blas_int* n,   void* a, blas_int* lda, double* rcond,   void* work, double* rwork, blas_int* info);
+  
+  // LU factorisation of band matrix
+  void arma_fortran(arma_sgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku,  float* ab, blas_int* ldab, blas_int* ipiv, blas_int* info);
+  void arma_fortran(arma_dgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku, double* ab, blas_int* ldab, blas_int* ipiv, blas_int* info);
+  void arma_fortran(arma_cgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv, blas_int* info);
+  void arma_fortran(arma_zgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv, blas_int* info);
+  
+  // solve linear equations using LU factorisation of band matrix
+  void arma_fortran(arma_sgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs,  float* ab, blas_int* ldab, blas_int* ipiv,  float* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, double* ab, blas_int* ldab, blas_int* ipiv, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs,   void* ab, blas_int* ldab, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs,   void* ab, blas_int* ldab, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info);
+  
+  // reciprocal of condition number using LU factorisation of band matrix (real)
+  void arma_fortran(arma_sgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku,  float* ab, blas_int* ldab, blas_int* ipiv,  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, double* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info);
+  
+  // reciprocal of condition number using LU factorisation of band matrix (complex)
+  void arma_fortran(arma_cgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv,  float* anorm,  float* rcond,   void* work,  float* rwork, blas_int* info);
+  void arma_fortran(arma_zgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond,   void* work, double* rwork, blas_int* info);
+  
+  // solve linear equations using Cholesky decomposition
+  void arma_fortran(arma_sposv)(char* uplo, blas_int* n, blas_int* nrhs,  float* a, blas_int* lda,  float* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_dposv)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_cposv)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info);
+  void arma_fortran(arma_zposv)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info);
+  
+  // solve linear equations using Cholesky decomposition with refinement (real)
+  void arma_fortran(arma_sposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs,  float* a, blas_int* lda,  float* af, blas_int* ldaf, char* equed,  float* s,  float* b, blas_int* ldb,  float* x, blas_int* ldx,  float* rcond,  float* ferr,  float* berr,  float* work, blas_int* iwork, blas_int* info);
+  void arma_fortran(arma_dposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* af, blas_int* ldaf, char* equed, double* s, double* b, blas_int* ldb, double* x, blas_int* ldx, double* rcond, double* ferr, double* berr, double* work, blas_int* iwork, blas_int* info);
+  
+  // solve linear equations using Cholesky decomposition with refinement (complex)
+  void arma_fortran(arma_cposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* af, blas_int* ldaf, char* equed,  float* s,   void* b, blas_int* ldb,   void* x, blas_int* ldx,  float* rcond,  float* ferr,  float* berr,   void* work,  float* rwork, blas_int* info);
+  void arma_fortran(arma_zposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* af, blas_int* ldaf, char* equed, double* s,   void* b, blas_int* ldb,   void* x, blas_int* ldx, double* rcond, double* ferr, double* berr,   void* work, double* rwork, blas_int* info);
+  
+  // solve linear equations using LU decomposition in single precision with iterative refinement in double precision (real)
+  void arma_fortran(arma_dsgesv)(blas_int* n, blas_int* nrhs, double* a, blas_int* lda, blas_int* ipiv, double* b, blas_int* ldb, double* x, blas_int* ldx, double* work,  float* swork, blas_int* iter, blas_int* info);
+  
+  // solve linear equations using LU decomposition in single precision with iterative refinement in double precision (complex)
+  void arma_fortran(arma_zcgesv)(blas_int* n, blas_int* nrhs,   void* a, blas_int* lda, blas_int* ipiv,   void* b, blas_int* ldb,   void* x, blas_int* ldx,   void* work,   void* swork, double* rwork, blas_int* iter, blas_int* info);
+  
+  // solve linear equations using Cholesky decomposition in single precision with iterative refinement in double precision (real)
+  void arma_fortran(arma_dsposv)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, double* x, blas_int* ldx, double* work,  float* swork, blas_int* iter, blas_int* info);
+  
+  // solve linear equations using Cholesky decomposition in single precision with iterative refinement in double precision (complex)
+  void arma_fortran(arma_zcposv)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb,   void* x, blas_int* ldx,   void* work,   void* swork, double* rwork, blas_int* iter, blas_int* info);
   }
 
 
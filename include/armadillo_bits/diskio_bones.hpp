@@ -101,6 +101,12 @@ class diskio
   template<typename  T> inline static bool save_coord_ascii(const SpMat< std::complex<T> >& x, std::ostream& f);
   template<typename eT> inline static bool save_arma_binary(const SpMat<eT>& x,                std::ostream& f);
   
+  template<typename eT> inline static bool save_mm_ascii   (const SpMat<eT>& x, const std::string& final_name);
+  template<typename eT> inline static bool save_csc_binary (const SpMat<eT>& x, const std::string& final_name);
+  
+  template<typename eT> inline static bool save_mm_ascii   (const SpMat<eT>& x, std::ostream& f);
+  template<typename eT> inline static bool save_csc_binary (const SpMat<eT>& x, std::ostream& f);
+  
   
   //
   // sparse matrix loading
@@ -112,6 +118,36 @@ class diskio
   template<typename  T> inline static bool load_coord_ascii(SpMat< std::complex<T> >& x, std::istream& f, std::string& err_msg);
   template<typename eT> inline static bool load_arma_binary(SpMat<eT>& x,                std::istream& f, std::string& err_msg);
   
+  template<typename eT> inline static bool load_mm_ascii   (SpMat<eT>& x, const std::string& name, std::string& err_msg);
+  template<typename eT> inline static bool load_csc_binary (SpMat<eT>& x, const std::string& name, std::string& err_msg);
+  
+  template<typename eT> inline static bool load_mm_ascii   (SpMat<eT>& x, std::istream& f, std::string& err_msg);
+  template<typename eT> inline static bool load_csc_binary (SpMat<eT>& x, std::istream& f, std::string& err_msg);
+  
+  
+  //
+  // helpers for sparse matrix formats
+  
+  template<typename eT> inline static const char* mm_field_name(const SpMat<eT>& x);
+  
+  template<typename eT> inline static void mm_write_val(std::ostream& f, const eT&              val);
+  template<typename  T> inline static void mm_write_val(std::ostream& f, const std::complex<T>& val);
+  
+  template<typename eT> inline static bool mm_parse_val(eT&              val, const char*& p, const char* eol, const uword field);
+  template<typename  T> inline static bool mm_parse_val(std::complex<T>& val, const char*& p, const char* eol, const uword field);
+  
+  inline static bool  mm_parse_uword(uword& val, const char*& p, const char* eol);
+  inline static uword mm_count_lines(const char* p, const char* end);
+  
+  template<typename eT> inline static void gen_csc_header (char* header, const SpMat<eT>& x);
+  template<typename eT> inline static bool parse_csc_header(const char* header, const SpMat<eT>& x, uword& n_rows, uword& n_cols, uword& n_nonzero);
+  
+  inline static void csc_offsets(const uword n_cols, const uword n_nonzero, const uword elem_size, uword& col_ptrs_offset, uword& row_indices_offset, uword& values_offset, uword& file_size);
+  
+  inline static bool check_csc_size(const uword n_cols, const uword n_nonzero, const uword elem_size, const uword avail_size);
+  
+  template<typename eT> inline static bool check_csc(const uword n_rows, const uword n_cols, const uword n_nonzero, const uword* col_ptrs, const uword* row_indices, const eT* values);
+  
   
   
   //
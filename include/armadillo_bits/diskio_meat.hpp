@@ -3053,6 +3053,801 @@ diskio::load_arma_binary(SpMat<eT>& x, std::istream& f, std::string& err_msg)
 
 
 
+//! Save a matrix in Matrix Market coordinate format
+template<typename eT>
+inline
+bool
+diskio::save_mm_ascii(const SpMat<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str());
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay)
+    {
+    save_okay = diskio::save_mm_ascii(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay)  { save_okay = diskio::safe_rename(tmp_name, final_name); }
+    }
+  
+  return save_okay;
+  }
+
+
+
+//! Save a matrix in Matrix Market coordinate format;
+//! indices start at 1 and the elements are written in column-major order
+template<typename eT>
+inline
+bool
+diskio::save_mm_ascii(const SpMat<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const ios::fmtflags orig_flags = f.flags();
+  
+  if( (is_float<T>::value) || (is_double<T>::value) )
+    {
+    f.unsetf(ios::fixed);
+    f.setf(ios::scientific);
+    f.precision(14);
+    }
+  
+  f << "%%MatrixMarket matrix coordinate " << diskio::mm_field_name(x) << " general\n";
+  f << x.n_rows << ' ' << x.n_cols << ' ' << x.n_nonzero << '\n';
+  
+  for(uword c=0; c < x.n_cols; ++c)
+    {
+    const uword p_end = x.col_ptrs[c+1];
+    
+    for(uword p = x.col_ptrs[c]; p < p_end; ++p)
+      {
+      f << (x.row_indices[p] + 1) << ' ' << (c + 1) << ' ';
+      
+      diskio::mm_write_val(f, x.values[p]);
+      
+      f << '\n';
+      }
+    }
+  
+  const bool save_okay = f.good();
+  
+  f.flags(orig_flags);
+  
+  return save_okay;
+  }
+
+
+
+//! Save a matrix in binary CSC format;
+//! the arrays are stored at aligned offsets, so that the file can be memory mapped via sp_mmap
+template<typename eT>
+inline
+bool
+diskio::save_csc_binary(const SpMat<eT>& x, const std::string& final_name)
+  {
+  arma_extra_debug_sigprint();
+  
+  const std::string tmp_name = diskio::gen_tmp_name(final_name);
+  
+  std::ofstream f(tmp_name.c_str(), std::fstream::binary);
+  
+  bool save_okay = f.is_open();
+  
+  if(save_okay)
+    {
+    save_okay = diskio::save_csc_binary(x, f);
+    
+    f.flush();
+    f.close();
+    
+    if(save_okay)  { save_okay = diskio::safe_rename(tmp_name, final_name); }
+    }
+  
+  return save_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::save_csc_binary(const SpMat<eT>& x, std::ostream& f)
+  {
+  arma_extra_debug_sigprint();
+  
+  uword col_ptrs_offset    = 0;
+  uword row_indices_offset = 0;
+  uword values_offset      = 0;
+  uword file_size          = 0;
+  
+  diskio::csc_offsets(x.n_cols, x.n_nonzero, uword(sizeof(eT)), col_ptrs_offset, row_indices_offset, values_offset, file_size);
+  
+  char header[128];
+  
+  diskio::gen_csc_header(header, x);
+  
+  char padding[64];
+  
+  std::memset(padding, 0, sizeof(padding));
+  
+  const uword col_ptrs_end    = col_ptrs_offset    + (x.n_cols + 1) * uword(sizeof(uword));
+  const uword row_indices_end = row_indices_offset +  x.n_nonzero   * uword(sizeof(uword));
+  
+  f.write( header,                                       std::streamsize(col_ptrs_offset)                      );
+  f.write( reinterpret_cast<const char*>(x.col_ptrs),    std::streamsize((x.n_cols+1)*sizeof(uword))           );
+  f.write( padding,                                      std::streamsize(row_indices_offset - col_ptrs_end)    );
+  f.write( reinterpret_cast<const char*>(x.row_indices), std::streamsize(x.n_nonzero*sizeof(uword))            );
+  f.write( padding,                                      std::streamsize(values_offset      - row_indices_end) );
+  f.write( reinterpret_cast<const char*>(x.values),      std::streamsize(x.n_nonzero*sizeof(eT))               );
+  
+  return f.good();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_mm_ascii(SpMat<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay)
+    {
+    load_okay = diskio::load_mm_ascii(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! Load a matrix in Matrix Market coordinate format.
+//! The data lines are read into memory and split into chunks at line boundaries;
+//! the chunks are parsed in parallel (when OpenMP is enabled) directly into the arrays used by the batch insertion constructor.
+//! For the symmetric, skew-symmetric and hermitian variants, the mirrored elements are added;
+//! elements given more than once are summed.
+template<typename eT>
+inline
+bool
+diskio::load_mm_ascii(SpMat<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::string line_string;
+  
+  std::getline(f, line_string);
+  
+  std::stringstream line_stream(line_string);
+  
+  std::string token[5];
+  
+  for(uword i=0; i < 5; ++i)
+    {
+    line_stream >> token[i];
+    
+    // the header is case insensitive
+    for(size_t j=0; j < token[i].length(); ++j)
+      {
+      const char c = token[i][j];
+      
+      if( (c >= 'A') && (c <= 'Z') )  { token[i][j] = char(c - 'A' + 'a'); }
+      }
+    }
+  
+  if( (token[0] != "%%matrixmarket") || (token[1] != "matrix") )
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  // field:    0 = real or integer, 1 = complex, 2 = pattern
+  // symmetry: 0 = general, 1 = symmetric, 2 = skew-symmetric, 3 = hermitian
+  
+  uword field    = 0;
+  uword symmetry = 0;
+  
+  bool header_okay = (token[2] == "coordinate");
+  
+       if( (token[3] == "real") || (token[3] == "double") || (token[3] == "integer") )  { field = 0; }
+  else if(  token[3] == "complex"                                                    )  { field = 1; }
+  else if(  token[3] == "pattern"                                                    )  { field = 2; }
+  else                                                                                  { header_okay = false; }
+  
+       if(token[4] == "general"       )  { symmetry = 0; }
+  else if(token[4] == "symmetric"     )  { symmetry = 1; }
+  else if(token[4] == "skew-symmetric")  { symmetry = 2; }
+  else if(token[4] == "hermitian"     )  { symmetry = 3; }
+  else                                   { header_okay = false; }
+  
+  if( (header_okay == false) || ((field == 1) && is_cx<eT>::no) )
+    {
+    err_msg = "currently no code available to handle loading ";
+    return false;
+    }
+  
+  // skip comments; the first other line has the number of rows, columns and entries
+  
+  uword f_n_rows    = 0;
+  uword f_n_cols    = 0;
+  uword f_n_entries = 0;
+  
+  bool size_found = false;
+  
+  while(f.good())
+    {
+    std::getline(f, line_string);
+    
+    const std::string::size_type start = line_string.find_first_not_of(" \t\r");
+    
+    if( (start == std::string::npos) || (line_string[start] == '%') )  { continue; }
+    
+    line_stream.clear();
+    line_stream.str(line_string);
+    
+    line_stream >> f_n_rows;
+    line_stream >> f_n_cols;
+    line_stream >> f_n_entries;
+    
+    size_found = (line_stream.fail() == false);
+    
+    break;
+    }
+  
+  if( (size_found == false) || ((symmetry != 0) && (f_n_rows != f_n_cols)) )
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  // read the remaining lines in one go
+  
+  std::string buffer;
+  
+  const std::streampos pos1 = f.tellg();
+  
+  if(pos1 != std::streampos(-1))
+    {
+    f.seekg(0, ios::end);
+    
+    const std::streampos pos2 = f.tellg();
+    
+    if(pos2 > pos1)  { buffer.reserve( size_t(pos2 - pos1) ); }
+    
+    f.clear();
+    f.seekg(pos1);
+    }
+  
+  char block[65536];
+  
+  while(f.good())
+    {
+    f.read(block, std::streamsize(sizeof(block)));
+    
+    buffer.append(block, size_t(f.gcount()));
+    }
+  
+  const char* buf_mem = buffer.c_str();
+  const uword buf_len = uword(buffer.length());
+  
+  uword n_chunks = 1;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword n_threads = uword( mp_thread_limit::get() );
+    
+    if( mp_gate<eT>::eval(f_n_entries) && (n_threads >= 2) )  { n_chunks = n_threads; }
+    }
+  #endif
+  
+  // each chunk starts at the beginning of a line
+  
+  podarray<uword> bounds(n_chunks + 1);
+  
+  bounds[0]        = 0;
+  bounds[n_chunks] = buf_len;
+  
+  for(uword t=1; t < n_chunks; ++t)
+    {
+    const uword start = (std::max)( bounds[t-1], (buf_len / n_chunks) * t );
+    
+    const void* eol = (start < buf_len) ? std::memchr(buf_mem + start, '\n', size_t(buf_len - start)) : NULL;
+    
+    bounds[t] = (eol != NULL) ? uword(static_cast<const char*>(eol) - buf_mem) + 1 : buf_len;
+    }
+  
+  podarray<uword> counts(n_chunks);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_chunks))
+  #endif
+  for(uword t=0; t < n_chunks; ++t)
+    {
+    counts[t] = diskio::mm_count_lines(buf_mem + bounds[t], buf_mem + bounds[t+1]);
+    }
+  
+  podarray<uword> offsets(n_chunks);
+  
+  uword n_lines = 0;
+  
+  for(uword t=0; t < n_chunks; ++t)  { offsets[t] = n_lines;  n_lines += counts[t]; }
+  
+  if(n_lines != f_n_entries)
+    {
+    err_msg = "inconsistent data in ";
+    return false;
+    }
+  
+  // the mirrored elements of symmetric variants are written after the given elements
+  
+  const uword n_alloc = (symmetry != 0) ? (2 * n_lines) : n_lines;
+  
+  Mat<uword> locs(2, n_alloc);
+  Col<eT>    vals(   n_alloc);
+  
+  uword* locs_mem = locs.memptr();
+  eT*    vals_mem = vals.memptr();
+  
+  podarray<uword> n_mirrored(n_chunks);
+  podarray<uword> status(n_chunks);
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_chunks))
+  #endif
+  for(uword t=0; t < n_chunks; ++t)
+    {
+    const char* p   = buf_mem + bounds[t  ];
+    const char* end = buf_mem + bounds[t+1];
+    
+    uword k = offsets[t];
+    uword m = n_lines + offsets[t];
+    
+    bool chunk_okay = true;
+    
+    while( (p < end) && chunk_okay )
+      {
+      const void* eol_ptr = std::memchr(p, '\n', size_t(end - p));
+      
+      const char* eol = (eol_ptr != NULL) ? static_cast<const char*>(eol_ptr) : end;
+      
+      while( (p < eol) && ((*p == ' ') || (*p == '\t') || (*p == '\r')) )  { ++p; }
+      
+      if( (p < eol) && (*p != '%') )
+        {
+        uword row = 0;
+        uword col = 0;
+        eT    val = eT(0);
+        
+        chunk_okay = diskio::mm_parse_uword(row, p, eol) && diskio::mm_parse_uword(col, p, eol) && diskio::mm_parse_val(val, p, eol, field);
+        
+        chunk_okay = chunk_okay && (row >= 1) && (row <= f_n_rows) && (col >= 1) && (col <= f_n_cols);
+        
+        if(chunk_okay)
+          {
+          locs_mem[2*k    ] = row - 1;
+          locs_mem[2*k + 1] = col - 1;
+          vals_mem[k]       = val;
+          ++k;
+          
+          if( (symmetry != 0) && (row != col) )
+            {
+            locs_mem[2*m    ] = col - 1;
+            locs_mem[2*m + 1] = row - 1;
+            vals_mem[m]       = (symmetry == 1) ? val : ( (symmetry == 2) ? eT(-val) : access::alt_conj(val) );
+            ++m;
+            }
+          }
+        }
+      
+      p = eol + 1;
+      }
+    
+    n_mirrored[t] = m - (n_lines + offsets[t]);
+    status[t]     = chunk_okay ? uword(0) : uword(1);
+    }
+  
+  for(uword t=0; t < n_chunks; ++t)
+    {
+    if(status[t] != 0)
+      {
+      err_msg = "couldn't interpret data in ";
+      return false;
+      }
+    }
+  
+  // gather the mirrored elements of all chunks into one contiguous block
+  
+  uword n_total = n_lines;
+  
+  for(uword t=0; t < n_chunks; ++t)
+    {
+    const uword src = n_lines + offsets[t];
+    
+    for(uword i=0; i < n_mirrored[t]; ++i)
+      {
+      locs_mem[2*(n_total+i)    ] = locs_mem[2*(src+i)    ];
+      locs_mem[2*(n_total+i) + 1] = locs_mem[2*(src+i) + 1];
+      vals_mem[n_total+i]         = vals_mem[src+i];
+      }
+    
+    n_total += n_mirrored[t];
+    }
+  
+  const Mat<uword> locs_used(locs_mem, 2, n_total, false, true);
+  const Col<eT>    vals_used(vals_mem,    n_total, false, true);
+  
+  SpMat<eT> tmp(true, locs_used, vals_used, f_n_rows, f_n_cols, true, true);
+  
+  x.steal_mem(tmp);
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_csc_binary(SpMat<eT>& x, const std::string& name, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  std::ifstream f;
+  f.open(name.c_str(), std::fstream::binary);
+  
+  bool load_okay = f.is_open();
+  
+  if(load_okay)
+    {
+    load_okay = diskio::load_csc_binary(x, f, err_msg);
+    f.close();
+    }
+  
+  return load_okay;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::load_csc_binary(SpMat<eT>& x, std::istream& f, std::string& err_msg)
+  {
+  arma_extra_debug_sigprint();
+  
+  // the number of available bytes is used to reject headers with sizes that can't be present in the stream,
+  // before any memory is allocated
+  
+  f.clear();
+  const std::fstream::pos_type pos1 = f.tellg();
+  
+  f.clear();
+  f.seekg(0, ios::end);
+  
+  f.clear();
+  const std::fstream::pos_type pos2 = f.tellg();
+  
+  const uword N_avail = ( (pos1 >= 0) && (pos2 >= 0) && (pos2 > pos1) ) ? uword(pos2 - pos1) : uword(0);
+  
+  f.clear();
+  f.seekg(pos1);
+  
+  char header[128];
+  
+  f.read(header, std::streamsize(sizeof(header)));
+  
+  uword f_n_rows = 0;
+  uword f_n_cols = 0;
+  uword f_n_nz   = 0;
+  
+  if( (f.good() == false) || (diskio::parse_csc_header(header, x, f_n_rows, f_n_cols, f_n_nz) == false) )
+    {
+    err_msg = "incorrect header in ";
+    return false;
+    }
+  
+  if(diskio::check_csc_size(f_n_cols, f_n_nz, uword(sizeof(eT)), N_avail) == false)
+    {
+    err_msg = "inconsistent data in ";
+    return false;
+    }
+  
+  uword col_ptrs_offset    = 0;
+  uword row_indices_offset = 0;
+  uword values_offset      = 0;
+  uword file_size          = 0;
+  
+  diskio::csc_offsets(f_n_cols, f_n_nz, uword(sizeof(eT)), col_ptrs_offset, row_indices_offset, values_offset, file_size);
+  
+  x.set_size(f_n_rows, f_n_cols);
+  
+  x.mem_resize(f_n_nz);
+  
+  const uword col_ptrs_end    = col_ptrs_offset    + (f_n_cols + 1) * uword(sizeof(uword));
+  const uword row_indices_end = row_indices_offset +  f_n_nz        * uword(sizeof(uword));
+  
+  f.ignore(std::streamsize(col_ptrs_offset - sizeof(header)));
+  f.read( reinterpret_cast<char*>(access::rwp(x.col_ptrs)),    std::streamsize((f_n_cols+1)*sizeof(uword)) );
+  f.ignore(std::streamsize(row_indices_offset - col_ptrs_end));
+  f.read( reinterpret_cast<char*>(access::rwp(x.row_indices)), std::streamsize(f_n_nz*sizeof(uword))       );
+  f.ignore(std::streamsize(values_offset - row_indices_end));
+  f.read( reinterpret_cast<char*>(access::rwp(x.values)),      std::streamsize(f_n_nz*sizeof(eT))          );
+  
+  bool load_okay = f.good() || ( f.eof() && (f.fail() == false) );
+  
+  if(load_okay)
+    {
+    load_okay = diskio::check_csc(f_n_rows, f_n_cols, f_n_nz, x.col_ptrs, x.row_indices, x.values);
+    
+    if(load_okay == false)  { err_msg = "inconsistent data in "; }
+    }
+  
+  return load_okay;
+  }
+
+
+
+//! helpers for sparse matrix formats
+
+
+
+template<typename eT>
+inline
+const char*
+diskio::mm_field_name(const SpMat<eT>& x)
+  {
+  arma_ignore(x);
+  
+  if(is_cx<eT>::yes)               { return "complex"; }
+  if(is_non_integral<eT>::value)   { return "real";    }
+  
+  return "integer";
+  }
+
+
+
+template<typename eT>
+inline
+void
+diskio::mm_write_val(std::ostream& f, const eT& val)
+  {
+  arma_ostream::print_elem(f, val, false);
+  }
+
+
+
+template<typename T>
+inline
+void
+diskio::mm_write_val(std::ostream& f, const std::complex<T>& val)
+  {
+  arma_ostream::print_elem(f, val.real(), false);
+  
+  f << ' ';
+  
+  arma_ostream::print_elem(f, val.imag(), false);
+  }
+
+
+
+//! parse the value of an element within [p, eol); for the pattern field the value is 1
+template<typename eT>
+inline
+bool
+diskio::mm_parse_val(eT& val, const char*& p, const char* eol, const uword field)
+  {
+  if(field == 2)  { val = eT(1);  return true; }
+  
+  while( (p < eol) && ((*p == ' ') || (*p == '\t')) )  { ++p; }
+  
+  if(p >= eol)  { return false; }
+  
+  char* endptr = NULL;
+  
+  const double tmp = std::strtod(p, &endptr);
+  
+  if(endptr == p)  { return false; }
+  
+  p = endptr;
+  
+  val = (is_signed<eT>::value || (tmp >= double(0))) ? eT(tmp) : eT(0);
+  
+  return true;
+  }
+
+
+
+template<typename T>
+inline
+bool
+diskio::mm_parse_val(std::complex<T>& val, const char*& p, const char* eol, const uword field)
+  {
+  T val_real = T(0);
+  T val_imag = T(0);
+  
+  bool okay = diskio::mm_parse_val(val_real, p, eol, field);
+  
+  if(field == 1)  { okay = okay && diskio::mm_parse_val(val_imag, p, eol, field); }
+  
+  val = std::complex<T>(val_real, val_imag);
+  
+  return okay;
+  }
+
+
+
+inline
+bool
+diskio::mm_parse_uword(uword& val, const char*& p, const char* eol)
+  {
+  while( (p < eol) && ((*p == ' ') || (*p == '\t')) )  { ++p; }
+  
+  const char* start = p;
+  
+  uword tmp = 0;
+  
+  while( (p < eol) && (*p >= '0') && (*p <= '9') )  { tmp = 10*tmp + uword(*p - '0');  ++p; }
+  
+  val = tmp;
+  
+  return (p > start);
+  }
+
+
+
+//! number of lines within [p, end) which are neither empty nor comments
+inline
+uword
+diskio::mm_count_lines(const char* p, const char* end)
+  {
+  uword count = 0;
+  
+  while(p < end)
+    {
+    while( (p < end) && ((*p == ' ') || (*p == '\t') || (*p == '\r')) )  { ++p; }
+    
+    if( (p < end) && (*p != '\n') && (*p != '%') )  { ++count; }
+    
+    const void* eol = std::memchr(p, '\n', size_t(end - p));
+    
+    p = (eol != NULL) ? (static_cast<const char*>(eol) + 1) : end;
+    }
+  
+  return count;
+  }
+
+
+
+//! the header has a fixed size of 128 bytes:
+//! an identifier, the element type, sizeof(uword), and the number of rows, columns and non-zero elements
+template<typename eT>
+inline
+void
+diskio::gen_csc_header(char* header, const SpMat<eT>& x)
+  {
+  std::memset(header, 0, 128);
+  
+  std::memcpy(header, "ARMA_CSC_BINARY\n", 16);
+  
+  const std::string type_name = diskio::gen_bin_header(x);
+  
+  std::memcpy(header + 16, type_name.c_str(), (std::min)(size_t(31), type_name.length()));
+  
+  const u32   word_size = u32(sizeof(uword));
+  const uword dims[3]   = { x.n_rows, x.n_cols, x.n_nonzero };
+  
+  std::memcpy(header + 48, &word_size, sizeof(u32)    );
+  std::memcpy(header + 56, dims,       sizeof(dims));
+  }
+
+
+
+template<typename eT>
+inline
+bool
+diskio::parse_csc_header(const char* header, const SpMat<eT>& x, uword& n_rows, uword& n_cols, uword& n_nonzero)
+  {
+  char expected[128];
+  
+  diskio::gen_csc_header(expected, x);
+  
+  // the identifier, element type and sizeof(uword) must match
+  if(std::memcmp(header, expected, 56) != 0)  { return false; }
+  
+  uword dims[3];
+  
+  std::memcpy(dims, header + 56, sizeof(dims));
+  
+  n_rows    = dims[0];
+  n_cols    = dims[1];
+  n_nonzero = dims[2];
+  
+  return true;
+  }
+
+
+
+//! the column pointers start after the header, and the row indices and values start at multiples of 64 bytes
+inline
+void
+diskio::csc_offsets(const uword n_cols, const uword n_nonzero, const uword elem_size, uword& col_ptrs_offset, uword& row_indices_offset, uword& values_offset, uword& file_size)
+  {
+  col_ptrs_offset    = 128;
+  row_indices_offset = ( (col_ptrs_offset    + (n_cols + 1) * uword(sizeof(uword)) + 63) / 64 ) * 64;
+  values_offset      = ( (row_indices_offset +  n_nonzero   * uword(sizeof(uword)) + 63) / 64 ) * 64;
+  file_size          = values_offset + n_nonzero * elem_size;
+  }
+
+
+
+//! check that a file with the given number of columns and non-zero elements fits within avail_size bytes;
+//! the sizes come from a header that may be corrupt, so the file size is first bounded in floating point to avoid overflow
+inline
+bool
+diskio::check_csc_size(const uword n_cols, const uword n_nonzero, const uword elem_size, const uword avail_size)
+  {
+  const double max_size = 256.0 + (double(n_cols) + 1.0) * double(sizeof(uword)) + double(n_nonzero) * double(sizeof(uword) + elem_size);
+  
+  if(max_size > double(ARMA_MAX_UWORD))  { return false; }
+  
+  uword col_ptrs_offset    = 0;
+  uword row_indices_offset = 0;
+  uword values_offset      = 0;
+  uword file_size          = 0;
+  
+  diskio::csc_offsets(n_cols, n_nonzero, elem_size, col_ptrs_offset, row_indices_offset, values_offset, file_size);
+  
+  return (file_size <= avail_size);
+  }
+
+
+
+//! check of CSC arrays read from a file: structure, and no explicitly stored zeros
+template<typename eT>
+inline
+bool
+diskio::check_csc(const uword n_rows, const uword n_cols, const uword n_nonzero, const uword* col_ptrs, const uword* row_indices, const eT* values)
+  {
+  if( (col_ptrs[0] != 0) || (col_ptrs[n_cols] != n_nonzero) )  { return false; }
+  
+  for(uword c=0; c < n_cols; ++c)
+    {
+    const uword p_start = col_ptrs[c  ];
+    const uword p_end   = col_ptrs[c+1];
+    
+    if( (p_end < p_start) || (p_end > n_nonzero) )  { return false; }
+    
+    for(uword p = p_start; p < p_end; ++p)
+      {
+      if(row_indices[p] >= n_rows)  { return false; }
+      
+      if( (p > p_start) && (row_indices[p] <= row_indices[p-1]) )  { return false; }
+      }
+    }
+  
+  for(uword i=0; i < n_nonzero; ++i)  { if(values[i] == eT(0))  { return false; } }
+  
+  return true;
+  }
+
+
+
 // cubes
 
 
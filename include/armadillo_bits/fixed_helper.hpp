@@ -0,0 +1,455 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup fixed_helper
+//! @{
+
+
+namespace fixed_helper
+{
+
+
+
+// kernels for matrices with at most 8 rows and 8 columns, with the sizes given as template arguments.
+// as the sizes are known at compile time, the compiler can fully unroll and vectorise the loops,
+// and all temporaries are kept on the stack.
+// products of Mat::fixed, Col::fixed and Row::fixed objects are routed here directly from glue_times;
+// the inv and det kernels are also used for ordinary matrices via a switch on the run-time size.
+
+
+
+static const uword max_size = 8;
+
+
+
+//! compile-time size of a fixed size object or its transpose;
+//! n_rows and n_cols refer to the object after the transpose (if any)
+template<typename T1, bool is_fixed = is_Mat_fixed<T1>::value>
+struct size_info
+  {
+  static const bool  value    = false;
+  static const bool  do_trans = false;
+  static const uword n_rows   = 0;
+  static const uword n_cols   = 0;
+  };
+
+
+
+template<typename T1>
+struct size_info<T1, true>
+  {
+  static const bool  value    = ( (T1::n_rows <= max_size) && (T1::n_cols <= max_size) );
+  static const bool  do_trans = false;
+  static const uword n_rows   = T1::n_rows;
+  static const uword n_cols   = T1::n_cols;
+  
+  arma_inline static const typename T1::elem_type* get_mem(const T1& X) { return X.memptr(); }
+  };
+
+
+
+template<typename T1>
+struct size_info< Op<T1, op_htrans>, false >
+  {
+  static const bool  value    = size_info<T1>::value;
+  static const bool  do_trans = true;
+  static const uword n_rows   = size_info<T1>::n_cols;
+  static const uword n_cols   = size_info<T1>::n_rows;
+  
+  arma_inline static const typename T1::elem_type* get_mem(const Op<T1, op_htrans>& X) { return size_info<T1>::get_mem(X.m); }
+  };
+
+
+
+//! the kernels are only used for products where they are faster than BLAS;
+//! for larger products the BLAS kernels are quicker, even with the overhead of calling BLAS
+template<typename T1, typename T2>
+struct mul_ok
+  {
+  static const uword n_ops = size_info<T1>::n_rows * size_info<T1>::n_cols * size_info<T2>::n_cols;
+  
+  static const bool value = ( size_info<T1>::value && size_info<T2>::value && (size_info<T1>::n_cols == size_info<T2>::n_rows) && (n_ops > 0) && (n_ops <= 128) );
+  };
+
+
+
+//! helpers which produce straight-line code via recursion:
+//! unroll<N>::axpy():  acc[i] += a[i] * b
+//! unroll<N>::scal():  acc[i]  = a[i] * b
+//! unroll<N>::copy():  out[i]  = a[i]
+template<uword N>
+struct unroll
+  {
+  template<typename eT>
+  arma_inline static void axpy(eT* acc, const eT* a, const eT b)
+    {
+    unroll<N-1>::axpy(acc, a, b);
+    
+    acc[N-1] += a[N-1] * b;
+    }
+  
+  template<typename eT>
+  arma_inline static void scal(eT* acc, const eT* a, const eT b)
+    {
+    unroll<N-1>::scal(acc, a, b);
+    
+    acc[N-1] = a[N-1] * b;
+    }
+  
+  template<typename eT>
+  arma_inline static void copy(eT* out, const eT* a)
+    {
+    unroll<N-1>::copy(out, a);
+    
+    out[N-1] = a[N-1];
+    }
+  };
+
+
+
+template<>
+struct unroll<0>
+  {
+  template<typename eT> arma_inline static void axpy(eT*, const eT*, const eT) {}
+  template<typename eT> arma_inline static void scal(eT*, const eT*, const eT) {}
+  template<typename eT> arma_inline static void copy(eT*, const eT*)           {}
+  };
+
+
+
+//! sum of conj(a[i]) * b[i], for i in [0, N)
+template<uword N>
+struct unroll_dot
+  {
+  template<typename eT>
+  arma_inline static eT apply(const eT* a, const eT* b)
+    {
+    return unroll_dot<N-1>::apply(a, b) + access::alt_conj(a[N-1]) * b[N-1];
+    }
+  };
+
+
+
+template<>
+struct unroll_dot<0>
+  {
+  template<typename eT>
+  arma_inline static eT apply(const eT*, const eT*) { return eT(0); }
+  };
+
+
+
+//! out = A.t(), where A has size n_rows x n_cols;
+//! out must not alias A
+template<uword n_rows, uword n_cols>
+struct trans
+  {
+  template<typename eT>
+  arma_hot
+  arma_inline
+  static
+  void
+  apply(eT* out, const eT* A)
+    {
+    for(uword col=0; col < n_cols; ++col)
+    for(uword row=0; row < n_rows; ++row)
+      {
+      out[col + row*n_cols] = access::alt_conj(A[row + col*n_rows]);
+      }
+    }
+  };
+
+
+
+//! C = op(A)*op(B), where op() is either nothing or the hermitian transpose;
+//! op(A) has size n_rows x n_inner, op(B) has size n_inner x n_cols;
+//! C must not alias A or B
+template<uword n_rows, uword n_inner, uword n_cols, bool do_trans_A, bool do_trans_B>
+struct mul
+  {
+  template<typename eT>
+  arma_hot
+  arma_inline
+  static
+  void
+  apply(eT* C, const eT* A, const eT* B_in)
+    {
+    arma_aligned eT B_tmp[ (do_trans_B) ? (n_inner*n_cols) : 1 ];
+    
+    if(do_trans_B)  { trans<n_cols, n_inner>::apply(B_tmp, B_in); }
+    
+    const eT* B = (do_trans_B) ? B_tmp : B_in;
+    
+    for(uword col=0; col < n_cols; ++col)
+      {
+      const eT* B_col = &B[col*n_inner];
+            eT* C_col = &C[col*n_rows ];
+      
+      if(do_trans_A == false)
+        {
+        // the accumulators are kept local and only accessed with constant indices, so that they can be held in registers
+        
+        eT acc[n_rows];
+        
+        unroll<n_rows>::scal(acc, A, B_col[0]);
+        
+        for(uword k=1; k < n_inner; ++k)  { unroll<n_rows>::axpy(acc, &A[k*n_rows], B_col[k]); }
+        
+        unroll<n_rows>::copy(C_col, acc);
+        }
+      else
+        {
+        for(uword row=0; row < n_rows; ++row)  { C_col[row] = unroll_dot<n_inner>::apply(&A[row*n_inner], B_col); }
+        }
+      }
+    }
+  };
+
+
+
+//! inverse via Gauss-Jordan elimination with partial pivoting;
+//! returns false if a zero pivot is found; out can alias A
+template<uword N>
+struct inv
+  {
+  template<typename eT>
+  arma_hot
+  inline
+  static
+  bool
+  apply(eT* out, const eT* A)
+    {
+    typedef typename get_pod_type<eT>::result T;
+    
+    arma_aligned eT W[N*N];
+    arma_aligned eT f[N];
+    
+    for(uword i=0; i < N*N; ++i)  { W[i]   = A[i]; out[i] = eT(0); }
+    for(uword i=0; i < N;   ++i)  { out[i + i*N] = eT(1); }
+    
+    for(uword k=0; k < N; ++k)
+      {
+      uword p       = k;
+      T     max_val = std::abs(W[k + k*N]);
+      
+      for(uword i=(k+1); i < N; ++i)
+        {
+        const T val = std::abs(W[i + k*N]);
+        
+        if(val > max_val)  { max_val = val; p = i; }
+        }
+      
+      if(max_val == T(0))  { return false; }
+      
+      if(p != k)
+        {
+        for(uword j=0; j < N; ++j)
+          {
+          std::swap(  W[k + j*N],   W[p + j*N]);
+          std::swap(out[k + j*N], out[p + j*N]);
+          }
+        }
+      
+      const eT inv_pivot = eT(1) / W[k + k*N];
+      
+      for(uword j=0; j < N; ++j)
+        {
+          W[k + j*N] *= inv_pivot;
+        out[k + j*N] *= inv_pivot;
+        }
+      
+      for(uword i=0; i < N; ++i)  { f[i] = W[i + k*N]; }
+      
+      f[k] = eT(0);
+      
+      for(uword j=0; j < N; ++j)
+        {
+        const eT W_kj   =   W[k + j*N];
+        const eT out_kj = out[k + j*N];
+        
+        for(uword i=0; i < N; ++i)
+          {
+            W[i + j*N] -= f[i] * W_kj;
+          out[i + j*N] -= f[i] * out_kj;
+          }
+        }
+      }
+    
+    return true;
+    }
+  };
+
+
+
+//! determinant via LU decomposition with partial pivoting
+template<uword N>
+struct det
+  {
+  template<typename eT>
+  arma_hot
+  inline
+  static
+  eT
+  apply(const eT* A)
+    {
+    typedef typename get_pod_type<eT>::result T;
+    
+    arma_aligned eT W[N*N];
+    
+    for(uword i=0; i < N*N; ++i)  { W[i] = A[i]; }
+    
+    eT val = eT(1);
+    
+    for(uword k=0; k < N; ++k)
+      {
+      uword p       = k;
+      T     max_val = std::abs(W[k + k*N]);
+      
+      for(uword i=(k+1); i < N; ++i)
+        {
+        const T tmp = std::abs(W[i + k*N]);
+        
+        if(tmp > max_val)  { max_val = tmp; p = i; }
+        }
+      
+      if(max_val == T(0))  { return eT(0); }
+      
+      if(p != k)
+        {
+        for(uword j=k; j < N; ++j)  { std::swap(W[k + j*N], W[p + j*N]); }
+        
+        val = -val;
+        }
+      
+      const eT pivot = W[k + k*N];
+      
+      val *= pivot;
+      
+      for(uword i=(k+1); i < N; ++i)  { W[i + k*N] /= pivot; }
+      
+      for(uword j=(k+1); j < N; ++j)
+        {
+        const eT W_kj = W[k + j*N];
+        
+        for(uword i=(k+1); i < N; ++i)  { W[i + j*N] -= W[i + k*N] * W_kj; }
+        }
+      }
+    
+    return val;
+    }
+  };
+
+
+
+//! dispatch of run-time sizes to the inv and det kernels, for sizes 5 to 8;
+//! smaller sizes are handled by auxlib::inv_noalias_tinymat() and auxlib::det_tinymat()
+template<typename eT>
+inline
+bool
+inv_smallmat(eT* out, const eT* A, const uword N)
+  {
+  switch(N)
+    {
+    case 5:  return fixed_helper::inv<5>::apply(out, A);
+    case 6:  return fixed_helper::inv<6>::apply(out, A);
+    case 7:  return fixed_helper::inv<7>::apply(out, A);
+    case 8:  return fixed_helper::inv<8>::apply(out, A);
+    default: return false;
+    }
+  }
+
+
+
+template<typename eT>
+inline
+eT
+det_smallmat(const eT* A, const uword N)
+  {
+  switch(N)
+    {
+    case 5:  return fixed_helper::det<5>::apply(A);
+    case 6:  return fixed_helper::det<6>::apply(A);
+    case 7:  return fixed_helper::det<7>::apply(A);
+    case 8:  return fixed_helper::det<8>::apply(A);
+    default: return eT(0);
+    }
+  }
+
+
+
+//
+// the redirect class below is instantiated with use_fixed = true only when the sizes are suitable
+
+
+
+template<bool use_fixed>
+struct mul_redirect
+  {
+  template<typename T1, typename T2>
+  arma_inline static void apply(Mat<typename T1::elem_type>&, const T1&, const T2&) {}
+  };
+
+
+
+template<>
+struct mul_redirect<true>
+  {
+  template<typename T1, typename T2>
+  arma_hot
+  arma_inline
+  static
+  void
+  apply(Mat<typename T1::elem_type>& out, const T1& A, const T2& B)
+    {
+    arma_extra_debug_sigprint();
+    
+    typedef typename T1::elem_type eT;
+    
+    typedef size_info<T1> A_info;
+    typedef size_info<T2> B_info;
+    
+    typedef mul<A_info::n_rows, A_info::n_cols, B_info::n_cols, A_info::do_trans, B_info::do_trans> kernel;
+    
+    const eT* A_mem = A_info::get_mem(A);
+    const eT* B_mem = B_info::get_mem(B);
+    
+    const bool alias = (A_mem == out.memptr()) || (B_mem == out.memptr());
+    
+    if(alias == false)
+      {
+      out.set_size(A_info::n_rows, B_info::n_cols);
+      
+      kernel::apply(out.memptr(), A_mem, B_mem);
+      }
+    else
+      {
+      arma_aligned eT tmp[A_info::n_rows * B_info::n_cols];
+      
+      kernel::apply(tmp, A_mem, B_mem);
+      
+      out.set_size(A_info::n_rows, B_info::n_cols);
+      
+      unroll<A_info::n_rows * B_info::n_cols>::copy(out.memptr(), tmp);
+      }
+    }
+  };
+
+
+
+}  // end of namespace fixed_helper
+
+
+//! @}
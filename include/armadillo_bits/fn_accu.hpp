@@ -728,7 +728,11 @@ accu(const SpBase<typename T1::elem_type,T1>& expr)
   if(SpProxy<T1>::use_iterator == false)
     {
     // direct counting
-    return arrayops::accumulate(P.get_values(), P.get_n_nonzero());
+    const uword N = P.get_n_nonzero();
+    
+    if(mp_gate<eT>::eval(N))  { return sp_reduce_helper::all_reduce(sp_reduce_helper::red_sum<eT>(P.get_values()), N, N); }
+    
+    return arrayops::accumulate(P.get_values(), N);
     }
   else
     {
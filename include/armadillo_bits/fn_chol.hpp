@@ -69,4 +69,87 @@ chol
 
 
 
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, const OpCube<T1, op_chol_slices> >::result
+chol
+  (
+  const BaseCube<typename T1::elem_type,T1>& X,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != NULL) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "chol(): layout must be \"upper\" or \"lower\"" );
+  
+  return OpCube<T1, op_chol_slices>(X.get_ref(), ((sig == 'u') ? 0 : 1), 0 );
+  }
+
+
+
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+chol
+  (
+            Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& X,
+  const char* layout = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (layout != NULL) ? layout[0] : char(0);
+  
+  arma_debug_check( ((sig != 'u') && (sig != 'l')), "chol(): layout must be \"upper\" or \"lower\"" );
+  
+  const bool status = op_chol_slices::apply_direct(out, X.get_ref(), ((sig == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn("chol(): decomposition failed for one or more slices");
+    }
+  
+  return status;
+  }
+
+
+
+//! rank-1 update (update_type = "+") or downdate (update_type = "-") of the Cholesky factor of X,
+//! so that the result is the Cholesky factor of X + x*x.t() or X - x*x.t()
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+chol_update
+  (
+         Mat<typename T1::elem_type>&    R,
+  const Base<typename T1::elem_type,T1>& x,
+  const char* update_type = "+",
+  const char* layout      = "upper"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig_type   = (update_type != NULL) ? update_type[0] : char(0);
+  const char sig_layout = (layout      != NULL) ? layout[0]      : char(0);
+  
+  arma_debug_check( ((sig_type   != '+') && (sig_type   != '-')), "chol_update(): update_type must be \"+\" or \"-\""     );
+  arma_debug_check( ((sig_layout != 'u') && (sig_layout != 'l')), "chol_update(): layout must be \"upper\" or \"lower\"" );
+  
+  const bool status = op_chol_update::apply_direct(R, x, (sig_type == '-'), ((sig_layout == 'u') ? 0 : 1));
+  
+  if(status == false)
+    {
+    arma_debug_warn("chol_update(): downdated matrix is not positive definite; factor not modified");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
@@ -188,4 +188,25 @@ det(const T& x)
 
 
 
+//! determinants of all slices of a cube
+template<typename T1>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, Col<typename T1::elem_type> >::result
+det
+  (
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<typename T1::elem_type> out;
+  
+  op_det_slices::apply(out, X);
+  
+  return out;
+  }
+
+
+
 //! @}
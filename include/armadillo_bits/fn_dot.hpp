@@ -258,7 +258,8 @@ dot
       }
     else
       {
-      return priv::dot_helper(pa,pb);
+      // merge each pair of columns; with OpenMP, the columns are split across threads
+      return sp_reduce_helper::all_reduce(sp_reduce_helper::red_dot_col<eT>(A,B), A.n_cols, A.n_nonzero + B.n_nonzero);
       }
     }
   else
@@ -121,4 +121,272 @@ eigs_gen
 
 
 
+//! eigenvalues of general real sparse matrix X closest to the real shift sigma (shift-invert mode)
+template<typename T1>
+arma_warn_unused
+inline
+Col< std::complex<typename T1::pod_type> >
+eigs_gen
+  (
+  const SpBase<typename T1::elem_type, T1>& X,
+  const uword                               n_eigvals,
+  const double                              sigma,
+  const typename T1::pod_type               tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::pod_type T;
+  
+  Mat< std::complex<T> > eigvec;
+  Col< std::complex<T> > eigval;
+  
+  const bool status = sp_auxlib::eigs_gen_shift(eigval, eigvec, X, n_eigvals, T(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_stop_runtime_error("eigs_gen(): decomposition failed");
+    }
+  
+  return eigval;
+  }
+
+
+
+//! eigenvalues of general real sparse matrix X closest to the real shift sigma (shift-invert mode)
+template<typename T1>
+inline
+bool
+eigs_gen
+  (
+           Col< std::complex<typename T1::pod_type> >& eigval,
+  const SpBase<typename T1::elem_type, T1>&            X,
+  const uword                                          n_eigvals,
+  const double                                         sigma,
+  const typename T1::pod_type                          tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::pod_type T;
+  
+  Mat< std::complex<T> > eigvec;
+  
+  const bool status = sp_auxlib::eigs_gen_shift(eigval, eigvec, X, n_eigvals, T(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_debug_warn("eigs_gen(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of general real sparse matrix X closest to the real shift sigma (shift-invert mode)
+template<typename T1>
+inline
+bool
+eigs_gen
+  (
+         Col< std::complex<typename T1::pod_type> >& eigval,
+         Mat< std::complex<typename T1::pod_type> >& eigvec,
+  const SpBase<typename T1::elem_type, T1>&          X,
+  const uword                                        n_eigvals,
+  const double                                       sigma,
+  const typename T1::pod_type                        tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_gen(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_gen_shift(eigval, eigvec, X, n_eigvals, typename T1::pod_type(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_gen(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of the generalised problem A*x = lambda*B*x, where A and B are general real sparse matrices
+template<typename T1, typename T2>
+inline
+bool
+eigs_gen
+  (
+         Col< std::complex<typename T1::pod_type> >& eigval,
+         Mat< std::complex<typename T1::pod_type> >& eigvec,
+  const SpBase<typename T1::elem_type, T1>&          A,
+  const SpBase<typename T1::elem_type, T2>&          B,
+  const uword                                        n_eigvals,
+  const char*                                        form = "lm",
+  const typename T1::pod_type                        tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_gen(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_gen_pair(eigval, eigvec, A, B, n_eigvals, form, false, typename T1::pod_type(0), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_gen(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of the generalised problem A*x = lambda*B*x closest to the real shift sigma (shift-invert mode),
+//! where A and B are general real sparse matrices
+template<typename T1, typename T2>
+inline
+bool
+eigs_gen
+  (
+         Col< std::complex<typename T1::pod_type> >& eigval,
+         Mat< std::complex<typename T1::pod_type> >& eigvec,
+  const SpBase<typename T1::elem_type, T1>&          A,
+  const SpBase<typename T1::elem_type, T2>&          B,
+  const uword                                        n_eigvals,
+  const double                                       sigma,
+  const typename T1::pod_type                        tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_gen(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_gen_pair(eigval, eigvec, A, B, n_eigvals, NULL, true, typename T1::pod_type(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_gen(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+//! eigenvalues of a general real structured operator (eg. sp_kron_op, sp_blockdiag_op)
+template<typename op_type>
+arma_warn_unused
+inline
+typename enable_if2< is_sp_linop<op_type>::value && is_real<typename op_type::elem_type>::value, Col< std::complex<typename op_type::pod_type> > >::result
+eigs_gen
+  (
+  const op_type&                   A,
+  const uword                      n_eigvals,
+  const char*                      form = "lm",
+  const typename op_type::pod_type tol  = 0.0
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename op_type::pod_type T;
+  
+  Mat< std::complex<T> > eigvec;
+  Col< std::complex<T> > eigval;
+  
+  const bool status = sp_auxlib::eigs_gen_op(eigval, eigvec, A, n_eigvals, form, tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_stop_runtime_error("eigs_gen(): decomposition failed");
+    }
+  
+  return eigval;
+  }
+
+
+
+//! eigenvalues of a general real structured operator (eg. sp_kron_op, sp_blockdiag_op)
+template<typename op_type>
+inline
+typename enable_if2< is_sp_linop<op_type>::value && is_real<typename op_type::elem_type>::value, bool >::result
+eigs_gen
+  (
+           Col< std::complex<typename op_type::pod_type> >& eigval,
+  const op_type&                                            A,
+  const uword                                               n_eigvals,
+  const char*                                               form = "lm",
+  const typename op_type::pod_type                          tol  = 0.0
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat< std::complex<typename op_type::pod_type> > eigvec;
+  
+  const bool status = sp_auxlib::eigs_gen_op(eigval, eigvec, A, n_eigvals, form, tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_debug_warn("eigs_gen(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of a general real structured operator (eg. sp_kron_op, sp_blockdiag_op)
+template<typename op_type>
+inline
+typename enable_if2< is_sp_linop<op_type>::value && is_real<typename op_type::elem_type>::value, bool >::result
+eigs_gen
+  (
+           Col< std::complex<typename op_type::pod_type> >& eigval,
+           Mat< std::complex<typename op_type::pod_type> >& eigvec,
+  const op_type&                                            A,
+  const uword                                               n_eigvals,
+  const char*                                               form = "lm",
+  const typename op_type::pod_type                          tol  = 0.0
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_gen(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_gen_op(eigval, eigvec, A, n_eigvals, form, tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_gen(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
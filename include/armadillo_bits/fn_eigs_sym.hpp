@@ -117,4 +117,271 @@ eigs_sym
 
 
 
+//! eigenvalues of symmetric real sparse matrix X closest to sigma (shift-invert mode)
+template<typename T1>
+arma_warn_unused
+inline
+Col<typename T1::pod_type>
+eigs_sym
+  (
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              n_eigvals,
+  const double                             sigma,
+  const typename T1::elem_type             tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  Mat<eT> eigvec;
+  Col<eT> eigval;
+  
+  const bool status = sp_auxlib::eigs_sym_shift(eigval, eigvec, X, n_eigvals, eT(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_stop_runtime_error("eigs_sym(): decomposition failed");
+    }
+  
+  return eigval;
+  }
+
+
+
+//! eigenvalues of symmetric real sparse matrix X closest to sigma (shift-invert mode)
+template<typename T1>
+inline
+bool
+eigs_sym
+  (
+           Col<typename T1::pod_type >&    eigval,
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              n_eigvals,
+  const double                             sigma,
+  const typename T1::elem_type             tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  Mat<eT> eigvec;
+  
+  const bool status = sp_auxlib::eigs_sym_shift(eigval, eigvec, X, n_eigvals, eT(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_debug_warn("eigs_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of symmetric real sparse matrix X closest to sigma (shift-invert mode)
+template<typename T1>
+inline
+bool
+eigs_sym
+  (
+           Col<typename T1::pod_type >&    eigval,
+           Mat<typename T1::elem_type>&    eigvec,
+  const SpBase<typename T1::elem_type,T1>& X,
+  const uword                              n_eigvals,
+  const double                             sigma,
+  const typename T1::elem_type             tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_sym(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_sym_shift(eigval, eigvec, X, n_eigvals, typename T1::elem_type(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of the generalised problem A*x = lambda*B*x,
+//! where A and B are symmetric real sparse matrices and B is positive definite
+template<typename T1, typename T2>
+inline
+bool
+eigs_sym
+  (
+           Col<typename T1::pod_type >&    eigval,
+           Mat<typename T1::elem_type>&    eigvec,
+  const SpBase<typename T1::elem_type,T1>& A,
+  const SpBase<typename T1::elem_type,T2>& B,
+  const uword                              n_eigvals,
+  const char*                              form = "lm",
+  const typename T1::elem_type             tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_sym(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_sym_pair(eigval, eigvec, A, B, n_eigvals, form, false, typename T1::elem_type(0), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of the generalised problem A*x = lambda*B*x closest to sigma (shift-invert mode),
+//! where A and B are symmetric real sparse matrices and B is positive definite
+template<typename T1, typename T2>
+inline
+bool
+eigs_sym
+  (
+           Col<typename T1::pod_type >&    eigval,
+           Mat<typename T1::elem_type>&    eigvec,
+  const SpBase<typename T1::elem_type,T1>& A,
+  const SpBase<typename T1::elem_type,T2>& B,
+  const uword                              n_eigvals,
+  const double                             sigma,
+  const typename T1::elem_type             tol  = 0.0,
+  const typename arma_real_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_sym(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_sym_pair(eigval, eigvec, A, B, n_eigvals, NULL, true, typename T1::elem_type(sigma), tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+//! eigenvalues of a symmetric real structured operator (eg. sp_kron_op, sp_blockdiag_op)
+template<typename op_type>
+arma_warn_unused
+inline
+typename enable_if2< is_sp_linop<op_type>::value && is_real<typename op_type::elem_type>::value, Col<typename op_type::pod_type> >::result
+eigs_sym
+  (
+  const op_type&                    A,
+  const uword                       n_eigvals,
+  const char*                       form = "lm",
+  const typename op_type::elem_type tol  = 0.0
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<typename op_type::elem_type> eigvec;
+  Col<typename op_type::pod_type > eigval;
+  
+  const bool status = sp_auxlib::eigs_sym_op(eigval, eigvec, A, n_eigvals, form, tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_stop_runtime_error("eigs_sym(): decomposition failed");
+    }
+  
+  return eigval;
+  }
+
+
+
+//! eigenvalues of a symmetric real structured operator (eg. sp_kron_op, sp_blockdiag_op)
+template<typename op_type>
+inline
+typename enable_if2< is_sp_linop<op_type>::value && is_real<typename op_type::elem_type>::value, bool >::result
+eigs_sym
+  (
+           Col<typename op_type::pod_type>& eigval,
+  const op_type&                            A,
+  const uword                               n_eigvals,
+  const char*                               form = "lm",
+  const typename op_type::elem_type         tol  = 0.0
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<typename op_type::elem_type> eigvec;
+  
+  const bool status = sp_auxlib::eigs_sym_op(eigval, eigvec, A, n_eigvals, form, tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    arma_debug_warn("eigs_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
+//! eigenvalues and eigenvectors of a symmetric real structured operator (eg. sp_kron_op, sp_blockdiag_op)
+template<typename op_type>
+inline
+typename enable_if2< is_sp_linop<op_type>::value && is_real<typename op_type::elem_type>::value, bool >::result
+eigs_sym
+  (
+           Col<typename op_type::pod_type >& eigval,
+           Mat<typename op_type::elem_type>& eigvec,
+  const op_type&                             A,
+  const uword                                n_eigvals,
+  const char*                                form = "lm",
+  const typename op_type::elem_type          tol  = 0.0
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( void_ptr(&eigval) == void_ptr(&eigvec), "eigs_sym(): parameter 'eigval' is an alias of parameter 'eigvec'" );
+  
+  const bool status = sp_auxlib::eigs_sym_op(eigval, eigvec, A, n_eigvals, form, tol);
+  
+  if(status == false)
+    {
+    eigval.soft_reset();
+    eigvec.soft_reset();
+    arma_debug_warn("eigs_sym(): decomposition failed");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
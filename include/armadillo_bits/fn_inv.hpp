@@ -321,4 +321,44 @@ inv_sympd
 
 
 
+template<typename T1>
+arma_warn_unused
+arma_inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, const OpCube<T1, op_inv_slices> >::result
+inv
+  (
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  return OpCube<T1, op_inv_slices>(X.get_ref());
+  }
+
+
+
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+inv
+  (
+            Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& X
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = op_inv_slices::apply_direct(out, X);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_debug_warn("inv(): one or more slices seem singular");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
@@ -198,7 +198,11 @@ norm
     switch(k)
       {
       case 1:
-        return op_norm::vec_norm_1(P_fake_vector);
+        {
+        const T val = sp_reduce_helper::all_reduce(sp_reduce_helper::red_abs_sum<eT>(A.values), A.n_nonzero, A.n_nonzero);
+        
+        return arma_isfinite(val) ? val : op_norm::vec_norm_1(P_fake_vector);
+        }
         break;
       
       case 2:
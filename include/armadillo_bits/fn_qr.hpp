@@ -81,4 +81,55 @@ qr_econ
 
 
 
+//! update the full QR decomposition X = Q*R after inserting column x before column j of X (orientation = "col"),
+//! or after inserting row x before row j of X (orientation = "row")
+template<typename T1>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, void >::result
+qr_insert
+  (
+         Mat<typename T1::elem_type>&    Q,
+         Mat<typename T1::elem_type>&    R,
+  const uword                            j,
+  const Base<typename T1::elem_type,T1>& x,
+  const char* orientation = "col"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (orientation != NULL) ? orientation[0] : char(0);
+  
+  arma_debug_check( ((sig != 'c') && (sig != 'r')), "qr_insert(): orientation must be \"col\" or \"row\"" );
+  arma_debug_check( (&Q == &R),                     "qr_insert(): Q and R are the same object"               );
+  
+  if(sig == 'c')  { op_qr_update::insert_col(Q, R, j, x); }  else  { op_qr_update::insert_row(Q, R, j, x); }
+  }
+
+
+
+//! update the full QR decomposition X = Q*R after deleting column j of X (orientation = "col"),
+//! or after deleting row j of X (orientation = "row")
+template<typename eT>
+inline
+typename enable_if2< is_supported_blas_type<eT>::value, void >::result
+qr_delete
+  (
+        Mat<eT>& Q,
+        Mat<eT>& R,
+  const uword    j,
+  const char*    orientation = "col"
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (orientation != NULL) ? orientation[0] : char(0);
+  
+  arma_debug_check( ((sig != 'c') && (sig != 'r')), "qr_delete(): orientation must be \"col\" or \"row\"" );
+  arma_debug_check( (&Q == &R),                     "qr_delete(): Q and R are the same object"               );
+  
+  if(sig == 'c')  { op_qr_update::delete_col(Q, R, j); }  else  { op_qr_update::delete_row(Q, R, j); }
+  }
+
+
+
 //! @}
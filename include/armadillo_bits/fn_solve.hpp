@@ -301,4 +301,49 @@ solve
 
 
 
+//
+// solve_slices
+
+
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, const GlueCube<T1, T2, glue_solve_slices> >::result
+solve
+  (
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  return GlueCube<T1, T2, glue_solve_slices>(A.get_ref(), B.get_ref());
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+typename enable_if2< is_supported_blas_type<typename T1::elem_type>::value, bool >::result
+solve
+  (
+            Cube<typename T1::elem_type>&    out,
+  const BaseCube<typename T1::elem_type,T1>& A,
+  const BaseCube<typename T1::elem_type,T2>& B
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = glue_solve_slices::apply(out, A, B);
+  
+  if(status == false)
+    {
+    arma_debug_warn("solve(): solution not found for one or more slices");
+    }
+  
+  return status;
+  }
+
+
+
 //! @}
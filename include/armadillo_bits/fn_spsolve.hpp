@@ -20,6 +20,73 @@
 //! Solve a system of linear equations, i.e., A*X = B, where X is unknown,
 //! A is sparse, and B is dense.  X will be dense too.
 
+template<typename T1, typename T2, typename precond_type>
+inline
+bool
+spsolve_iterative_helper
+  (
+           Mat<typename T1::elem_type>&     out,
+  const SpBase<typename T1::elem_type, T1>& A,
+  const   Base<typename T1::elem_type, T2>& B,
+  const char*                          solver,
+  const iterative_opts&                settings,
+  const precond_type&                  precond
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (solver != NULL) ? solver[0] : char(0);
+  
+  arma_debug_check( ((sig != 'c') && (sig != 'm') && (sig != 'b') && (sig != 'g')), "spsolve(): unknown iterative solver" );
+  
+  const bool status = sp_krylov::apply(out, A.get_ref(), B.get_ref(), sig, settings, precond);
+  
+  if(status == false)
+    {
+    arma_debug_warn("spsolve(): iterative solver did not converge");
+    
+    out.soft_reset();
+    }
+  
+  return status;
+  }
+
+
+
+template<typename op_type, typename T2, typename precond_type>
+inline
+bool
+spsolve_linop_helper
+  (
+         Mat<typename op_type::elem_type>&     out,
+  const op_type&                               A,
+  const Base<typename op_type::elem_type, T2>& B,
+  const char*                                  solver,
+  const iterative_opts&                        settings,
+  const precond_type&                          precond
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig = (solver != NULL) ? solver[0] : char(0);
+  
+  // structured operators only provide products with vectors, so only the iterative solvers apply
+  arma_debug_check( ((sig != 'c') && (sig != 'm') && (sig != 'b') && (sig != 'g')), "spsolve(): unknown iterative solver" );
+  
+  const bool status = sp_krylov::apply_linop(out, A, B.get_ref(), sig, settings, precond);
+  
+  if(status == false)
+    {
+    arma_debug_warn("spsolve(): iterative solver did not converge");
+    
+    out.soft_reset();
+    }
+  
+  return status;
+  }
+
+
+
 template<typename T1, typename T2>
 inline
 bool
@@ -39,18 +106,70 @@ spsolve_helper
   typedef typename T1::pod_type   T;
   typedef typename T1::elem_type eT;
   
-  const char sig = (solver != NULL) ? solver[0] : char(0);
+  const char sig  = (solver != NULL) ? solver[0] : char(0);
+  const char sig2 = (sig    != 0   ) ? solver[1] : char(0);
+  
+  // "chol" and "ldl": built-in sparse factorisations of symmetric matrices
+  const bool is_chol = (sig == 'c') && (sig2 == 'h');
+  const bool is_ldl  = (sig == 'l') && (sig2 == 'd');
+  
+  // 'c': CG, 'm': MINRES, 'b': BiCGSTAB, 'g': GMRES
+  const bool is_iterative = ( (sig == 'c') && (is_chol == false) ) || (sig == 'm') || (sig == 'b') || (sig == 'g');
   
-  arma_debug_check( ((sig != 'l') && (sig != 's')), "spsolve(): unknown solver" );
+  arma_debug_check( ((sig != 'l') && (sig != 's') && (is_iterative == false) && (is_chol == false)), "spsolve(): unknown solver" );
   
   T rcond = T(0);
   
   bool status = false;
   
+  if(is_chol || is_ldl)
+    {
+    if(settings.id != 0)
+      {
+      arma_debug_warn("spsolve(): ignoring settings not applicable to sparse factorisations");
+      }
+    
+    sp_factoriser<eT> F;
+    
+    status = F.factorise(A.get_ref(), ((is_chol) ? "chol" : "ldl"), "amd");
+    
+    if(status)  { status = F.solve(out, B.get_ref()); }
+    
+    if(status == false)
+      {
+      if(is_chol)  { arma_debug_warn("spsolve(): matrix seems not symmetric positive definite"); }
+      else         { arma_debug_warn("spsolve(): system seems singular");                       }
+      
+      out.soft_reset();
+      }
+    
+    return status;
+    }
+  
+  if(is_iterative)
+    {
+    if(settings.id == 1)
+      {
+      arma_debug_warn("spsolve(): ignoring settings not applicable to iterative solvers");
+      }
+    
+    // the convergence report is written into the user's settings, so don't copy them
+    const iterative_opts default_opts;
+    
+    const iterative_opts& iter_opts = (settings.id == 2) ? static_cast<const iterative_opts&>(settings) : default_opts;
+    
+    return spsolve_iterative_helper(out, A.get_ref(), B.get_ref(), solver, iter_opts, sp_precond_none());
+    }
+  
   const superlu_opts& opts = (settings.id == 1) ? static_cast<const superlu_opts&>(settings) : superlu_opts();
   
   arma_debug_check( ( (opts.pivot_thresh < double(0)) || (opts.pivot_thresh > double(1)) ), "spsolve(): pivot_thresh out of bounds" );
   
+  if(settings.id == 2)
+    {
+    arma_debug_warn("spsolve(): ignoring settings not applicable to direct solvers");
+    }
+  
   if(sig == 's')  // SuperLU solver
     {
     if( (opts.equilibrate == false) && (opts.refine == superlu_opts::REF_NONE) )
@@ -176,4 +295,165 @@ spsolve
 
 
 
+//! iterative solvers with a preconditioner
+
+template<typename T1, typename T2>
+inline
+bool
+spsolve
+  (
+           Mat<typename T1::elem_type>&     out,
+  const SpBase<typename T1::elem_type, T1>& A,
+  const   Base<typename T1::elem_type, T2>& B,
+  const char*                               solver,
+  const iterative_opts&                     settings,
+  const sp_precond<typename T1::elem_type>& precond,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const bool status = spsolve_iterative_helper(out, A.get_ref(), B.get_ref(), solver, settings, precond);
+  
+  return status;
+  }
+
+
+
+template<typename T1, typename T2>
+arma_warn_unused
+inline
+Mat<typename T1::elem_type>
+spsolve
+  (
+  const SpBase<typename T1::elem_type, T1>& A,
+  const   Base<typename T1::elem_type, T2>& B,
+  const char*                               solver,
+  const iterative_opts&                     settings,
+  const sp_precond<typename T1::elem_type>& precond,
+  const typename arma_blas_type_only<typename T1::elem_type>::result* junk = 0
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename T1::elem_type eT;
+  
+  Mat<eT> out;
+  
+  const bool status = spsolve_iterative_helper(out, A.get_ref(), B.get_ref(), solver, settings, precond);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("spsolve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+//! iterative solvers with a structured operator (eg. sp_kron_op, sp_blockdiag_op)
+
+template<typename op_type, typename T2>
+inline
+typename enable_if2< is_sp_linop<op_type>::value, bool >::result
+spsolve
+  (
+         Mat<typename op_type::elem_type>&     out,
+  const op_type&                               A,
+  const Base<typename op_type::elem_type, T2>& B,
+  const char*                                  solver   = "gmres",
+  const iterative_opts&                        settings = iterative_opts()
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = spsolve_linop_helper(out, A, B.get_ref(), solver, settings, sp_precond_none());
+  
+  return status;
+  }
+
+
+
+template<typename op_type, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_sp_linop<op_type>::value, Mat<typename op_type::elem_type> >::result
+spsolve
+  (
+  const op_type&                               A,
+  const Base<typename op_type::elem_type, T2>& B,
+  const char*                                  solver   = "gmres",
+  const iterative_opts&                        settings = iterative_opts()
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<typename op_type::elem_type> out;
+  
+  const bool status = spsolve_linop_helper(out, A, B.get_ref(), solver, settings, sp_precond_none());
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("spsolve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
+template<typename op_type, typename T2>
+inline
+typename enable_if2< is_sp_linop<op_type>::value, bool >::result
+spsolve
+  (
+         Mat<typename op_type::elem_type>&       out,
+  const op_type&                                 A,
+  const Base<typename op_type::elem_type, T2>&   B,
+  const char*                                    solver,
+  const iterative_opts&                          settings,
+  const sp_precond<typename op_type::elem_type>& precond
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = spsolve_linop_helper(out, A, B.get_ref(), solver, settings, precond);
+  
+  return status;
+  }
+
+
+
+template<typename op_type, typename T2>
+arma_warn_unused
+inline
+typename enable_if2< is_sp_linop<op_type>::value, Mat<typename op_type::elem_type> >::result
+spsolve
+  (
+  const op_type&                                 A,
+  const Base<typename op_type::elem_type, T2>&   B,
+  const char*                                    solver,
+  const iterative_opts&                          settings,
+  const sp_precond<typename op_type::elem_type>& precond
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<typename op_type::elem_type> out;
+  
+  const bool status = spsolve_linop_helper(out, A, B.get_ref(), solver, settings, precond);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("spsolve(): solution not found");
+    }
+  
+  return out;
+  }
+
+
+
 //! @}
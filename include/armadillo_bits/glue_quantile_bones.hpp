@@ -0,0 +1,55 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup glue_quantile
+//! @{
+
+
+class glue_quantile
+  {
+  public:
+  
+  template<typename eT>
+  inline static void worker(eT* out_mem, eT* Y_mem, const uword N, const Mat<eT>& P);
+  
+  template<typename eT>
+  inline static void worker_mp(eT* out_mem, const eT* X_mem, const uword N, const Mat<eT>& P);
+  
+  template<typename eT>
+  inline static void get_ranks(podarray<uword>& rank_lo, podarray<uword>& rank_hi, podarray<eT>& weight, const uword N, const Mat<eT>& P);
+  
+  template<typename eT>
+  inline static void multi_select(eT* Y_mem, const uword start, const uword end_p1, const uword* ranks, const uword ranks_start, const uword ranks_end_p1);
+  
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& P, const uword dim);
+  
+  template<typename T1, typename T2>
+  inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile>& expr);
+  };
+
+
+
+class glue_quantile_default
+  {
+  public:
+  
+  template<typename T1, typename T2>
+  inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile_default>& expr);
+  };
+
+
+//! @}
@@ -0,0 +1,513 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup glue_quantile
+//! @{
+
+
+//! For each probability in P, find the two order statistics and the interpolation weight
+//! that define the quantile, following "Definition 5" in:
+//! Rob J. Hyndman and Yanan Fan.
+//! Sample Quantiles in Statistical Packages.
+//! The American Statistician, Vol. 50, No. 4, pp. 361-365, 1996.
+template<typename eT>
+inline
+void
+glue_quantile::get_ranks(podarray<uword>& rank_lo, podarray<uword>& rank_hi, podarray<eT>& weight, const uword N, const Mat<eT>& P)
+  {
+  arma_extra_debug_sigprint();
+  
+  const eT*   P_mem    = P.memptr();
+  const uword P_n_elem = P.n_elem;
+  
+  rank_lo.set_size(P_n_elem);
+  rank_hi.set_size(P_n_elem);
+  weight.set_size(P_n_elem);
+  
+  const eT alpha = eT(0.5);
+  const eT N_eT  = eT(N);
+  const eT P_min = (eT(1) - alpha) / N_eT;
+  const eT P_max = (N_eT  - alpha) / N_eT;
+  
+  for(uword i=0; i < P_n_elem; ++i)
+    {
+    const eT P_i = P_mem[i];
+    
+    if(P_i < P_min)
+      {
+      rank_lo[i] = 0;
+      rank_hi[i] = 0;
+      weight[i]  = eT(0);
+      }
+    else
+    if(P_i > P_max)
+      {
+      rank_lo[i] = N-1;
+      rank_hi[i] = N-1;
+      weight[i]  = eT(0);
+      }
+    else
+      {
+      const uword k   = uword( std::floor(N_eT * P_i + alpha) );
+      const eT    P_k = (eT(k) - alpha) / N_eT;
+      
+      rank_lo[i] = k-1;
+      rank_hi[i] = (k < N) ? k : (N-1);
+      weight[i]  = (P_i - P_k) * N_eT;
+      }
+    }
+  }
+
+
+
+//! Rearrange Y_mem[start .. end_p1-1] so that each of the given (sorted) ranks holds the element
+//! that would be at that position if the range were sorted.
+//! The ranks are split in half at each level, so that each element is visited O(log(n_ranks)) times
+//! instead of once per rank.
+template<typename eT>
+inline
+void
+glue_quantile::multi_select(eT* Y_mem, const uword start, const uword end_p1, const uword* ranks, const uword ranks_start, const uword ranks_end_p1)
+  {
+  if(ranks_start >= ranks_end_p1)  { return; }
+  
+  const uword mid  = ranks_start + (ranks_end_p1 - ranks_start)/2;
+  const uword rank = ranks[mid];
+  
+  std::nth_element( Y_mem + start, Y_mem + rank, Y_mem + end_p1 );
+  
+  glue_quantile::multi_select(Y_mem, start,  rank,   ranks, ranks_start, mid         );
+  glue_quantile::multi_select(Y_mem, rank+1, end_p1, ranks, mid+1,       ranks_end_p1);
+  }
+
+
+
+//! Find all the quantiles in P with one multi-selection pass over Y_mem, which is modified
+template<typename eT>
+inline
+void
+glue_quantile::worker(eT* out_mem, eT* Y_mem, const uword N, const Mat<eT>& P)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword P_n_elem = P.n_elem;
+  
+  podarray<uword> rank_lo;
+  podarray<uword> rank_hi;
+  podarray<eT>    weight;
+  
+  glue_quantile::get_ranks(rank_lo, rank_hi, weight, N, P);
+  
+  podarray<uword> ranks(2*P_n_elem);
+  
+  uword* ranks_mem = ranks.memptr();
+  
+  arrayops::copy( ranks_mem,            rank_lo.memptr(), P_n_elem );
+  arrayops::copy( ranks_mem + P_n_elem, rank_hi.memptr(), P_n_elem );
+  
+  std::sort( ranks_mem, ranks_mem + 2*P_n_elem );
+  
+  const uword n_ranks = uword( std::unique(ranks_mem, ranks_mem + 2*P_n_elem) - ranks_mem );
+  
+  glue_quantile::multi_select(Y_mem, 0, N, ranks_mem, 0, n_ranks);
+  
+  for(uword i=0; i < P_n_elem; ++i)
+    {
+    const eT w = weight[i];
+    
+    out_mem[i] = (w == eT(0)) ? Y_mem[rank_lo[i]] : ( (eT(1) - w) * Y_mem[rank_lo[i]] + w * Y_mem[rank_hi[i]] );
+    }
+  }
+
+
+
+//! Parallel selection for long vectors, without modifying or copying X_mem.
+//! A sorted sample of X provides bounds that bracket each required rank;
+//! the elements between the bounds are counted and gathered by separate threads,
+//! and the selection is then done on the (much shorter) gathered part.
+//! If the sample turns out to be unrepresentative, a copy of X is processed serially.
+template<typename eT>
+inline
+void
+glue_quantile::worker_mp(eT* out_mem, const eT* X_mem, const uword N, const Mat<eT>& P)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword P_n_elem = P.n_elem;
+    
+    podarray<uword> rank_lo;
+    podarray<uword> rank_hi;
+    podarray<eT>    weight;
+    
+    glue_quantile::get_ranks(rank_lo, rank_hi, weight, N, P);
+    
+    podarray<uword> ranks(2*P_n_elem);
+    
+    uword* ranks_mem = ranks.memptr();
+    
+    arrayops::copy( ranks_mem,            rank_lo.memptr(), P_n_elem );
+    arrayops::copy( ranks_mem + P_n_elem, rank_hi.memptr(), P_n_elem );
+    
+    std::sort( ranks_mem, ranks_mem + 2*P_n_elem );
+    
+    const uword n_ranks = uword( std::unique(ranks_mem, ranks_mem + 2*P_n_elem) - ranks_mem );
+    
+    podarray<eT> rank_vals(n_ranks);
+    
+    // regularly spaced sample
+    
+    const uword S      = (std::min)(N, uword(16384));
+    const uword stride = N / S;
+    const uword margin = uword(4 * std::sqrt(double(S)));
+    
+    podarray<eT> sample(S);
+    
+    for(uword i=0; i < S; ++i)  { sample[i] = X_mem[i*stride]; }
+    
+    std::sort( sample.memptr(), sample.memptr() + S );
+    
+    const int   n_threads  = mp_thread_limit::get();
+    const uword n_chunks   = uword(n_threads);
+    const uword chunk_size = N / n_chunks;
+    
+    podarray<uword> chunk_n_below(n_chunks);
+    podarray<uword> chunk_n_mid(n_chunks);
+    
+    bool status = true;
+    
+    uword r_start = 0;
+    
+    while( status && (r_start < n_ranks) )
+      {
+      // group the ranks whose windows in the sample overlap
+      
+      uword r_end_p1 = r_start + 1;
+      
+      const double ratio = double(S) / double(N);
+      
+      const uword s_first = uword( double(ranks_mem[r_start]) * ratio );
+      
+      uword s_last = s_first;
+      
+      while(r_end_p1 < n_ranks)
+        {
+        const uword s_next = uword( double(ranks_mem[r_end_p1]) * ratio );
+        
+        if( s_next > (s_last + 2*margin) )  { break; }
+        
+        s_last = s_next;
+        
+        ++r_end_p1;
+        }
+      
+      const bool use_lo = (s_first >= margin);
+      const bool use_hi = ((s_last + margin) < S);
+      
+      const eT lo_val = use_lo ? sample[s_first - margin] : eT(0);
+      const eT hi_val = use_hi ? sample[s_last  + margin] : eT(0);
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const uword start  = chunk * chunk_size;
+        const uword end_p1 = (chunk == (n_chunks-1)) ? N : (start + chunk_size);
+        
+        uword n_below = 0;
+        uword n_mid   = 0;
+        
+        for(uword i=start; i < end_p1; ++i)
+          {
+          const eT val = X_mem[i];
+          
+          if(use_lo && (val < lo_val))  { ++n_below; continue; }
+          if(use_hi && (val > hi_val))  {            continue; }
+          
+          ++n_mid;
+          }
+        
+        chunk_n_below[chunk] = n_below;
+        chunk_n_mid[chunk]   = n_mid;
+        }
+      
+      uword n_below = 0;
+      uword n_mid   = 0;
+      
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        n_below += chunk_n_below[chunk];
+        n_mid   += chunk_n_mid[chunk];
+        }
+      
+      status = (n_below <= ranks_mem[r_start]) && (ranks_mem[r_end_p1-1] < (n_below + n_mid)) && (n_mid <= (N/2));
+      
+      if(status)
+        {
+        podarray<uword> chunk_offset(n_chunks);
+        
+        uword offset = 0;
+        
+        for(uword chunk=0; chunk < n_chunks; ++chunk)
+          {
+          chunk_offset[chunk] = offset;
+          
+          offset += chunk_n_mid[chunk];
+          }
+        
+        podarray<eT> Y(n_mid);
+        
+        eT* Y_mem = Y.memptr();
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword chunk=0; chunk < n_chunks; ++chunk)
+          {
+          const uword start  = chunk * chunk_size;
+          const uword end_p1 = (chunk == (n_chunks-1)) ? N : (start + chunk_size);
+          
+          eT* Y_chunk_mem = &(Y_mem[chunk_offset[chunk]]);
+          
+          uword count = 0;
+          
+          for(uword i=start; i < end_p1; ++i)
+            {
+            const eT val = X_mem[i];
+            
+            if(use_lo && (val < lo_val))  { continue; }
+            if(use_hi && (val > hi_val))  { continue; }
+            
+            Y_chunk_mem[count] = val;  ++count;
+            }
+          }
+        
+        podarray<uword> local_ranks(r_end_p1 - r_start);
+        
+        for(uword r=r_start; r < r_end_p1; ++r)  { local_ranks[r - r_start] = ranks_mem[r] - n_below; }
+        
+        glue_quantile::multi_select(Y_mem, 0, n_mid, local_ranks.memptr(), 0, local_ranks.n_elem);
+        
+        for(uword r=r_start; r < r_end_p1; ++r)  { rank_vals[r] = Y_mem[ local_ranks[r - r_start] ]; }
+        }
+      
+      r_start = r_end_p1;
+      }
+    
+    if(status)
+      {
+      for(uword i=0; i < P_n_elem; ++i)
+        {
+        const eT val_lo = rank_vals[ uword(std::lower_bound(ranks_mem, ranks_mem + n_ranks, rank_lo[i]) - ranks_mem) ];
+        const eT val_hi = rank_vals[ uword(std::lower_bound(ranks_mem, ranks_mem + n_ranks, rank_hi[i]) - ranks_mem) ];
+        
+        const eT w = weight[i];
+        
+        out_mem[i] = (w == eT(0)) ? val_lo : ( (eT(1) - w) * val_lo + w * val_hi );
+        }
+      
+      return;
+      }
+    
+    arma_extra_debug_print("glue_quantile::worker_mp(): sample not representative; using serial selection");
+    }
+  #endif
+  
+  podarray<eT> Y(X_mem, N);
+  
+  glue_quantile::worker(out_mem, Y.memptr(), N, P);
+  }
+
+
+
+template<typename eT>
+inline
+void
+glue_quantile::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const Mat<eT>& P, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((P.is_vec() == false) && (P.is_empty() == false)), "quantile(): parameter 'P' must be a vector" );
+  
+  if(X.is_empty())  { out.reset(); return; }
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  const eT*   P_mem    = P.memptr();
+  const uword P_n_elem = P.n_elem;
+  
+  for(uword i=0; i < P_n_elem; ++i)
+    {
+    const eT P_i = P_mem[i];
+    
+    arma_debug_check( ((P_i < eT(0)) || (P_i > eT(1)) || arma_isnan(P_i)), "quantile(): parameter 'P' must contain values in the [0,1] interval" );
+    }
+  
+  if(X.has_nan())  { arma_stop_logic_error("quantile(): detected NaN"); return; }
+  
+  const int n_threads = mp_thread_limit::get();
+  
+  // parallel selection within one vector only pays off when the vector is long
+  const uword mp_vec_min_length = uword(1) << 17;
+  
+  if(dim == 0)
+    {
+    arma_extra_debug_print("glue_quantile::apply(): dim = 0");
+    
+    out.set_size(P_n_elem, X_n_cols);
+    
+    if(P_n_elem == 0)  { return; }
+    
+    if( (X_n_cols == 1) && (X_n_rows >= mp_vec_min_length) && (n_threads >= 2) && mp_gate<eT>::eval(X_n_rows) )
+      {
+      glue_quantile::worker_mp(out.memptr(), X.memptr(), X_n_rows, P);
+      
+      return;
+      }
+      
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const uword n_chunks = uword(n_threads);
+      
+      if( (X_n_cols >= 2*n_chunks) && (n_threads >= 2) && mp_gate<eT>::eval(X.n_elem) )
+        {
+        const uword chunk_size = X_n_cols / n_chunks;
+        
+        podarray<eT> Y(X_n_rows * n_chunks);
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword chunk=0; chunk < n_chunks; ++chunk)
+          {
+          const uword col_start  = chunk * chunk_size;
+          const uword col_end_p1 = (chunk == (n_chunks-1)) ? X_n_cols : (col_start + chunk_size);
+          
+          eT* Y_mem = &(Y[chunk * X_n_rows]);
+          
+          for(uword col=col_start; col < col_end_p1; ++col)
+            {
+            arrayops::copy(Y_mem, X.colptr(col), X_n_rows);
+            
+            glue_quantile::worker(out.colptr(col), Y_mem, X_n_rows, P);
+            }
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
+    podarray<eT> Y(X_n_rows);
+    
+    for(uword col=0; col < X_n_cols; ++col)
+      {
+      arrayops::copy(Y.memptr(), X.colptr(col), X_n_rows);
+      
+      glue_quantile::worker(out.colptr(col), Y.memptr(), X_n_rows, P);
+      }
+    }
+  else
+  if(dim == 1)
+    {
+    arma_extra_debug_print("glue_quantile::apply(): dim = 1");
+    
+    out.set_size(X_n_rows, P_n_elem);
+    
+    if(P_n_elem == 0)  { return; }
+    
+    if( (X_n_rows == 1) && (X_n_cols >= mp_vec_min_length) && (n_threads >= 2) && mp_gate<eT>::eval(X_n_cols) )
+      {
+      glue_quantile::worker_mp(out.memptr(), X.memptr(), X_n_cols, P);
+      
+      return;
+      }
+    
+    podarray<eT> Y(X_n_cols);
+    podarray<eT> tmp(P_n_elem);
+    
+    for(uword row=0; row < X_n_rows; ++row)
+      {
+      for(uword col=0; col < X_n_cols; ++col)  { Y[col] = X.at(row,col); }
+      
+      glue_quantile::worker(tmp.memptr(), Y.memptr(), X_n_cols, P);
+      
+      for(uword i=0; i < P_n_elem; ++i)  { out.at(row,i) = tmp[i]; }
+      }
+    }
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_quantile::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword dim = expr.aux_uword;
+  
+  arma_debug_check( (dim > 1), "quantile(): parameter 'dim' must be 0 or 1" );
+  
+  const quasi_unwrap<T1> UA(expr.A);
+  const quasi_unwrap<T2> UB(expr.B);
+  
+  if(UA.is_alias(out) || UB.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    glue_quantile::apply_noalias(tmp, UA.M, UB.M, dim);
+    
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    glue_quantile::apply_noalias(out, UA.M, UB.M, dim);
+    }
+  }
+
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_quantile_default::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_quantile_default>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> UA(expr.A);
+  const quasi_unwrap<T2> UB(expr.B);
+  
+  const uword dim = (T1::is_row) ? 1 : 0;
+  
+  if(UA.is_alias(out) || UB.is_alias(out))
+    {
+    Mat<eT> tmp;
+    
+    glue_quantile::apply_noalias(tmp, UA.M, UB.M, dim);
+    
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    glue_quantile::apply_noalias(out, UA.M, UB.M, dim);
+    }
+  }
+
+
+//! @}
@@ -44,6 +44,19 @@ class glue_solve_tri
 
 
 
+//! slice-wise solution of systems of linear equations held in cubes
+class glue_solve_slices
+  {
+  public:
+  
+  template<typename T1, typename T2> inline static void apply(Cube<typename T1::elem_type>& out, const GlueCube<T1,T2,glue_solve_slices>& X);
+  
+  template<typename eT, typename T1, typename T2> inline static bool apply(Cube<eT>& out, const BaseCube<eT,T1>& A_expr, const BaseCube<eT,T2>& B_expr);
+  };
+
+
+
+
 namespace solve_opts
   {
   struct opts
@@ -72,29 +85,38 @@ namespace solve_opts
   // The values below (eg. 1u << 1) are for internal Armadillo use only.
   // The values can change without notice.
   
-  static const uword flag_none        = uword(0      );
-  static const uword flag_fast        = uword(1u << 0);
-  static const uword flag_equilibrate = uword(1u << 1);
-  static const uword flag_no_approx   = uword(1u << 2);
-  static const uword flag_triu        = uword(1u << 3);
-  static const uword flag_tril        = uword(1u << 4);
-  static const uword flag_no_band     = uword(1u << 5);
+  static const uword flag_none            = uword(0      );
+  static const uword flag_fast            = uword(1u << 0);
+  static const uword flag_equilibrate     = uword(1u << 1);
+  static const uword flag_no_approx       = uword(1u << 2);
+  static const uword flag_triu            = uword(1u << 3);
+  static const uword flag_tril            = uword(1u << 4);
+  static const uword flag_no_band         = uword(1u << 5);
+  static const uword flag_likely_sympd    = uword(1u << 6);
+  static const uword flag_no_sympd        = uword(1u << 7);
+  static const uword flag_mixed_precision = uword(1u << 8);
   
-  struct opts_none        : public opts { inline opts_none()        : opts(flag_none       ) {} };
-  struct opts_fast        : public opts { inline opts_fast()        : opts(flag_fast       ) {} };
-  struct opts_equilibrate : public opts { inline opts_equilibrate() : opts(flag_equilibrate) {} };
-  struct opts_no_approx   : public opts { inline opts_no_approx()   : opts(flag_no_approx  ) {} };
-  struct opts_triu        : public opts { inline opts_triu()        : opts(flag_triu       ) {} };
-  struct opts_tril        : public opts { inline opts_tril()        : opts(flag_tril       ) {} };
-  struct opts_no_band     : public opts { inline opts_no_band()     : opts(flag_no_band    ) {} };
+  struct opts_none            : public opts { inline opts_none()            : opts(flag_none           ) {} };
+  struct opts_fast            : public opts { inline opts_fast()            : opts(flag_fast           ) {} };
+  struct opts_equilibrate     : public opts { inline opts_equilibrate()     : opts(flag_equilibrate    ) {} };
+  struct opts_no_approx       : public opts { inline opts_no_approx()       : opts(flag_no_approx      ) {} };
+  struct opts_triu            : public opts { inline opts_triu()            : opts(flag_triu           ) {} };
+  struct opts_tril            : public opts { inline opts_tril()            : opts(flag_tril           ) {} };
+  struct opts_no_band         : public opts { inline opts_no_band()         : opts(flag_no_band        ) {} };
+  struct opts_likely_sympd    : public opts { inline opts_likely_sympd()    : opts(flag_likely_sympd   ) {} };
+  struct opts_no_sympd        : public opts { inline opts_no_sympd()        : opts(flag_no_sympd       ) {} };
+  struct opts_mixed_precision : public opts { inline opts_mixed_precision() : opts(flag_mixed_precision) {} };
   
-  static const opts_none        none;
-  static const opts_fast        fast;
-  static const opts_equilibrate equilibrate;
-  static const opts_no_approx   no_approx;
-  static const opts_triu        triu;
-  static const opts_tril        tril;
-  static const opts_no_band     no_band;
+  static const opts_none            none;
+  static const opts_fast            fast;
+  static const opts_equilibrate     equilibrate;
+  static const opts_no_approx       no_approx;
+  static const opts_triu            triu;
+  static const opts_tril            tril;
+  static const opts_no_band         no_band;
+  static const opts_likely_sympd    likely_sympd;
+  static const opts_no_sympd        no_sympd;
+  static const opts_mixed_precision mixed_precision;
   }
 
 
@@ -49,17 +49,23 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
   
   typedef typename get_pod_type<eT>::result T;
   
-  const bool fast        = bool(flags & solve_opts::flag_fast       );
-  const bool equilibrate = bool(flags & solve_opts::flag_equilibrate);
-  const bool no_approx   = bool(flags & solve_opts::flag_no_approx  );
-  const bool no_band     = bool(flags & solve_opts::flag_no_band    );
+  const bool fast            = bool(flags & solve_opts::flag_fast           );
+  const bool equilibrate     = bool(flags & solve_opts::flag_equilibrate    );
+  const bool no_approx       = bool(flags & solve_opts::flag_no_approx      );
+  const bool no_band         = bool(flags & solve_opts::flag_no_band        );
+  const bool likely_sympd    = bool(flags & solve_opts::flag_likely_sympd   );
+  const bool no_sympd        = bool(flags & solve_opts::flag_no_sympd       );
+  const bool mixed_precision = bool(flags & solve_opts::flag_mixed_precision);
   
   arma_extra_debug_print("glue_solve_gen::apply(): enabled flags:");
   
-  if(fast       )  { arma_extra_debug_print("fast");        }
-  if(equilibrate)  { arma_extra_debug_print("equilibrate"); }
-  if(no_approx  )  { arma_extra_debug_print("no_approx");   }
-  if(no_band    )  { arma_extra_debug_print("no_band");     }
+  if(fast           )  { arma_extra_debug_print("fast");            }
+  if(equilibrate    )  { arma_extra_debug_print("equilibrate");     }
+  if(no_approx      )  { arma_extra_debug_print("no_approx");       }
+  if(no_band        )  { arma_extra_debug_print("no_band");         }
+  if(likely_sympd   )  { arma_extra_debug_print("likely_sympd");    }
+  if(no_sympd       )  { arma_extra_debug_print("no_sympd");        }
+  if(mixed_precision)  { arma_extra_debug_print("mixed_precision"); }
   
   T    rcond  = T(0);
   bool status = false;
@@ -75,36 +81,86 @@ glue_solve_gen::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
     
     const bool is_band = ((no_band == false) && (auxlib::crippled_lapack(A) == false)) ? band_helper::is_band(KL, KU, A, uword(32)) : false;
     
-    if(fast)
+    // symmetric positive definite matrices are solved via Cholesky decomposition, which needs half the work of LU decomposition;
+    // the check is O(N^2) and usually rejects other matrices after looking at a few elements;
+    // in fast mode, tiny matrices are handled faster by solve_square_fast()
+    
+    const bool try_sympd = (is_band == false) && ((fast == false) || (A.n_rows > 4)) && (auxlib::crippled_lapack(A) == false) && ( likely_sympd || ((no_sympd == false) && sympd_helper::guess_sympd(A)) );
+    
+    bool sympd_done = false;
+    
+    if(mixed_precision && (is_band == false))
       {
-      if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored, as option 'fast' is enabled"); }
+      if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored, as option 'mixed_precision' is enabled"); }
       
-      if(is_band == false)
+      if(try_sympd)
         {
-        arma_extra_debug_print("glue_solve_gen::apply(): fast + dense");
-      
-        status = auxlib::solve_square_fast(out, A, B_expr.get_ref());  // A is overwritten
+        arma_extra_debug_print("glue_solve_gen::apply(): mixed precision + sympd");
+        
+        sympd_done = auxlib::solve_mixed(out, A, B_expr, true);  // A is restored if the decomposition fails
+        status     = sympd_done;
         }
-      else
+      
+      if(sympd_done == false)
         {
-        arma_extra_debug_print("glue_solve_gen::apply(): fast + band");
+        arma_extra_debug_print("glue_solve_gen::apply(): mixed precision + dense");
         
-        status = auxlib::solve_band_fast(out, A, KL, KU, B_expr.get_ref());
+        status = auxlib::solve_mixed(out, A, B_expr, false);  // A is overwritten
         }
       }
     else
+    if(fast)
       {
-      if(is_band == false)
+      if(equilibrate)  { arma_debug_warn("solve(): option 'equilibrate' ignored, as option 'fast' is enabled"); }
+      
+      if(try_sympd)
         {
-        arma_extra_debug_print("glue_solve_gen::apply(): refine + dense");
+        arma_extra_debug_print("glue_solve_gen::apply(): fast + sympd");
         
-        status = auxlib::solve_square_refine(out, rcond, A, B_expr, equilibrate);  // A is overwritten
+        sympd_done = auxlib::solve_sympd_fast(out, A, B_expr.get_ref());  // A is restored if the decomposition fails
+        status     = sympd_done;
         }
-      else
+      
+      if(sympd_done == false)
         {
-        arma_extra_debug_print("glue_solve_gen::apply(): refine + band");
+        if(is_band == false)
+          {
+          arma_extra_debug_print("glue_solve_gen::apply(): fast + dense");
+          
+          status = auxlib::solve_square_fast(out, A, B_expr.get_ref());  // A is overwritten
+          }
+        else
+          {
+          arma_extra_debug_print("glue_solve_gen::apply(): fast + band");
+          
+          status = auxlib::solve_band_fast(out, A, KL, KU, B_expr.get_ref());
+          }
+        }
+      }
+    else
+      {
+      if(try_sympd)
+        {
+        arma_extra_debug_print("glue_solve_gen::apply(): refine + sympd");
         
-        status = auxlib::solve_band_refine(out, rcond, A, KL, KU, B_expr, equilibrate);
+        sympd_done = auxlib::solve_sympd_refine(out, rcond, A, B_expr, equilibrate);  // A is restored if the decomposition fails
+        status     = sympd_done;
+        }
+      
+      if(sympd_done == false)
+        {
+        if(is_band == false)
+          {
+          arma_extra_debug_print("glue_solve_gen::apply(): refine + dense");
+          
+          status = auxlib::solve_square_refine(out, rcond, A, B_expr, equilibrate);  // A is overwritten
+          }
+        else
+          {
+          arma_extra_debug_print("glue_solve_gen::apply(): refine + band");
+          
+          status = auxlib::solve_band_refine(out, rcond, A, KL, KU, B_expr, equilibrate);
+          }
         }
       }
     
@@ -231,4 +287,44 @@ glue_solve_tri::apply(Mat<eT>& out, const Base<eT,T1>& A_expr, const Base<eT,T2>
 
 
 
+//
+// glue_solve_slices
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_solve_slices::apply(Cube<typename T1::elem_type>& out, const GlueCube<T1,T2,glue_solve_slices>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = glue_solve_slices::apply( out, X.A, X.B );
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("solve(): solution not found for one or more slices");
+    }
+  }
+
+
+
+template<typename eT, typename T1, typename T2>
+inline
+bool
+glue_solve_slices::apply(Cube<eT>& out, const BaseCube<eT,T1>& A_expr, const BaseCube<eT,T2>& B_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube_check<T1> UA(A_expr.get_ref(), out);
+  const unwrap_cube_check<T2> UB(B_expr.get_ref(), out);
+  
+  const bool status = batch_helper::solve(out, UA.M, UB.M);
+  
+  if(status == false)  { out.soft_reset(); }
+  
+  return status;
+  }
+
+
+
 //! @}
@@ -72,6 +72,7 @@ struct glue_times_redirect3_helper<true>
 
 
 
+//! five or more matrices; the order of the multiplications is chosen by mul_chain
 template<uword N>
 struct glue_times_redirect
   {
@@ -114,6 +115,21 @@ class glue_times
   template<typename T1, typename T2>
   arma_hot inline static void apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>& X);
   
+  template<typename T1, typename T2, typename T3>
+  arma_hot inline static void apply(Mat<typename T1::elem_type>& out, const Glue< Glue< Op<T1,op_htrans>, Op<T2,op_diagmat>, glue_times_diag>, T3, glue_times>& X);
+  
+  template<typename T1, typename T2, typename T3>
+  arma_hot inline static void apply(Mat<typename T1::elem_type>& out, const Glue< Glue< T1, Op<T2,op_diagmat>, glue_times_diag>, Op<T3,op_htrans>, glue_times>& X);
+  
+  template<typename T1, typename T2, typename T3>
+  arma_hot inline static void apply(Mat<typename T1::elem_type>& out, const Glue< Glue< Op<T1,op_htrans>, Op<T2,op_diagmat>, glue_times_diag>, Op<T3,op_htrans>, glue_times>& X);
+  
+  template<typename eT, const bool do_trans_A, typename T2>
+  inline static bool apply_weighted_gram(Mat<eT>& out, const Mat<eT>& A, const T2& W, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT, const bool do_trans_A, typename T2>
+  inline static bool apply_weighted_gram(Mat<eT>& out, const Mat<eT>& A, const T2& W, const typename arma_cx_only<eT>::result* junk = 0);
+  
   
   template<typename T1>
   arma_hot inline static void apply_inplace(Mat<typename T1::elem_type>& out, const T1& X);
@@ -149,5 +165,16 @@ class glue_times_diag
 
 
 
+//! slice-wise multiplication of two cubes
+class glue_times_slices
+  {
+  public:
+  
+  template<typename T1, typename T2>
+  inline static void apply(Cube<typename T1::elem_type>& out, const GlueCube<T1, T2, glue_times_slices>& X);
+  };
+
+
+
 //! @}
 
@@ -30,6 +30,14 @@ glue_times_redirect2_helper<do_inv_detect>::apply(Mat<typename T1::elem_type>& o
   
   typedef typename T1::elem_type eT;
   
+  if(fixed_helper::mul_ok<T1,T2>::value)
+    {
+    // sizes of both operands are known at compile time
+    fixed_helper::mul_redirect< fixed_helper::mul_ok<T1,T2>::value >::apply(out, X.A, X.B);
+    
+    return;
+    }
+  
   const partial_unwrap<T1> tmp1(X.A);
   const partial_unwrap<T2> tmp2(X.B);
   
@@ -293,6 +301,18 @@ glue_times_redirect<N>::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2
   
   typedef typename T1::elem_type eT;
   
+  typedef mul_chain_holder< Glue<T1,T2,glue_times> > chain;
+  
+  if(chain::is_fixed == false)
+    {
+    mul_chain_redirect< (chain::is_fixed == false) >::apply(out, X);
+    
+    return;
+    }
+  
+  // chains of small fixed size matrices are evaluated left-to-right,
+  // which allows the use of the fixed size kernels
+  
   const partial_unwrap<T1> tmp1(X.A);
   const partial_unwrap<T2> tmp2(X.B);
   
@@ -438,11 +458,179 @@ glue_times::apply(Mat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>
   
   arma_extra_debug_print(arma_str::format("N_mat = %d") % N_mat);
   
+  typedef mul_chain_holder< Glue<T1,T2,glue_times> > chain;
+  
+  if( chain::has_diag && (chain::n_ops >= 4) )
+    {
+    // the chain is interrupted by diagmat() operands
+    mul_chain_redirect< chain::has_diag && (chain::n_ops >= 4) >::apply(out, X);
+    
+    return;
+    }
+  
   glue_times_redirect<N_mat>::apply(out, X);
   }
 
 
 
+//! trans(A)*diagmat(w)*A, where only one triangle of the symmetric result is computed
+template<typename T1, typename T2, typename T3>
+arma_hot
+inline
+void
+glue_times::apply(Mat<typename T1::elem_type>& out, const Glue< Glue< Op<T1,op_htrans>, Op<T2,op_diagmat>, glue_times_diag>, T3, glue_times>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  if( is_Mat<T1>::value && is_Mat<T3>::value )
+    {
+    const quasi_unwrap<T1> UA(X.A.A.m);
+    const quasi_unwrap<T3> UB(X.B);
+    
+    if( (void_ptr(&(UA.M)) == void_ptr(&(UB.M))) && glue_times::apply_weighted_gram<eT,true>(out, UA.M, X.A.B.m) )  { return; }
+    }
+  
+  glue_times_redirect<2>::apply(out, X);
+  }
+
+
+
+//! A*diagmat(w)*trans(A), where only one triangle of the symmetric result is computed
+template<typename T1, typename T2, typename T3>
+arma_hot
+inline
+void
+glue_times::apply(Mat<typename T1::elem_type>& out, const Glue< Glue< T1, Op<T2,op_diagmat>, glue_times_diag>, Op<T3,op_htrans>, glue_times>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  if( is_Mat<T1>::value && is_Mat<T3>::value )
+    {
+    const quasi_unwrap<T1> UA(X.A.A);
+    const quasi_unwrap<T3> UB(X.B.m);
+    
+    if( (void_ptr(&(UA.M)) == void_ptr(&(UB.M))) && glue_times::apply_weighted_gram<eT,false>(out, UA.M, X.A.B.m) )  { return; }
+    }
+  
+  glue_times_redirect<2>::apply(out, X);
+  }
+
+
+
+//! trans(A)*diagmat(w)*trans(B) is not symmetric in general
+template<typename T1, typename T2, typename T3>
+arma_hot
+inline
+void
+glue_times::apply(Mat<typename T1::elem_type>& out, const Glue< Glue< Op<T1,op_htrans>, Op<T2,op_diagmat>, glue_times_diag>, Op<T3,op_htrans>, glue_times>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  glue_times_redirect<2>::apply(out, X);
+  }
+
+
+
+//! Evaluate trans(A)*diagmat(w)*A (do_trans_A = true) or A*diagmat(w)*trans(A) (do_trans_A = false) for float and double matrices.
+//! For non-negative weights, A is scaled by sqrt(w) and the result is obtained via syrk(),
+//! which computes only one triangle of the output.
+//! Returns false if the fast path is not applicable (eg. negative weights, or integer elements where sqrt(w) is not exact),
+//! in which case the caller must use the general path.
+template<typename eT, const bool do_trans_A, typename T2>
+inline
+bool
+glue_times::apply_weighted_gram(Mat<eT>& out, const Mat<eT>& A, const T2& W_expr, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  if(is_real<eT>::value == false)  { return false; }
+  
+  const diagmat_proxy<T2> W(W_expr);
+  
+  const uword N = (do_trans_A) ? A.n_rows : A.n_cols;  // length of the diagonal
+  
+  if( (W.n_rows != N) || (W.n_cols != N) )  { return false; }
+  
+  podarray<eT> sqrt_w(N);
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const eT w_i = W[i];
+    
+    if( (w_i < eT(0)) || (arma_isfinite(w_i) == false) )  { return false; }
+    
+    sqrt_w[i] = eT( std::sqrt(w_i) );
+    }
+  
+  arma_extra_debug_print("glue_times::apply_weighted_gram()");
+  
+  const uword A_n_rows = A.n_rows;
+  const uword A_n_cols = A.n_cols;
+  
+  Mat<eT> S(A_n_rows, A_n_cols);
+  
+  if(do_trans_A)
+    {
+    // scale each row of A
+    
+    for(uword col=0; col < A_n_cols; ++col)
+      {
+      const eT* A_coldata = A.colptr(col);
+            eT* S_coldata = S.colptr(col);
+      
+      for(uword row=0; row < A_n_rows; ++row)  { S_coldata[row] = A_coldata[row] * sqrt_w[row]; }
+      }
+    }
+  else
+    {
+    // scale each column of A
+    
+    for(uword col=0; col < A_n_cols; ++col)
+      {
+      arrayops::copy( S.colptr(col), A.colptr(col), A_n_rows );
+      
+      arrayops::inplace_mul( S.colptr(col), sqrt_w[col], A_n_rows );
+      }
+    }
+  
+  // A is no longer needed, so out can safely alias A or w
+  
+  const uword out_n = (do_trans_A) ? A_n_cols : A_n_rows;
+  
+  out.set_size(out_n, out_n);
+  
+  if(S.n_elem == 0)  { out.zeros(); return true; }
+  
+  syrk<do_trans_A, false, false>::apply(out, S);
+  
+  return true;
+  }
+
+
+
+template<typename eT, const bool do_trans_A, typename T2>
+inline
+bool
+glue_times::apply_weighted_gram(Mat<eT>& out, const Mat<eT>& A, const T2& W_expr, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(out);
+  arma_ignore(A);
+  arma_ignore(W_expr);
+  arma_ignore(junk);
+  
+  // the conjugate transpose gives a Hermitian result, which is not handled here
+  
+  return false;
+  }
+
+
+
 template<typename T1>
 arma_hot
 inline
@@ -802,6 +990,16 @@ glue_times_diag::apply(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue
   
   typedef typename T1::elem_type eT;
   
+  typedef mul_chain_holder< Glue<T1,T2,glue_times_diag> > chain;
+  
+  if(chain::n_ops >= 4)
+    {
+    // the diagonal matrix is part of a longer chain of multiplications
+    mul_chain_redirect< (chain::n_ops >= 4) >::apply(out, X);
+    
+    return;
+    }
+  
   const strip_diagmat<T1> S1(X.A);
   const strip_diagmat<T2> S2(X.B);
   
@@ -899,4 +1097,23 @@ glue_times_diag::apply(Mat<typename T1::elem_type>& out, const Glue<T1, T2, glue
 
 
 
+//
+// glue_times_slices
+
+
+template<typename T1, typename T2>
+inline
+void
+glue_times_slices::apply(Cube<typename T1::elem_type>& out, const GlueCube<T1, T2, glue_times_slices>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube_check<T1> UA(X.A, out);
+  const unwrap_cube_check<T2> UB(X.B, out);
+  
+  batch_helper::times(out, UA.M, UB.M);
+  }
+
+
+
 //! @}
@@ -0,0 +1,569 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup mul_chain
+//! @{
+
+
+
+//! one operand in a chain of matrix multiplications;
+//! a diagonal matrix is represented by a column vector holding its diagonal
+template<typename eT>
+struct mul_chain_term
+  {
+  const Mat<eT>* M;
+  
+  bool do_trans;
+  bool is_diag;
+  
+  uword n_rows;  // size of the operand as used in the product, ie. after the transpose (if any)
+  uword n_cols;
+  };
+
+
+
+template<typename T1, bool is_diag = strip_diagmat<T1>::do_diagmat>
+struct mul_chain_leaf
+  {
+  typedef typename T1::elem_type eT;
+  
+  const partial_unwrap<T1> U;
+  
+  inline explicit mul_chain_leaf(const T1& X) : U(X) {}
+  
+  inline
+  void
+  get_term(mul_chain_term<eT>& term, eT& alpha, bool& use_alpha, bool& alias, const Mat<eT>& out) const
+    {
+    const bool do_trans = partial_unwrap<T1>::do_trans;
+    
+    term.M        = &(U.M);
+    term.do_trans = do_trans;
+    term.is_diag  = false;
+    term.n_rows   = (do_trans) ? U.M.n_cols : U.M.n_rows;
+    term.n_cols   = (do_trans) ? U.M.n_rows : U.M.n_cols;
+    
+    if(partial_unwrap<T1>::do_times)  { alpha *= U.get_val(); use_alpha = true; }
+    
+    alias = alias || U.is_alias(out);
+    }
+  };
+
+
+
+template<typename T1>
+struct mul_chain_leaf<T1, true>
+  {
+  typedef typename T1::elem_type eT;
+  
+  Col<eT> d;
+  uword   n_rows;
+  uword   n_cols;
+  
+  inline
+  explicit
+  mul_chain_leaf(const T1& X)
+    {
+    const strip_diagmat<T1> S(X);
+    
+    const diagmat_proxy<typename strip_diagmat<T1>::stored_type> P(S.M);
+    
+    n_rows = P.n_rows;
+    n_cols = P.n_cols;
+    
+    const uword N = (std::min)(n_rows, n_cols);
+    
+    d.set_size(N);
+    
+    eT* d_mem = d.memptr();
+    
+    for(uword i=0; i < N; ++i)  { d_mem[i] = P[i]; }
+    }
+  
+  inline
+  void
+  get_term(mul_chain_term<eT>& term, eT&, bool&, bool&, const Mat<eT>&) const
+    {
+    term.M        = &d;
+    term.do_trans = false;
+    term.is_diag  = true;
+    term.n_rows   = n_rows;
+    term.n_cols   = n_cols;
+    }
+  };
+
+
+
+//! Template metaprogram mul_chain_holder
+//! expands the left hand side of each Glue<Tx,Ty,glue_times> and Glue<Tx,Ty,glue_times_diag>,
+//! and holds the unwrapped operands of the chain;
+//! is_fixed indicates that all operands are small fixed size matrices
+template<typename T1>
+struct mul_chain_holder
+  {
+  typedef typename T1::elem_type eT;
+  
+  static const uword n_ops    = 1;
+  static const bool  has_diag = strip_diagmat<T1>::do_diagmat;
+  static const bool  is_fixed = fixed_helper::size_info<T1>::value;
+  
+  const mul_chain_leaf<T1> A;
+  
+  inline explicit mul_chain_holder(const T1& X) : A(X) {}
+  
+  inline
+  void
+  get_terms(mul_chain_term<eT>* terms, eT& alpha, bool& use_alpha, bool& alias, const Mat<eT>& out) const
+    {
+    A.get_term(terms[0], alpha, use_alpha, alias, out);
+    }
+  };
+
+
+
+template<typename T1, typename T2>
+struct mul_chain_holder< Glue<T1,T2,glue_times> >
+  {
+  typedef typename T1::elem_type eT;
+  
+  static const uword n_ops    = mul_chain_holder<T1>::n_ops + 1;
+  static const bool  has_diag = mul_chain_holder<T1>::has_diag || strip_diagmat<T2>::do_diagmat;
+  static const bool  is_fixed = mul_chain_holder<T1>::is_fixed && fixed_helper::size_info<T2>::value;
+  
+  const mul_chain_holder<T1> A;
+  const mul_chain_leaf<T2>   B;
+  
+  inline explicit mul_chain_holder(const Glue<T1,T2,glue_times>& X) : A(X.A), B(X.B) {}
+  
+  inline
+  void
+  get_terms(mul_chain_term<eT>* terms, eT& alpha, bool& use_alpha, bool& alias, const Mat<eT>& out) const
+    {
+    A.get_terms(terms, alpha, use_alpha, alias, out);
+    B.get_term(terms[n_ops-1], alpha, use_alpha, alias, out);
+    }
+  };
+
+
+
+template<typename T1, typename T2>
+struct mul_chain_holder< Glue<T1,T2,glue_times_diag> >
+  {
+  typedef typename T1::elem_type eT;
+  
+  static const uword n_ops    = mul_chain_holder<T1>::n_ops + 1;
+  static const bool  has_diag = true;
+  static const bool  is_fixed = false;
+  
+  const mul_chain_holder<T1> A;
+  const mul_chain_leaf<T2>   B;
+  
+  inline explicit mul_chain_holder(const Glue<T1,T2,glue_times_diag>& X) : A(X.A), B(X.B) {}
+  
+  inline
+  void
+  get_terms(mul_chain_term<eT>* terms, eT& alpha, bool& use_alpha, bool& alias, const Mat<eT>& out) const
+    {
+    A.get_terms(terms, alpha, use_alpha, alias, out);
+    B.get_term(terms[n_ops-1], alpha, use_alpha, alias, out);
+    }
+  };
+
+
+
+//! Evaluation of a chain of matrix multiplications.
+//! The order of the multiplications is chosen at run time via dynamic programming,
+//! so that the total number of multiply-adds is minimised, based on the actual sizes of the operands.
+//! Vectors are handled through their sizes (eg. products with a vector cost as much as a matrix-vector product),
+//! transposed operands are passed to BLAS without being transposed explicitly,
+//! and diagonal matrices are applied as row or column scaling.
+class mul_chain
+  {
+  public:
+  
+  inline
+  static
+  double
+  mul_cost(const uword n_rows, const uword n_inner, const uword n_cols, const bool A_is_diag, const bool B_is_diag)
+    {
+    const double p = double(n_rows);
+    const double q = double(n_inner);
+    const double s = double(n_cols);
+    
+    if( (A_is_diag == false) && (B_is_diag == false) )  { return p*q*s;                           }
+    if( (A_is_diag == true ) && (B_is_diag == true ) )  { return (std::min)(p, (std::min)(q, s)); }
+    
+    return p*s;
+    }
+  
+  
+  //! split[i*N + j] is set to the position k at which the sub-chain [i,j] is split into [i,k] and [k+1,j];
+  //! cost and n_dense are workspaces with N*N and N+1 elements, respectively.
+  //! returns false if the chain is best evaluated left-to-right, in which case split is not set
+  template<typename eT>
+  inline
+  static
+  bool
+  order(uword* split, double* cost, uword* n_dense, const mul_chain_term<eT>* terms, const uword N)
+    {
+    arma_extra_debug_sigprint();
+    
+    // n_dense[i] is the number of non-diagonal operands in [0,i)
+    
+    n_dense[0] = 0;
+    
+    for(uword i=0; i < N; ++i)
+      {
+      n_dense[i+1] = n_dense[i] + ( (terms[i].is_diag) ? uword(0) : uword(1) );
+      
+      cost[i*N + i] = 0.0;
+      }
+    
+    // cost of left-to-right evaluation;
+    // all orders have the same cost if the operands are square matrices of the same size
+    
+    bool   all_same = (n_dense[N] == N);
+    double lr_cost  = 0.0;
+    
+    for(uword j=1; j < N; ++j)
+      {
+      all_same = all_same && (terms[j].n_rows == terms[0].n_rows) && (terms[j].n_cols == terms[0].n_rows);
+      
+      lr_cost += mul_chain::mul_cost(terms[0].n_rows, terms[j].n_rows, terms[j].n_cols, (n_dense[j] == 0), terms[j].is_diag);
+      }
+    
+    all_same = all_same && (terms[0].n_cols == terms[0].n_rows);
+    
+    if( all_same || (lr_cost <= double(4*N*N*N)) )
+      {
+      arma_extra_debug_print("mul_chain::order(): using left-to-right evaluation");
+      
+      return false;
+      }
+    
+    for(uword len=2; len <= N; ++len)
+    for(uword i=0; i <= (N-len); ++i)
+      {
+      const uword j = i + len - 1;
+      
+      double best_cost  = Datum<double>::inf;
+      uword  best_split = j-1;
+      
+      // going downwards, so that ties are resolved as left-to-right evaluation
+      
+      for(uword k_p1=j; k_p1 > i; --k_p1)
+        {
+        const uword k = k_p1-1;
+        
+        const bool A_is_diag = (n_dense[k+1] == n_dense[i  ]);
+        const bool B_is_diag = (n_dense[j+1] == n_dense[k+1]);
+        
+        double mul_cost_k = mul_chain::mul_cost(terms[i].n_rows, terms[k].n_cols, terms[j].n_cols, A_is_diag, B_is_diag);
+        
+        if( (len == 2) && (A_is_diag == false) && (B_is_diag == false) && (terms[i].M == terms[j].M) && (terms[i].do_trans != terms[j].do_trans) )
+          {
+          // A.t()*A and A*A.t() are evaluated via syrk() or herk()
+          mul_cost_k *= 0.5;
+          }
+        
+        const double cost_k = cost[i*N + k] + cost[(k+1)*N + j] + mul_cost_k;
+        
+        if(cost_k < best_cost)  { best_cost = cost_k; best_split = k; }
+        }
+      
+      cost [i*N + j] = best_cost;
+      split[i*N + j] = best_split;
+      }
+    
+    return true;
+    }
+  
+  
+  //! evaluate the sub-chain [i,j];
+  //! intermediate results are stored in store[store_pos], store[store_pos+1], ...
+  template<typename eT>
+  inline
+  static
+  void
+  eval(mul_chain_term<eT>& out, Mat<eT>* store, uword& store_pos, const mul_chain_term<eT>* terms, const uword* split, const uword N, const uword i, const uword j)
+    {
+    arma_extra_debug_sigprint();
+    
+    if(i == j)  { out = terms[i]; return; }
+    
+    const uword k = split[i*N + j];
+    
+    mul_chain_term<eT> A;
+    mul_chain_term<eT> B;
+    
+    mul_chain::eval(A, store, store_pos, terms, split, N, i,   k);
+    mul_chain::eval(B, store, store_pos, terms, split, N, k+1, j);
+    
+    Mat<eT>& tmp = store[store_pos];  ++store_pos;
+    
+    const bool out_is_diag = A.is_diag && B.is_diag;
+    
+    mul_chain::mul(tmp, A, B, eT(0), false, out_is_diag);
+    
+    out.M        = &tmp;
+    out.do_trans = false;
+    out.is_diag  = out_is_diag;
+    out.n_rows   = A.n_rows;
+    out.n_cols   = B.n_cols;
+    }
+  
+  
+  //! out = alpha*A*B, where out must not alias A or B;
+  //! if both A and B are diagonal and out_is_diag is true, only the diagonal of the result is stored
+  template<typename eT>
+  inline
+  static
+  void
+  mul(Mat<eT>& out, const mul_chain_term<eT>& A, const mul_chain_term<eT>& B, const eT alpha, const bool use_alpha, const bool out_is_diag)
+    {
+    arma_extra_debug_sigprint();
+    
+    const uword n_rows = A.n_rows;
+    const uword n_cols = B.n_cols;
+    
+    if( (A.is_diag == false) && (B.is_diag == false) )
+      {
+      mul_chain::mul_dense(out, *(A.M), A.do_trans, *(B.M), B.do_trans, alpha, use_alpha);
+      
+      return;
+      }
+    
+    const eT val = (use_alpha) ? alpha : eT(1);
+    
+    if( (A.is_diag == true) && (B.is_diag == true) )
+      {
+      const uword N = (std::min)( (std::min)(A.M->n_elem, B.M->n_elem), (std::min)(n_rows, n_cols) );
+      
+      const eT* A_mem = A.M->memptr();
+      const eT* B_mem = B.M->memptr();
+      
+      if(out_is_diag)
+        {
+        out.zeros( (std::min)(n_rows, n_cols), 1 );
+        
+        eT* out_mem = out.memptr();
+        
+        for(uword i=0; i < N; ++i)  { out_mem[i] = val * A_mem[i] * B_mem[i]; }
+        }
+      else
+        {
+        out.zeros(n_rows, n_cols);
+        
+        for(uword i=0; i < N; ++i)  { out.at(i,i) = val * A_mem[i] * B_mem[i]; }
+        }
+      
+      return;
+      }
+    
+    out.set_size(n_rows, n_cols);
+    
+    if(A.is_diag)
+      {
+      // scale the rows of B
+      
+      const eT*      d = A.M->memptr();
+      const uword    N = A.M->n_elem;
+      const Mat<eT>& X = *(B.M);
+      
+      for(uword col=0; col < n_cols; ++col)
+        {
+        eT* out_coldata = out.colptr(col);
+        
+        if(B.do_trans)
+          {
+          for(uword i=0; i < N; ++i)  { out_coldata[i] = val * d[i] * access::alt_conj( X.at(col,i) ); }
+          }
+        else
+          {
+          const eT* X_coldata = X.colptr(col);
+          
+          for(uword i=0; i < N; ++i)  { out_coldata[i] = val * d[i] * X_coldata[i]; }
+          }
+        
+        for(uword i=N; i < n_rows; ++i)  { out_coldata[i] = eT(0); }
+        }
+      }
+    else
+      {
+      // scale the columns of A
+      
+      const eT*      d = B.M->memptr();
+      const uword    N = B.M->n_elem;
+      const Mat<eT>& X = *(A.M);
+      
+      for(uword col=0; col < n_cols; ++col)
+        {
+        eT* out_coldata = out.colptr(col);
+        
+        if(col >= N)
+          {
+          arrayops::fill_zeros(out_coldata, n_rows);
+          continue;
+          }
+        
+        const eT d_val = val * d[col];
+        
+        if(A.do_trans)
+          {
+          for(uword i=0; i < n_rows; ++i)  { out_coldata[i] = access::alt_conj( X.at(col,i) ) * d_val; }
+          }
+        else
+          {
+          const eT* X_coldata = X.colptr(col);
+          
+          for(uword i=0; i < n_rows; ++i)  { out_coldata[i] = X_coldata[i] * d_val; }
+          }
+        }
+      }
+    }
+  
+  
+  template<typename eT>
+  inline
+  static
+  void
+  mul_dense(Mat<eT>& out, const Mat<eT>& A, const bool do_trans_A, const Mat<eT>& B, const bool do_trans_B, const eT alpha, const bool use_alpha)
+    {
+    arma_extra_debug_sigprint();
+    
+    if(use_alpha)
+      {
+           if( (do_trans_A == false) && (do_trans_B == false) )  { glue_times::apply<eT, false, false, true>(out, A, B, alpha); }
+      else if( (do_trans_A == true ) && (do_trans_B == false) )  { glue_times::apply<eT, true,  false, true>(out, A, B, alpha); }
+      else if( (do_trans_A == false) && (do_trans_B == true ) )  { glue_times::apply<eT, false, true,  true>(out, A, B, alpha); }
+      else                                                       { glue_times::apply<eT, true,  true,  true>(out, A, B, alpha); }
+      }
+    else
+      {
+           if( (do_trans_A == false) && (do_trans_B == false) )  { glue_times::apply<eT, false, false, false>(out, A, B, alpha); }
+      else if( (do_trans_A == true ) && (do_trans_B == false) )  { glue_times::apply<eT, true,  false, false>(out, A, B, alpha); }
+      else if( (do_trans_A == false) && (do_trans_B == true ) )  { glue_times::apply<eT, false, true,  false>(out, A, B, alpha); }
+      else                                                       { glue_times::apply<eT, true,  true,  false>(out, A, B, alpha); }
+      }
+    }
+  
+  
+  template<typename T1>
+  inline
+  static
+  void
+  apply(Mat<typename T1::elem_type>& out, const T1& X)
+    {
+    arma_extra_debug_sigprint();
+    
+    typedef typename T1::elem_type eT;
+    
+    const uword N = mul_chain_holder<T1>::n_ops;
+    
+    arma_extra_debug_print(arma_str::format("mul_chain::apply(): N = %d") % N);
+    
+    const mul_chain_holder<T1> holder(X);
+    
+    mul_chain_term<eT> terms[N];
+    
+    eT   alpha     = eT(1);
+    bool use_alpha = false;
+    bool alias     = false;
+    
+    holder.get_terms(terms, alpha, use_alpha, alias, out);
+    
+    for(uword i=0; i < (N-1); ++i)
+      {
+      arma_debug_assert_mul_size(terms[i].n_rows, terms[i].n_cols, terms[i+1].n_rows, terms[i+1].n_cols, "matrix multiplication");
+      }
+    
+    uword  split[N*N];
+    double cost [N*N];
+    uword  n_dense[N+1];
+    
+    Mat<eT> store[N-2];
+    
+    mul_chain_term<eT> A;
+    mul_chain_term<eT> B;
+    
+    if(mul_chain::order(split, cost, n_dense, terms, N))
+      {
+      const uword k = split[N-1];
+      
+      uword store_pos = 0;
+      
+      mul_chain::eval(A, store, store_pos, terms, split, N, 0,   k  );
+      mul_chain::eval(B, store, store_pos, terms, split, N, k+1, N-1);
+      }
+    else
+      {
+      // alternate between two buffers, so that their memory can be reused
+      
+      A = terms[0];
+      
+      for(uword j=1; j < (N-1); ++j)
+        {
+        Mat<eT>& tmp = store[j % 2];
+        
+        const bool tmp_is_diag = A.is_diag && terms[j].is_diag;
+        
+        mul_chain::mul(tmp, A, terms[j], eT(0), false, tmp_is_diag);
+        
+        A.M        = &tmp;
+        A.do_trans = false;
+        A.is_diag  = tmp_is_diag;
+        A.n_cols   = terms[j].n_cols;
+        }
+      
+      B = terms[N-1];
+      }
+    
+    if(alias == false)
+      {
+      mul_chain::mul(out, A, B, alpha, use_alpha, false);
+      }
+    else
+      {
+      Mat<eT> tmp;
+      
+      mul_chain::mul(tmp, A, B, alpha, use_alpha, false);
+      
+      out.steal_mem(tmp);
+      }
+    }
+  };
+
+
+
+template<bool use_chain>
+struct mul_chain_redirect
+  {
+  template<typename T1>
+  arma_inline static void apply(Mat<typename T1::elem_type>&, const T1&) {}
+  };
+
+
+
+template<>
+struct mul_chain_redirect<true>
+  {
+  template<typename T1>
+  inline static void apply(Mat<typename T1::elem_type>& out, const T1& X) { mul_chain::apply(out, X); }
+  };
+
+
+
+//! @}
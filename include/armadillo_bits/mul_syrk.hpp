@@ -220,48 +220,122 @@ class syrk_emul
     else
     if(do_trans_A == true)
       {
-      const uword A_n_rows = A.n_rows;
       const uword A_n_cols = A.n_cols;
       
-      for(uword col_A=0; col_A < A_n_cols; ++col_A)
+      #if defined(ARMA_USE_OPENMP)
         {
-        // col_A is interpreted as row_A when storing the results in matrix C
-        
-        const eT* A_coldata = A.colptr(col_A);
-        
-        for(uword k=col_A; k < A_n_cols; ++k)
+        if( (A_n_cols >= 8) && mp_gate<eT>::eval(A.n_elem) )
           {
-          const eT acc = op_dot::direct_dot_arma(A_n_rows, A_coldata, A.colptr(k));
+          const int n_threads = mp_thread_limit::get();
           
-          if( (use_alpha == false) && (use_beta == false) )
-            {
-            C.at(col_A, k) = acc;
-            C.at(k, col_A) = acc;
-            }
-          else
-          if( (use_alpha == true ) && (use_beta == false) )
-            {
-            const eT val = alpha*acc;
-            
-            C.at(col_A, k) = val;
-            C.at(k, col_A) = val;
-            }
-          else
-          if( (use_alpha == false) && (use_beta == true ) )
-            {
-                              C.at(col_A, k) = acc + beta*C.at(col_A, k);
-            if(col_A != k)  { C.at(k, col_A) = acc + beta*C.at(k, col_A); }
-            }
-          else
-          if( (use_alpha == true ) && (use_beta == true ) )
+          // the amount of work decreases with col_A, so columns are dealt out round-robin
+          
+          #pragma omp parallel for schedule(static,1) num_threads(n_threads)
+          for(uword col_A=0; col_A < A_n_cols; ++col_A)
             {
-            const eT val = alpha*acc;
-            
-                              C.at(col_A, k) = val + beta*C.at(col_A, k);
-            if(col_A != k)  { C.at(k, col_A) = val + beta*C.at(k, col_A); }
+            syrk_emul<do_trans_A, use_alpha, use_beta>::apply_col(C, A, col_A, alpha, beta);
             }
+          
+          return;
           }
         }
+      #endif
+      
+      for(uword col_A=0; col_A < A_n_cols; ++col_A)
+        {
+        syrk_emul<do_trans_A, use_alpha, use_beta>::apply_col(C, A, col_A, alpha, beta);
+        }
+      }
+    }
+  
+  
+  
+  //! compute row col_A of the upper triangle of A^T * A, and mirror it into the lower triangle;
+  //! four columns of A are processed at a time, so that each element of column col_A is loaded once per four dot products
+  template<typename eT, typename TA>
+  arma_hot
+  inline
+  static
+  void
+  apply_col(Mat<eT>& C, const TA& A, const uword col_A, const eT alpha, const eT beta)
+    {
+    const uword A_n_rows = A.n_rows;
+    const uword A_n_cols = A.n_cols;
+    
+    const eT* A_coldata = A.colptr(col_A);
+    
+    uword k = col_A;
+    
+    for(; (k+3) < A_n_cols; k+=4)
+      {
+      const eT* B0 = A.colptr(k  );
+      const eT* B1 = A.colptr(k+1);
+      const eT* B2 = A.colptr(k+2);
+      const eT* B3 = A.colptr(k+3);
+      
+      eT acc0 = eT(0);
+      eT acc1 = eT(0);
+      eT acc2 = eT(0);
+      eT acc3 = eT(0);
+      
+      for(uword row=0; row < A_n_rows; ++row)
+        {
+        const eT val = A_coldata[row];
+        
+        acc0 += val * B0[row];
+        acc1 += val * B1[row];
+        acc2 += val * B2[row];
+        acc3 += val * B3[row];
+        }
+      
+      syrk_emul<do_trans_A, use_alpha, use_beta>::store(C, col_A, k,   acc0, alpha, beta);
+      syrk_emul<do_trans_A, use_alpha, use_beta>::store(C, col_A, k+1, acc1, alpha, beta);
+      syrk_emul<do_trans_A, use_alpha, use_beta>::store(C, col_A, k+2, acc2, alpha, beta);
+      syrk_emul<do_trans_A, use_alpha, use_beta>::store(C, col_A, k+3, acc3, alpha, beta);
+      }
+    
+    for(; k < A_n_cols; ++k)
+      {
+      const eT acc = op_dot::direct_dot_arma(A_n_rows, A_coldata, A.colptr(k));
+      
+      syrk_emul<do_trans_A, use_alpha, use_beta>::store(C, col_A, k, acc, alpha, beta);
+      }
+    }
+  
+  
+  
+  template<typename eT>
+  arma_inline
+  static
+  void
+  store(Mat<eT>& C, const uword i, const uword k, const eT acc, const eT alpha, const eT beta)
+    {
+    if( (use_alpha == false) && (use_beta == false) )
+      {
+      C.at(i, k) = acc;
+      C.at(k, i) = acc;
+      }
+    else
+    if( (use_alpha == true ) && (use_beta == false) )
+      {
+      const eT val = alpha*acc;
+      
+      C.at(i, k) = val;
+      C.at(k, i) = val;
+      }
+    else
+    if( (use_alpha == false) && (use_beta == true ) )
+      {
+                    C.at(i, k) = acc + beta*C.at(i, k);
+      if(i != k)  { C.at(k, i) = acc + beta*C.at(k, i); }
+      }
+    else
+    if( (use_alpha == true ) && (use_beta == true ) )
+      {
+      const eT val = alpha*acc;
+      
+                    C.at(i, k) = val + beta*C.at(i, k);
+      if(i != k)  { C.at(k, i) = val + beta*C.at(k, i); }
       }
     }
   
@@ -0,0 +1,42 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+//! This class implements the eigen solver for general real matrices in the shift-invert mode, with a real shift.
+//! The operator must compute y = inv(A - sigma*I) * x (or y = inv(A - sigma*B) * B * x),
+//! whose largest eigenvalues nu are mapped back to the eigenvalues of A via lambda = sigma + 1/nu.
+template<typename eT, int SelectionRule, typename OpType>
+class GenEigsRealShiftSolver : public GenEigsSolver<eT, SelectionRule, OpType>
+  {
+  protected:
+  
+  const eT sigma;
+  
+  // map the Ritz values back to the original problem before sorting
+  inline void sort_ritzpair();
+  
+  
+  public:
+  
+  //! Constructor to create a solver object.
+  inline GenEigsRealShiftSolver(const OpType& op_, uword nev_, uword ncv_, const eT sigma_);
+  };
+
+
+}  // namespace newarp
@@ -0,0 +1,45 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+template<typename eT, int SelectionRule, typename OpType>
+inline
+void
+GenEigsRealShiftSolver<eT, SelectionRule, OpType>::sort_ritzpair()
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword i=0; i < this->nev; ++i)  { this->ritz_val(i) = sigma + eT(1) / this->ritz_val(i); }
+  
+  GenEigsSolver<eT, SelectionRule, OpType>::sort_ritzpair();
+  }
+
+
+
+template<typename eT, int SelectionRule, typename OpType>
+inline
+GenEigsRealShiftSolver<eT, SelectionRule, OpType>::GenEigsRealShiftSolver(const OpType& op_, uword nev_, uword ncv_, const eT sigma_)
+  : GenEigsSolver<eT, SelectionRule, OpType>(op_, nev_, ncv_)
+  , sigma(sigma_)
+  {
+  arma_extra_debug_sigprint();
+  }
+
+
+}  // namespace newarp
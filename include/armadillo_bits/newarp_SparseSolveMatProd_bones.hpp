@@ -0,0 +1,56 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+//! Define matrix operations for the shift-invert and generalised modes:
+//! y = inv(M) * K * x, or y = inv(M) * x when K is not given.
+//! M is factorised once, so that each operation mostly costs two triangular solves.
+template<typename eT>
+class SparseSolveMatProd
+  {
+  private:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const SpMat<eT>  op_M;     // matrix to be inverted
+  const SpMat<eT>* op_K;     // optional matrix multiplied before the solve
+  
+  sp_precond<eT>       fac;       // LU factors of M (or of a slightly shifted M), also used as preconditioner
+  sp_krylov_matvec<eT> M_matvec;
+  T                    M_norm;
+  T                    tol;
+  iterative_opts       gmres_opts;
+  
+  inline void init();
+  inline void solve(eT* y_out, const Col<eT>& b) const;
+  
+  
+  public:
+  
+  const uword n_rows;  // number of rows of the underlying matrix
+  const uword n_cols;  // number of columns of the underlying matrix
+  
+  inline SparseSolveMatProd(const SpMat<eT>& M, const bool M_is_sym);
+  inline SparseSolveMatProd(const SpMat<eT>& M, const bool M_is_sym, const SpMat<eT>& K);
+  
+  inline void perform_op(eT* x_in, eT* y_out) const;
+  };
+
+
+}  // namespace newarp
@@ -0,0 +1,147 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+namespace newarp
+{
+
+
+template<typename eT>
+inline
+SparseSolveMatProd<eT>::SparseSolveMatProd(const SpMat<eT>& M, const bool M_is_sym)
+  : op_M(M)
+  , op_K(NULL)
+  , M_matvec(op_M, M_is_sym)
+  , M_norm(T(0))
+  , tol(T(0))
+  , n_rows(M.n_rows)
+  , n_cols(M.n_cols)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (op_M.n_rows != op_M.n_cols), "newarp::SparseSolveMatProd: given matrix must be square sized" );
+  
+  init();
+  }
+
+
+
+template<typename eT>
+inline
+SparseSolveMatProd<eT>::SparseSolveMatProd(const SpMat<eT>& M, const bool M_is_sym, const SpMat<eT>& K)
+  : op_M(M)
+  , op_K(&K)
+  , M_matvec(op_M, M_is_sym)
+  , M_norm(T(0))
+  , tol(T(0))
+  , n_rows(M.n_rows)
+  , n_cols(M.n_cols)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (op_M.n_rows != op_M.n_cols), "newarp::SparseSolveMatProd: given matrix must be square sized" );
+  arma_debug_check( ((K.n_rows != n_rows) || (K.n_cols != n_cols)), "newarp::SparseSolveMatProd: given matrices must have the same size" );
+  
+  init();
+  }
+
+
+
+template<typename eT>
+inline
+void
+SparseSolveMatProd<eT>::init()
+  {
+  arma_extra_debug_sigprint();
+  
+  const T eps = std::numeric_limits<T>::epsilon();
+  
+  M_norm = norm(op_M, 1);
+  tol    = std::pow(eps, T(2) / T(3));
+  
+  gmres_opts.tol      = double(tol);
+  gmres_opts.max_iter = (unsigned int)( 10 * (std::max)(uword(100), n_rows) );
+  
+  // without dropping and with unlimited fill, ILUT is a complete LU factorisation without pivoting.
+  // It fails on a zero pivot, in which case the diagonal is shifted by a small amount
+  // and the factors are only used as a preconditioner.
+  
+  if(fac.factorise(op_M, "ilut", 0.0, n_rows))  { return; }
+  
+  const T delta = std::sqrt(std::sqrt(eps)) * (std::max)( T(1), M_norm );
+  
+  const SpMat<eT> M_shifted = op_M + eT(delta) * speye< SpMat<eT> >(n_rows, n_cols);
+  
+  if(fac.factorise(M_shifted, "ilut", 0.0, n_rows) == false)  { fac.reset(); }
+  }
+
+
+
+//! Solve M*y = b via the LU factors.  A factorisation without pivoting can lose accuracy
+//! on small pivots, so the backward error of the result is checked with one multiplication by M;
+//! when it is too large, the result is refined via GMRES, preconditioned by the same factors.
+template<typename eT>
+inline
+void
+SparseSolveMatProd<eT>::solve(eT* y_out, const Col<eT>& b) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<eT> y(y_out, n_rows, false, true);
+  
+  if(fac.is_empty())  { y.zeros(); }  else  { fac.apply(y, b); }
+  
+  Col<eT> r(n_rows);
+  
+  M_matvec.apply(r, y);
+  
+  r = b - r;
+  
+  if( norm(r, 2) <= tol * (M_norm * norm(y, 2) + norm(b, 2)) )  { return; }
+  
+  uword n_iter    = 0;
+  T     rel_resid = T(0);
+  
+  const bool status = sp_krylov::solve_col(y, n_iter, rel_resid, M_matvec, b, fac, 'g', gmres_opts);
+  
+  if(status == false)  { arma_stop_runtime_error("newarp::SparseSolveMatProd: iterative solver did not converge"); }
+  }
+
+
+
+// Perform the operation y = inv(M) * K * x
+template<typename eT>
+inline
+void
+SparseSolveMatProd<eT>::perform_op(eT* x_in, eT* y_out) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const Col<eT> x(x_in, n_cols, false, true);
+  
+  if(op_K == NULL)
+    {
+    solve(y_out, x);
+    }
+  else
+    {
+    const Col<eT> Kx = (*op_K) * x;
+    
+    solve(y_out, Kx);
+    }
+  }
+
+
+}  // namespace newarp
@@ -32,4 +32,32 @@ class op_chol
 
 
 
+//! slice-wise Cholesky decomposition of a cube
+class op_chol_slices
+  {
+  public:
+  
+  template<typename T1>
+  inline static void apply(Cube<typename T1::elem_type>& out, const OpCube<T1,op_chol_slices>& X);
+  
+  template<typename T1>
+  inline static bool apply_direct(Cube<typename T1::elem_type>& out, const BaseCube<typename T1::elem_type,T1>& A_expr, const uword layout);
+  };
+
+
+
+//! rank-1 update and downdate of a Cholesky factor
+class op_chol_update
+  {
+  public:
+  
+  template<typename T1>
+  inline static bool apply_direct(Mat<typename T1::elem_type>& R, const Base<typename T1::elem_type,T1>& X, const bool downdate, const uword layout);
+  
+  template<typename eT>
+  inline static bool apply_upper(Mat<eT>& R, const eT* x_mem, const bool downdate);
+  };
+
+
+
 //! @}
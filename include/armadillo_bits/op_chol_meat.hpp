@@ -61,4 +61,138 @@ op_chol::apply_direct(Mat<typename T1::elem_type>& out, const Base<typename T1::
 
 
 
+template<typename T1>
+inline
+void
+op_chol_slices::apply(Cube<typename T1::elem_type>& out, const OpCube<T1,op_chol_slices>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = op_chol_slices::apply_direct(out, X.m, X.aux_uword_a);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("chol(): decomposition failed for one or more slices");
+    }
+  }
+
+
+
+template<typename T1>
+inline
+bool
+op_chol_slices::apply_direct(Cube<typename T1::elem_type>& out, const BaseCube<typename T1::elem_type,T1>& A_expr, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  out = A_expr.get_ref();
+  
+  return batch_helper::chol(out, layout);
+  }
+
+
+
+//
+// op_chol_update
+
+
+template<typename T1>
+inline
+bool
+op_chol_update::apply_direct(Mat<typename T1::elem_type>& R, const Base<typename T1::elem_type,T1>& X, const bool downdate, const uword layout)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>& x     = U.M;
+  
+  arma_debug_check( (R.is_square() == false), "chol_update(): given matrix must be square sized" );
+  
+  arma_debug_check( ( ((x.is_vec() == false) && (x.is_empty() == false)) || (x.n_elem != R.n_rows) ), "chol_update(): size mismatch between given matrix and vector" );
+  
+  if(R.is_empty())  { return true; }
+  
+  // work on a copy, so that R is unchanged if the downdate fails;
+  // for the lower layout, L is converted to the equivalent upper factor L^H
+  
+  Mat<eT> W;
+  
+  if(layout == 0)  { W = R; }  else  { op_htrans::apply_mat_noalias(W, R); }
+  
+  const bool status = op_chol_update::apply_upper(W, x.memptr(), downdate);
+  
+  if(status == false)  { return false; }
+  
+  if(layout == 0)  { R.steal_mem(W); }  else  { op_htrans::apply_mat_noalias(R, W); }
+  
+  return true;
+  }
+
+
+
+//! Rank-1 update R^H R + x x^H (or downdate R^H R - x x^H) of an upper triangular Cholesky factor R.
+//! The rows of R are rotated against w = x^H via Givens rotations (hyperbolic rotations for downdates);
+//! R is processed column by column, with the rotations for the previous columns kept in c and s.
+//! Returns false if the downdated matrix is not positive definite.
+template<typename eT>
+inline
+bool
+op_chol_update::apply_upper(Mat<eT>& R, const eT* x_mem, const bool downdate)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = R.n_rows;
+  
+  podarray<T>  c(N);
+  podarray<eT> s(N);
+  
+  for(uword j=0; j < N; ++j)
+    {
+    eT* R_colptr = R.colptr(j);
+    
+    eT w = access::alt_conj(x_mem[j]);
+    
+    for(uword k=0; k < j; ++k)
+      {
+      const eT R_kj = R_colptr[k];
+      
+      R_colptr[k] = (downdate) ? (c[k]*R_kj - access::alt_conj(s[k])*w) : (c[k]*R_kj + access::alt_conj(s[k])*w);
+      
+      w = c[k]*w - s[k]*R_kj;
+      }
+    
+    const T R_jj  = access::tmp_real(R_colptr[j]);
+    const T w_abs = std::abs(w);
+    
+    const T r_sq = (downdate) ? ((R_jj - w_abs) * (R_jj + w_abs)) : (R_jj*R_jj + w_abs*w_abs);
+    
+    if( (downdate) && ((r_sq <= T(0)) || (arma_isfinite(r_sq) == false)) )  { return false; }
+    
+    if(r_sq <= T(0))
+      {
+      // R_jj and w are both zero
+      c[j] = T(1);
+      s[j] = eT(0);
+      
+      continue;
+      }
+    
+    const T r = std::sqrt(r_sq);
+    
+    c[j] = R_jj / r;
+    s[j] = w    / r;
+    
+    R_colptr[j] = eT(r);
+    }
+  
+  return true;
+  }
+
+
+
 //! @}
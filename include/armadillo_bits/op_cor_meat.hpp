@@ -42,14 +42,37 @@ op_cor::direct_cor(Mat<eT>& out, const Mat<eT>& A, const uword norm_type)
     {
     const uword N = A.n_rows;
     const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-
-    const Row<eT> acc = sum(A);
-    const Row<eT> sd  = stddev(A);
-
-    out = (trans(A) * A);
-    out -= (trans(acc) * acc)/eT(N);
-    out /= norm_val;
-    out /= trans(sd) * sd;
+    
+    // the standard deviations are obtained from the diagonal of the centred cross-product,
+    // using the default normalisation of stddev()
+    const eT sd_norm_val = (N > 1) ? eT(N-1) : eT(1);
+    
+    Mat<eT> B;
+    
+    op_cov::direct_centre(B, A);
+    
+    if(B.is_empty())
+      {
+      out.zeros(A.n_cols, A.n_cols);
+      }
+    else
+      {
+      out.set_size(A.n_cols, A.n_cols);
+      
+      syrk<true, false, false>::apply(out, B);
+      }
+    
+    const uword n = out.n_rows;
+    
+    podarray<eT> sd(n);
+    
+    for(uword i=0; i < n; ++i)  { sd[i] = std::sqrt(out.at(i,i) / sd_norm_val); }
+    
+    for(uword col=0; col < n; ++col)
+    for(uword row=0; row < n; ++row)
+      {
+      out.at(row,col) /= (norm_val * sd[row] * sd[col]);
+      }
     }
   }
 
@@ -78,17 +101,36 @@ op_cor::direct_cor(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& A,
   else
     {
     const uword N = A.n_rows;
-    const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-
-    const Row<eT> acc = sum(A);
-    const Row<T>  sd  = stddev(A);
-
-    out = trans(A) * A;               // out = strans(conj(A)) * A;
-    out -= (trans(acc) * acc)/eT(N);  // out -= (strans(conj(acc)) * acc)/eT(N);
-    out /= norm_val;
-
-    //out = out / (trans(sd) * sd);
-    out /= conv_to< Mat<eT> >::from(trans(sd) * sd);
+    const T norm_val = (norm_type == 0) ? ( (N > 1) ? T(N-1) : T(1) ) : T(N);
+    
+    const T sd_norm_val = (N > 1) ? T(N-1) : T(1);
+    
+    Mat<eT> B;
+    
+    op_cov::direct_centre(B, A);
+    
+    if(B.is_empty())
+      {
+      out.zeros(A.n_cols, A.n_cols);
+      }
+    else
+      {
+      out.set_size(A.n_cols, A.n_cols);
+      
+      herk<true, false, false>::apply(out, B);  // out = strans(conj(B)) * B;
+      }
+    
+    const uword n = out.n_rows;
+    
+    podarray<T> sd(n);
+    
+    for(uword i=0; i < n; ++i)  { sd[i] = std::sqrt(std::real(out.at(i,i)) / sd_norm_val); }
+    
+    for(uword col=0; col < n; ++col)
+    for(uword row=0; row < n; ++row)
+      {
+      out.at(row,col) /= (norm_val * sd[row] * sd[col]);
+      }
     }
   }
 
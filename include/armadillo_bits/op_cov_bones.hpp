@@ -28,6 +28,8 @@ class op_cov
   template<typename  T> inline static void direct_cov(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& X, const uword norm_type);
   
   template<typename T1> inline static void apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cov>& in);
+  
+  template<typename eT> inline static void direct_centre(Mat<eT>& out, const Mat<eT>& X);
   };
 
 
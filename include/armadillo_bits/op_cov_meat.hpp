@@ -42,11 +42,25 @@ op_cov::direct_cov(Mat<eT>& out, const Mat<eT>& A, const uword norm_type)
     {
     const uword N = A.n_rows;
     const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
-
-    const Row<eT> acc = sum(A);
-
-    out = trans(A) * A;
-    out -= (trans(acc) * acc)/eT(N);
+    
+    // compute only the upper triangle of trans(B)*B, where B has centred columns;
+    // this avoids the cancellation in trans(A)*A - trans(sum(A))*sum(A)/N
+    
+    Mat<eT> B;
+    
+    op_cov::direct_centre(B, A);
+    
+    if(B.is_empty())
+      {
+      out.zeros(A.n_cols, A.n_cols);
+      }
+    else
+      {
+      out.set_size(A.n_cols, A.n_cols);
+      
+      syrk<true, false, false>::apply(out, B);
+      }
+    
     out /= norm_val;
     }
   }
@@ -82,10 +96,21 @@ op_cov::direct_cov(Mat< std::complex<T> >& out, const Mat< std::complex<T> >& A,
     const uword N = A.n_rows;
     const eT norm_val = (norm_type == 0) ? ( (N > 1) ? eT(N-1) : eT(1) ) : eT(N);
     
-    const Row<eT> acc = sum(A);
+    Mat<eT> B;
+    
+    op_cov::direct_centre(B, A);
+    
+    if(B.is_empty())
+      {
+      out.zeros(A.n_cols, A.n_cols);
+      }
+    else
+      {
+      out.set_size(A.n_cols, A.n_cols);
+      
+      herk<true, false, false>::apply(out, B);  // out = strans(conj(B)) * B;
+      }
     
-    out = trans(A) * A;               // out = strans(conj(A)) * A;
-    out -= (trans(acc) * acc)/eT(N);  // out -= (strans(conj(acc)) * acc)/eT(N);
     out /= norm_val;
     }
   }
@@ -111,4 +136,54 @@ op_cov::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_cov>& in)
 
 
 
+//! subtract the mean of each column from all elements of the column
+template<typename eT>
+inline
+void
+op_cov::direct_centre(Mat<eT>& out, const Mat<eT>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  const uword X_n_cols = X.n_cols;
+  
+  out.set_size(X_n_rows, X_n_cols);
+  
+  if(X_n_rows == 0)  { return; }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (X_n_cols > 1) && mp_gate<eT>::eval(X.n_elem) )
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        const eT* X_colmem = X.colptr(col);
+              eT* out_colmem = out.colptr(col);
+        
+        const eT mean_val = op_mean::direct_mean(X_colmem, X_n_rows);
+        
+        for(uword row=0; row < X_n_rows; ++row)  { out_colmem[row] = X_colmem[row] - mean_val; }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    const eT*   X_colmem = X.colptr(col);
+          eT* out_colmem = out.colptr(col);
+    
+    const eT mean_val = op_mean::direct_mean(X_colmem, X_n_rows);
+    
+    for(uword row=0; row < X_n_rows; ++row)  { out_colmem[row] = X_colmem[row] - mean_val; }
+    }
+  }
+
+
+
 //! @}
@@ -30,6 +30,27 @@ class op_index_max
   template<typename eT>
   inline static void apply_noalias(Mat<uword>& out, const Mat<eT>& X, const uword dim);
   
+  template<typename eT>
+  inline static void apply(Mat<uword>& out, const mtOp<uword,subview<eT>,op_index_max>& in);
+  
+  template<typename eT>
+  inline static void apply_noalias(Mat<uword>& out, const subview<eT>& X, const uword dim);
+  
+  template<typename eT>
+  inline static void apply_noalias_mem(Mat<uword>& out, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride, const uword dim);
+  
+  template<typename eT>
+  inline static void direct_index_max_cols(uword* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride);
+  
+  template<typename eT>
+  inline static void direct_index_max_rows(uword* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride);
+  
+  template<typename eT>
+  inline static void direct_index_max_rows_range(uword* out_mem, const eT* X_mem, const uword X_n_cols, const uword X_stride, const uword row_start, const uword row_end_p1, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void direct_index_max_rows_range(uword* out_mem, const eT* X_mem, const uword X_n_cols, const uword X_stride, const uword row_start, const uword row_end_p1, const typename arma_cx_only<eT>::result* junk = 0);
+  
   
   // cubes
   
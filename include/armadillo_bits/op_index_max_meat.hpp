@@ -57,8 +57,62 @@ op_index_max::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const uword dim)
   {
   arma_extra_debug_sigprint();
   
-  const uword X_n_rows = X.n_rows;
-  const uword X_n_cols = X.n_cols;
+  op_index_max::apply_noalias_mem(out, X.memptr(), X.n_rows, X.n_cols, X.n_rows, dim);
+  }
+
+
+
+//! index_max() of a subview, without extracting the subview into a separate matrix
+template<typename eT>
+inline
+void
+op_index_max::apply(Mat<uword>& out, const mtOp<uword,subview<eT>,op_index_max>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword dim = in.aux_uword_a;
+  arma_debug_check( (dim > 1), "index_max(): parameter 'dim' must be 0 or 1");
+  
+  // out is a Mat<uword>, so aliasing is only possible when eT is uword
+  
+  if(void_ptr(&(in.m.m)) != void_ptr(&out))
+    {
+    op_index_max::apply_noalias(out, in.m, dim);
+    }
+  else
+    {
+    Mat<uword> tmp;
+    
+    op_index_max::apply_noalias(tmp, in.m, dim);
+    
+    out.steal_mem(tmp);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_index_max::apply_noalias(Mat<uword>& out, const subview<eT>& X, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  const eT* X_mem = X.colptr(0);
+  
+  op_index_max::apply_noalias_mem(out, X_mem, X.n_rows, X.n_cols, X.m.n_rows, dim);
+  }
+
+
+
+//! find the index of the maximum along each column (dim=0) or each row (dim=1) of a matrix stored in column-major memory,
+//! where consecutive columns are separated by X_stride elements
+template<typename eT>
+inline
+void
+op_index_max::apply_noalias_mem(Mat<uword>& out, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride, const uword dim)
+  {
+  arma_extra_debug_sigprint();
   
   if(dim == 0)
     {
@@ -68,12 +122,7 @@ op_index_max::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const uword dim)
     
     if(X_n_rows == 0)  { return; }
     
-    uword* out_mem = out.memptr();
-    
-    for(uword col=0; col < X_n_cols; ++col)
-      {
-      op_max::direct_max( X.colptr(col), X_n_rows, out_mem[col] );
-      }
+    op_index_max::direct_index_max_cols(out.memptr(), X_mem, X_n_rows, X_n_cols, X_stride);
     }
   else
   if(dim == 1)
@@ -84,11 +133,149 @@ op_index_max::apply_noalias(Mat<uword>& out, const Mat<eT>& X, const uword dim)
     
     if(X_n_cols == 0)  { return; }
     
-    uword* out_mem = out.memptr();
+    op_index_max::direct_index_max_rows(out.memptr(), X_mem, X_n_rows, X_n_cols, X_stride);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_index_max::direct_index_max_cols(uword* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (X_n_cols >= 2) && mp_gate<eT>::eval(X_n_rows * X_n_cols) )
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        op_max::direct_max( &(X_mem[col*X_stride]), X_n_rows, out_mem[col] );
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    op_max::direct_max( &(X_mem[col*X_stride]), X_n_rows, out_mem[col] );
+    }
+  }
+
+
+
+//! find the index of the maximum of each row, by traversing the columns;
+//! when possible, blocks of rows are processed by separate threads
+template<typename eT>
+inline
+void
+op_index_max::direct_index_max_rows(uword* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int   n_threads = mp_thread_limit::get();
+    const uword n_chunks  = uword(n_threads);
     
-    for(uword row=0; row<X_n_rows; ++row)
+    if( (n_threads >= 2) && (X_n_rows >= 16*n_chunks) && mp_gate<eT>::eval(X_n_rows * X_n_cols) )
       {
-      out_mem[row] = X.row(row).index_max();
+      const uword chunk_size = X_n_rows / n_chunks;
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const uword row_start  = chunk * chunk_size;
+        const uword row_end_p1 = (chunk == (n_chunks-1)) ? X_n_rows : (row_start + chunk_size);
+        
+        op_index_max::direct_index_max_rows_range(out_mem, X_mem, X_n_cols, X_stride, row_start, row_end_p1);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  op_index_max::direct_index_max_rows_range(out_mem, X_mem, X_n_cols, X_stride, uword(0), X_n_rows);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_index_max::direct_index_max_rows_range(uword* out_mem, const eT* X_mem, const uword X_n_cols, const uword X_stride, const uword row_start, const uword row_end_p1, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_ignore(junk);
+  
+  const uword N = row_end_p1 - row_start;
+  
+  podarray<eT> tmp(N);
+  
+  eT*    tmp_mem = tmp.memptr();
+  uword* out_ptr = &(out_mem[row_start]);
+  
+  arrayops::inplace_set(tmp_mem, priv::most_neg<eT>(), N);
+  arrayops::fill_zeros(out_ptr, N);
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    const eT* col_mem = &(X_mem[col*X_stride + row_start]);
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const eT val = col_mem[i];
+      
+      if(val > tmp_mem[i])
+        {
+        tmp_mem[i] = val;
+        out_ptr[i] = col;
+        }
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_index_max::direct_index_max_rows_range(uword* out_mem, const eT* X_mem, const uword X_n_cols, const uword X_stride, const uword row_start, const uword row_end_p1, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_ignore(junk);
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = row_end_p1 - row_start;
+  
+  podarray<T> tmp(N);
+  
+  T*     tmp_mem = tmp.memptr();
+  uword* out_ptr = &(out_mem[row_start]);
+  
+  arrayops::inplace_set(tmp_mem, priv::most_neg<T>(), N);
+  arrayops::fill_zeros(out_ptr, N);
+  
+  for(uword col=0; col < X_n_cols; ++col)
+    {
+    const eT* col_mem = &(X_mem[col*X_stride + row_start]);
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const T val = std::abs( col_mem[i] );
+      
+      if(val > tmp_mem[i])
+        {
+        tmp_mem[i] = val;
+        out_ptr[i] = col;
+        }
       }
     }
   }
@@ -143,15 +330,9 @@ op_index_max::apply_noalias(Cube<uword>& out, const Cube<eT>& X, const uword dim
     
     if(out.is_empty() || X.is_empty())  { return; }
     
-    for(uword slice=0; slice < X_n_slices; ++slice)
-      {
-      uword* out_mem = out.slice_memptr(slice);
-      
-      for(uword col=0; col < X_n_cols; ++col)
-        {
-        op_max::direct_max( X.slice_colptr(slice,col), X_n_rows, out_mem[col] );
-        }
-      }
+    // treat the cube as a matrix with X_n_cols*X_n_slices columns
+    
+    op_index_max::direct_index_max_cols(out.memptr(), X.memptr(), X_n_rows, X_n_cols*X_n_slices, X_n_rows);
     }
   else
   if(dim == 1)
@@ -162,32 +343,27 @@ op_index_max::apply_noalias(Cube<uword>& out, const Cube<eT>& X, const uword dim
     
     if(out.is_empty() || X.is_empty())  { return; }
     
-    Col<eT> tmp(X_n_rows);
-    
-    eT* tmp_mem = tmp.memptr();
-    
-    for(uword slice=0; slice < X_n_slices; ++slice)
+    #if defined(ARMA_USE_OPENMP)
       {
-      uword* out_mem = out.slice_memptr(slice);
-      
-      arrayops::copy(tmp_mem, X.slice_colptr(slice,0), X_n_rows);
-      
-      for(uword col=1; col < X_n_cols; ++col)
+      if( (X_n_slices >= 2) && mp_gate<eT>::eval(X.n_elem) )
         {
-        const eT* col_mem = X.slice_colptr(slice,col);
+        const int n_threads = mp_thread_limit::get();
         
-        for(uword row=0; row < X_n_rows; ++row)
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword slice=0; slice < X_n_slices; ++slice)
           {
-          const eT val = col_mem[row];
-          
-          if(val > tmp_mem[row])
-            {
-            tmp_mem[row] = val;
-            out_mem[row] = col;
-            }
+          op_index_max::direct_index_max_rows_range(out.slice_memptr(slice), X.slice_memptr(slice), X_n_cols, X_n_rows, uword(0), X_n_rows);
           }
+        
+        return;
         }
       }
+    #endif
+    
+    for(uword slice=0; slice < X_n_slices; ++slice)
+      {
+      op_index_max::direct_index_max_rows(out.slice_memptr(slice), X.slice_memptr(slice), X_n_rows, X_n_cols, X_n_rows);
+      }
     }
   else
   if(dim == 2)
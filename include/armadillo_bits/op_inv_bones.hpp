@@ -58,4 +58,18 @@ class op_inv_sympd
 
 
 
+//! slice-wise inverse of a cube
+class op_inv_slices
+  {
+  public:
+  
+  template<typename T1>
+  inline static void apply(Cube<typename T1::elem_type>& out, const OpCube<T1,op_inv_slices>& in);
+  
+  template<typename T1>
+  inline static bool apply_direct(Cube<typename T1::elem_type>& out, const BaseCube<typename T1::elem_type,T1>& expr);
+  };
+
+
+
 //! @}
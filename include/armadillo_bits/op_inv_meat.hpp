@@ -160,4 +160,36 @@ op_inv_sympd::apply(Mat<typename T1::elem_type>& out, const Op<T1,op_inv_sympd>&
 
 
 
+template<typename T1>
+inline
+void
+op_inv_slices::apply(Cube<typename T1::elem_type>& out, const OpCube<T1,op_inv_slices>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  const bool status = op_inv_slices::apply_direct(out, in.m);
+  
+  if(status == false)
+    {
+    out.soft_reset();
+    arma_stop_runtime_error("inv(): one or more slices seem singular");
+    }
+  }
+
+
+
+template<typename T1>
+inline
+bool
+op_inv_slices::apply_direct(Cube<typename T1::elem_type>& out, const BaseCube<typename T1::elem_type,T1>& expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  const unwrap_cube_check<T1> tmp(expr.get_ref(), out);
+  
+  return batch_helper::inv(out, tmp.M);
+  }
+
+
+
 //! @}
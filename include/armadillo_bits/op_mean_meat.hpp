@@ -95,6 +95,23 @@ op_mean::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     
     eT* out_mem = out.memptr();
     
+    #if defined(ARMA_USE_OPENMP)
+      {
+      if( (X_n_cols >= 2) && mp_gate<eT>::eval(X.n_elem) )
+        {
+        const int n_threads = mp_thread_limit::get();
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword col=0; col < X_n_cols; ++col)
+          {
+          out_mem[col] = op_mean::direct_mean( X.colptr(col), X_n_rows );
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
     for(uword col=0; col < X_n_cols; ++col)
       {
       out_mem[col] = op_mean::direct_mean( X.colptr(col), X_n_rows );
@@ -109,6 +126,47 @@ op_mean::apply_noalias_unwrap(Mat<typename T1::elem_type>& out, const Proxy<T1>&
     
     eT* out_mem = out.memptr();
     
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int   n_threads = mp_thread_limit::get();
+      const uword n_chunks  = uword(n_threads);
+      
+      if( (n_threads >= 2) && (X_n_rows >= 16*n_chunks) && mp_gate<eT>::eval(X.n_elem) )
+        {
+        const uword chunk_size = X_n_rows / n_chunks;
+        
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword chunk=0; chunk < n_chunks; ++chunk)
+          {
+          const uword row_start  = chunk * chunk_size;
+          const uword row_end_p1 = (chunk == (n_chunks-1)) ? X_n_rows : (row_start + chunk_size);
+          
+          for(uword col=0; col < X_n_cols; ++col)
+            {
+            const eT* col_mem = X.colptr(col);
+            
+            for(uword row=row_start; row < row_end_p1; ++row)
+              {
+              out_mem[row] += col_mem[row];
+              }
+            }
+          
+          for(uword row=row_start; row < row_end_p1; ++row)
+            {
+            out_mem[row] /= T(X_n_cols);
+            
+            if(arma_isfinite(out_mem[row]) == false)
+              {
+              out_mem[row] = op_mean::direct_mean_robust( X, row );
+              }
+            }
+          }
+        
+        return;
+        }
+      }
+    #endif
+    
     for(uword col=0; col < X_n_cols; ++col)
       {
       const eT* col_mem = X.colptr(col);
@@ -34,6 +34,18 @@ class op_min
   template<typename eT>
   inline static void apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typename arma_cx_only<eT>::result* junk = 0);
   
+  template<typename eT>
+  inline static void apply(Mat<eT>& out, const Op<subview<eT>,op_min>& in);
+  
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, const subview<eT>& X, const uword dim, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void apply_noalias(Mat<eT>& out, const subview<eT>& X, const uword dim, const typename arma_cx_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void apply_noalias_mem(Mat<eT>& out, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride, const uword dim);
+  
   
   // 
   // cubes
@@ -60,6 +72,24 @@ class op_min
   template<typename eT>
   inline static eT direct_min(const Mat<eT>& X, const uword row);
   
+  template<typename eT>
+  inline static eT direct_min_lanes(const eT* const X, const uword N);
+  
+  template<typename eT>
+  inline static eT direct_min_lanes(const eT* const X, const uword N, uword& index_of_min_val);
+  
+  template<typename eT>
+  inline static eT direct_min_mp(const eT* const X, const uword N, uword& index_of_min_val);
+  
+  template<typename eT>
+  inline static void direct_min_cols(eT* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride);
+  
+  template<typename eT>
+  inline static void direct_min_rows(eT* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride);
+  
+  template<typename eT>
+  inline static void direct_min_rows_range(eT* out_mem, const eT* X_mem, const uword X_n_cols, const uword X_stride, const uword row_start, const uword row_end_p1);
+  
   template<typename eT>
   inline static eT min(const subview<eT>& X);
   
@@ -75,7 +105,7 @@ class op_min
   template<typename T1>
   inline static typename arma_not_cx<typename T1::elem_type>::result min_with_index(const ProxyCube<T1>& P, uword& index_of_min_val);
   
-  
+
   //
   // for complex numbers
   
@@ -58,6 +58,19 @@ op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typ
   arma_extra_debug_sigprint();
   arma_ignore(junk);
   
+  op_min::apply_noalias_mem(out, X.memptr(), X.n_rows, X.n_cols, X.n_rows, dim);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
   const uword X_n_rows = X.n_rows;
   const uword X_n_cols = X.n_cols;
   
@@ -87,34 +100,82 @@ op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typ
     
     eT* out_mem = out.memptr();
     
-    arrayops::copy(out_mem, X.colptr(0), X_n_rows);
-    
-    for(uword col=1; col<X_n_cols; ++col)
+    for(uword row=0; row<X_n_rows; ++row)
       {
-      const eT* col_mem = X.colptr(col);
-      
-      for(uword row=0; row<X_n_rows; ++row)
-        {
-        const eT col_val = col_mem[row];
-        
-        if(col_val < out_mem[row])  { out_mem[row] = col_val; }
-        }
+      out_mem[row] = op_min::direct_min( X, row );
       }
     }
   }
 
 
 
+//! min() of a subview, without extracting the subview into a separate matrix
 template<typename eT>
 inline
 void
-op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typename arma_cx_only<eT>::result* junk)
+op_min::apply(Mat<eT>& out, const Op<subview<eT>,op_min>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword dim = in.aux_uword_a;
+  arma_debug_check( (dim > 1), "min(): parameter 'dim' must be 0 or 1");
+  
+  const subview<eT>& X = in.m;
+  
+  if(&(X.m) != &out)
+    {
+    op_min::apply_noalias(out, X, dim);
+    }
+  else
+    {
+    Mat<eT> tmp;
+    
+    op_min::apply_noalias(tmp, X, dim);
+    
+    out.steal_mem(tmp);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_min::apply_noalias(Mat<eT>& out, const subview<eT>& X, const uword dim, const typename arma_not_cx<eT>::result* junk)
   {
   arma_extra_debug_sigprint();
   arma_ignore(junk);
   
-  const uword X_n_rows = X.n_rows;
-  const uword X_n_cols = X.n_cols;
+  const eT* X_mem = X.colptr(0);
+  
+  op_min::apply_noalias_mem(out, X_mem, X.n_rows, X.n_cols, X.m.n_rows, dim);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_min::apply_noalias(Mat<eT>& out, const subview<eT>& X, const uword dim, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const Mat<eT> tmp(X);
+  
+  op_min::apply_noalias(out, tmp, dim);
+  }
+
+
+
+//! find the minimum along each column (dim=0) or each row (dim=1) of a matrix stored in column-major memory,
+//! where consecutive columns are separated by X_stride elements
+template<typename eT>
+inline
+void
+op_min::apply_noalias_mem(Mat<eT>& out, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride, const uword dim)
+  {
+  arma_extra_debug_sigprint();
   
   if(dim == 0)
     {
@@ -124,12 +185,7 @@ op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typ
     
     if(X_n_rows == 0)  { return; }
     
-    eT* out_mem = out.memptr();
-    
-    for(uword col=0; col<X_n_cols; ++col)
-      {
-      out_mem[col] = op_min::direct_min( X.colptr(col), X_n_rows );
-      }
+    op_min::direct_min_cols(out.memptr(), X_mem, X_n_rows, X_n_cols, X_stride);
     }
   else
   if(dim == 1)
@@ -140,12 +196,7 @@ op_min::apply_noalias(Mat<eT>& out, const Mat<eT>& X, const uword dim, const typ
     
     if(X_n_cols == 0)  { return; }
     
-    eT* out_mem = out.memptr();
-    
-    for(uword row=0; row<X_n_rows; ++row)
-      {
-      out_mem[row] = op_min::direct_min( X, row );
-      }
+    op_min::direct_min_rows(out.memptr(), X_mem, X_n_rows, X_n_cols, X_stride);
     }
   }
 
@@ -201,15 +252,9 @@ op_min::apply_noalias(Cube<eT>& out, const Cube<eT>& X, const uword dim, const t
     
     if(X_n_rows == 0)  { return; }
     
-    for(uword slice=0; slice < X_n_slices; ++slice)
-      {
-      eT* out_mem = out.slice_memptr(slice);
-      
-      for(uword col=0; col < X_n_cols; ++col)
-        {
-        out_mem[col] = op_min::direct_min( X.slice_colptr(slice,col), X_n_rows );
-        }
-      }
+    // treat the cube as a matrix with X_n_cols*X_n_slices columns
+    
+    op_min::direct_min_cols(out.memptr(), X.memptr(), X_n_rows, X_n_cols*X_n_slices, X_n_rows);
     }
   else
   if(dim == 1)
@@ -220,24 +265,27 @@ op_min::apply_noalias(Cube<eT>& out, const Cube<eT>& X, const uword dim, const t
     
     if(X_n_cols == 0)  { return; }
     
-    for(uword slice=0; slice < X_n_slices; ++slice)
+    #if defined(ARMA_USE_OPENMP)
       {
-      eT* out_mem = out.slice_memptr(slice);
-      
-      arrayops::copy(out_mem, X.slice_colptr(slice,0), X_n_rows);
-      
-      for(uword col=1; col < X_n_cols; ++col)
+      if( (X_n_slices >= 2) && mp_gate<eT>::eval(X.n_elem) )
         {
-        const eT* col_mem = X.slice_colptr(slice,col);
+        const int n_threads = mp_thread_limit::get();
         
-        for(uword row=0; row < X_n_rows; ++row)
+        #pragma omp parallel for schedule(static) num_threads(n_threads)
+        for(uword slice=0; slice < X_n_slices; ++slice)
           {
-          const eT col_val = col_mem[row];
-          
-          if(col_val < out_mem[row])  { out_mem[row] = col_val; }
+          op_min::direct_min_rows_range(out.slice_memptr(slice), X.slice_memptr(slice), X_n_cols, X_n_rows, 0, X_n_rows);
           }
+        
+        return;
         }
       }
+    #endif
+    
+    for(uword slice=0; slice < X_n_slices; ++slice)
+      {
+      op_min::direct_min_rows(out.slice_memptr(slice), X.slice_memptr(slice), X_n_rows, X_n_cols, X_n_rows);
+      }
     }
   else
   if(dim == 2)
@@ -359,74 +407,285 @@ op_min::direct_min(const eT* const X, const uword n_elem)
   {
   arma_extra_debug_sigprint();
   
-  eT min_val = priv::most_pos<eT>();
+  if( arma_config::openmp && mp_gate<eT>::eval(n_elem) && (mp_thread_limit::get() >= 2) )
+    {
+    uword junk;
+    
+    return op_min::direct_min_mp(X, n_elem, junk);
+    }
   
-  uword i,j;
-  for(i=0, j=1; j<n_elem; i+=2, j+=2)
+  return op_min::direct_min_lanes(X, n_elem);
+  }
+
+
+
+template<typename eT>
+inline
+eT
+op_min::direct_min(const eT* const X, const uword n_elem, uword& index_of_min_val)
+  {
+  arma_extra_debug_sigprint();
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(n_elem) && (mp_thread_limit::get() >= 2) )
+    {
+    return op_min::direct_min_mp(X, n_elem, index_of_min_val);
+    }
+  
+  return op_min::direct_min_lanes(X, n_elem, index_of_min_val);
+  }
+
+
+
+//! serial search using four independent lanes, which allows the compiler to use SIMD instructions
+template<typename eT>
+inline
+eT
+op_min::direct_min_lanes(const eT* const X, const uword n_elem)
+  {
+  eT min_val1 = priv::most_pos<eT>();
+  eT min_val2 = priv::most_pos<eT>();
+  eT min_val3 = priv::most_pos<eT>();
+  eT min_val4 = priv::most_pos<eT>();
+  
+  uword i = 0;
+  
+  for(; (i+3) < n_elem; i+=4)
+    {
+    const eT X_i = X[i  ];
+    const eT X_j = X[i+1];
+    const eT X_k = X[i+2];
+    const eT X_l = X[i+3];
+    
+    min_val1 = (X_i < min_val1) ? X_i : min_val1;
+    min_val2 = (X_j < min_val2) ? X_j : min_val2;
+    min_val3 = (X_k < min_val3) ? X_k : min_val3;
+    min_val4 = (X_l < min_val4) ? X_l : min_val4;
+    }
+  
+  for(; i < n_elem; ++i)
     {
     const eT X_i = X[i];
-    const eT X_j = X[j];
     
-    if(X_i < min_val) { min_val = X_i; }
-    if(X_j < min_val) { min_val = X_j; }
+    min_val1 = (X_i < min_val1) ? X_i : min_val1;
+    }
+  
+  min_val1 = (min_val2 < min_val1) ? min_val2 : min_val1;
+  min_val3 = (min_val4 < min_val3) ? min_val4 : min_val3;
+  
+  return (min_val3 < min_val1) ? min_val3 : min_val1;
+  }
+
+
+
+//! serial search using four independent lanes, each tracking the index of its best value;
+//! ties are resolved in favour of the lowest index
+template<typename eT>
+inline
+eT
+op_min::direct_min_lanes(const eT* const X, const uword n_elem, uword& index_of_min_val)
+  {
+  eT    best_val[4];
+  uword best_index[4];
+  
+  for(uword lane=0; lane < 4; ++lane)
+    {
+    best_val[lane]   = priv::most_pos<eT>();
+    best_index[lane] = 0;
+    }
+  
+  uword i = 0;
+  
+  for(; (i+3) < n_elem; i+=4)
+    {
+    for(uword lane=0; lane < 4; ++lane)
+      {
+      const eT X_i = X[i+lane];
+      
+      if(X_i < best_val[lane])
+        {
+        best_val[lane]   = X_i;
+        best_index[lane] = i+lane;
+        }
+      }
     }
   
-  if(i < n_elem)
+  for(; i < n_elem; ++i)
     {
     const eT X_i = X[i];
     
-    if(X_i < min_val) { min_val = X_i; }
+    if(X_i < best_val[0])
+      {
+      best_val[0]   = X_i;
+      best_index[0] = i;
+      }
     }
   
+  eT    min_val = best_val[0];
+  uword index   = best_index[0];
+  
+  for(uword lane=1; lane < 4; ++lane)
+    {
+    if( (best_val[lane] < min_val) || ((best_val[lane] == min_val) && (best_index[lane] < index)) )
+      {
+      min_val = best_val[lane];
+      index   = best_index[lane];
+      }
+    }
+  
+  index_of_min_val = index;
+  
   return min_val;
   }
 
 
 
 template<typename eT>
-inline 
+inline
 eT
-op_min::direct_min(const eT* const X, const uword n_elem, uword& index_of_min_val)
+op_min::direct_min_mp(const eT* const X, const uword n_elem, uword& index_of_min_val)
   {
   arma_extra_debug_sigprint();
   
-  eT min_val = priv::most_pos<eT>();
-  
-  uword best_index = 0;
-  
-  uword i,j;
-  for(i=0, j=1; j<n_elem; i+=2, j+=2)
+  #if defined(ARMA_USE_OPENMP)
     {
-    const eT X_i = X[i];
-    const eT X_j = X[j];
+    const int   n_threads  = mp_thread_limit::get();
+    const uword n_chunks   = uword(n_threads);
+    const uword chunk_size = n_elem / n_chunks;
+    
+    podarray<eT>    chunk_val(n_chunks);
+    podarray<uword> chunk_index(n_chunks);
     
-    if(X_i < min_val)
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(uword chunk=0; chunk < n_chunks; ++chunk)
       {
-      min_val    = X_i;
-      best_index = i;
+      const uword start  = chunk * chunk_size;
+      const uword end_p1 = (chunk == (n_chunks-1)) ? n_elem : (start + chunk_size);
+      
+      uword index = 0;
+      
+      chunk_val[chunk]   = op_min::direct_min_lanes( &(X[start]), (end_p1 - start), index );
+      chunk_index[chunk] = start + index;
       }
     
-    if(X_j < min_val)
+    // the chunks are in increasing order of indices, so the first occurrence is kept on ties
+    
+    eT    min_val = chunk_val[0];
+    uword index   = chunk_index[0];
+    
+    for(uword chunk=1; chunk < n_chunks; ++chunk)
+      {
+      if(chunk_val[chunk] < min_val)
+        {
+        min_val = chunk_val[chunk];
+        index   = chunk_index[chunk];
+        }
+      }
+    
+    index_of_min_val = index;
+    
+    return min_val;
+    }
+  #else
+    {
+    return op_min::direct_min_lanes(X, n_elem, index_of_min_val);
+    }
+  #endif
+  }
+
+
+
+//! find the minimum of each column
+template<typename eT>
+inline
+void
+op_min::direct_min_cols(eT* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    if( (X_n_cols >= 2) && mp_gate<eT>::eval(X_n_rows * X_n_cols) )
       {
-      min_val    = X_j;
-      best_index = j;
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < X_n_cols; ++col)
+        {
+        out_mem[col] = op_min::direct_min_lanes( &(X_mem[col*X_stride]), X_n_rows );
+        }
+      
+      return;
       }
     }
+  #endif
   
-  if(i < n_elem)
+  for(uword col=0; col < X_n_cols; ++col)
     {
-    const eT X_i = X[i];
+    out_mem[col] = op_min::direct_min( &(X_mem[col*X_stride]), X_n_rows );
+    }
+  }
+
+
+
+//! find the minimum of each row, by traversing the columns;
+//! when possible, blocks of rows are processed by separate threads
+template<typename eT>
+inline
+void
+op_min::direct_min_rows(eT* out_mem, const eT* X_mem, const uword X_n_rows, const uword X_n_cols, const uword X_stride)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int   n_threads = mp_thread_limit::get();
+    const uword n_chunks  = uword(n_threads);
     
-    if(X_i < min_val)
+    if( (n_threads >= 2) && (X_n_rows >= 16*n_chunks) && mp_gate<eT>::eval(X_n_rows * X_n_cols) )
       {
-      min_val    = X_i;
-      best_index = i;
+      const uword chunk_size = X_n_rows / n_chunks;
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const uword row_start  = chunk * chunk_size;
+        const uword row_end_p1 = (chunk == (n_chunks-1)) ? X_n_rows : (row_start + chunk_size);
+        
+        op_min::direct_min_rows_range(out_mem, X_mem, X_n_cols, X_stride, row_start, row_end_p1);
+        }
+      
+      return;
       }
     }
+  #endif
   
-  index_of_min_val = best_index;
+  op_min::direct_min_rows_range(out_mem, X_mem, X_n_cols, X_stride, 0, X_n_rows);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_min::direct_min_rows_range(eT* out_mem, const eT* X_mem, const uword X_n_cols, const uword X_stride, const uword row_start, const uword row_end_p1)
+  {
+  const uword N = row_end_p1 - row_start;
   
-  return min_val;
+  eT* out_ptr = &(out_mem[row_start]);
+  
+  arrayops::copy(out_ptr, &(X_mem[row_start]), N);
+  
+  for(uword col=1; col < X_n_cols; ++col)
+    {
+    const eT* col_mem = &(X_mem[col*X_stride + row_start]);
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const eT col_val = col_mem[i];
+      
+      out_ptr[i] = (col_val < out_ptr[i]) ? col_val : out_ptr[i];
+      }
+    }
   }
 
 
@@ -477,7 +736,7 @@ op_min::min(const subview<eT>& X)
     
     return Datum<eT>::nan;
     }
-    
+  
   const uword X_n_rows = X.n_rows;
   const uword X_n_cols = X.n_cols;
   
@@ -491,7 +750,7 @@ op_min::min(const subview<eT>& X)
     const uword start_col = X.aux_col1;
     
     const uword end_col_p1 = start_col + X_n_cols;
-  
+    
     uword i,j;
     for(i=start_col, j=start_col+1; j < end_col_p1; i+=2, j+=2)
       {
@@ -542,6 +801,13 @@ op_min::min(const Base<typename T1::elem_type,T1>& X)
     return Datum<eT>::nan;
     }
   
+  if(is_Mat<typename Proxy<T1>::stored_type>::value)
+    {
+    const unwrap<typename Proxy<T1>::stored_type> U(P.Q);
+    
+    return op_min::direct_min(U.M.memptr(), n_elem);
+    }
+  
   eT min_val = priv::most_pos<eT>();
   
   if(Proxy<T1>::use_at == false)
@@ -706,6 +972,13 @@ op_min::min_with_index(const Proxy<T1>& P, uword& index_of_min_val)
     return Datum<eT>::nan;
     }
   
+  if(is_Mat<typename Proxy<T1>::stored_type>::value)
+    {
+    const unwrap<typename Proxy<T1>::stored_type> U(P.Q);
+    
+    return op_min::direct_min(U.M.memptr(), n_elem, index_of_min_val);
+    }
+  
   eT    best_val   = priv::most_pos<eT>();
   uword best_index = 0;
   
@@ -894,7 +1167,7 @@ op_min::direct_min(const Mat< std::complex<T> >& X, const uword row)
   const uword X_n_cols = X.n_cols;
   
   uword index   = 0;
-  T     min_val = priv::most_pos<T>();
+  T   min_val = priv::most_pos<T>();
   
   for(uword col=0; col<X_n_cols; ++col)
     {
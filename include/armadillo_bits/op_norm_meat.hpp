@@ -930,8 +930,21 @@ op_norm::mat_norm_1(const SpProxy<T1>& P)
   {
   arma_extra_debug_sigprint();
   
-  // TODO: this can be sped up with a dedicated implementation
-  return as_scalar( max( sum(abs(P.Q), 0), 1) );
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  const unwrap_spmat<typename SpProxy<T1>::stored_type> tmp(P.Q);
+  
+  const SpMat<eT>& A = tmp.M;
+  
+  if(A.n_cols == 0)  { return T(0); }
+  
+  // largest sum of absolute values in a column
+  podarray<T> col_sums(A.n_cols);
+  
+  sp_reduce_helper::col_reduce(col_sums.memptr(), sp_reduce_helper::red_abs_sum<eT>(A.values), A.col_ptrs, A.n_cols);
+  
+  return op_max::direct_max(col_sums.memptr(), A.n_cols);
   }
 
 
@@ -999,8 +1012,21 @@ op_norm::mat_norm_inf(const SpProxy<T1>& P)
   {
   arma_extra_debug_sigprint();
   
-  // TODO: this can be sped up with a dedicated implementation
-  return as_scalar( max( sum(abs(P.Q), 1), 0) );
+  typedef typename T1::elem_type eT;
+  typedef typename T1::pod_type   T;
+  
+  const unwrap_spmat<typename SpProxy<T1>::stored_type> tmp(P.Q);
+  
+  const SpMat<eT>& A = tmp.M;
+  
+  if(A.n_rows == 0)  { return T(0); }
+  
+  // largest sum of absolute values in a row
+  podarray<T> row_sums(A.n_rows);
+  
+  sp_reduce_helper::row_reduce(row_sums.memptr(), sp_reduce_helper::red_abs_sum<eT>(A.values), A.row_indices, A.n_rows, A.n_nonzero);
+  
+  return op_max::direct_max(row_sums.memptr(), A.n_rows);
   }
 
 
@@ -0,0 +1,54 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup op_qr_update
+//! @{
+
+
+
+//! Updating of a full QR decomposition (Q is square) after a column or row of the decomposed matrix is inserted or deleted.
+//! The factors are modified in place via Givens rotations, using O(m^2 + m*n) operations.
+class op_qr_update
+  {
+  public:
+  
+  template<typename T1>
+  inline static void insert_col(Mat<typename T1::elem_type>& Q, Mat<typename T1::elem_type>& R, const uword j, const Base<typename T1::elem_type,T1>& X);
+  
+  template<typename T1>
+  inline static void insert_row(Mat<typename T1::elem_type>& Q, Mat<typename T1::elem_type>& R, const uword j, const Base<typename T1::elem_type,T1>& X);
+  
+  template<typename eT>
+  inline static void delete_col(Mat<eT>& Q, Mat<eT>& R, const uword j);
+  
+  template<typename eT>
+  inline static void delete_row(Mat<eT>& Q, Mat<eT>& R, const uword j);
+  
+  //
+  
+  template<typename eT>
+  arma_inline static void givens(typename get_pod_type<eT>::result& c, eT& s, const eT a, const eT b);
+  
+  template<typename eT>
+  inline static void rotate_rows(Mat<eT>& R, const uword row_a, const uword row_b, const uword col_start, const typename get_pod_type<eT>::result c, const eT s);
+  
+  template<typename eT>
+  inline static void rotate_cols(Mat<eT>& Q, const uword col_a, const uword col_b, const typename get_pod_type<eT>::result c, const eT s);
+  };
+
+
+
+//! @}
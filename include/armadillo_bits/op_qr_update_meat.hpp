@@ -0,0 +1,273 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup op_qr_update
+//! @{
+
+
+
+//! X = [A(:,0:j-1), x, A(:,j:end)]
+template<typename T1>
+inline
+void
+op_qr_update::insert_col(Mat<typename T1::elem_type>& Q, Mat<typename T1::elem_type>& R, const uword j, const Base<typename T1::elem_type,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename get_pod_type<eT>::result T;
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>& x     = U.M;
+  
+  const uword m = Q.n_rows;
+  
+  arma_debug_check( ((Q.is_square() == false) || (R.n_rows != m)), "qr_insert(): Q and R do not form a full QR decomposition" );
+  arma_debug_check( ((x.is_vec() == false) || (x.n_elem != m)),    "qr_insert(): size of given column is incompatible with Q"     );
+  arma_debug_check( (j > R.n_cols),                                "qr_insert(): index out of bounds"                             );
+  
+  const Mat<eT> w = trans(Q) * vectorise(x);
+  
+  R.insert_cols(j, w);
+  
+  // zero the new column below the diagonal, from the bottom up
+  
+  for(uword i_p1=m; i_p1 > (j+1); --i_p1)
+    {
+    const uword i = i_p1 - 1;
+    
+    T  c;
+    eT s;
+    
+    op_qr_update::givens(c, s, R.at(i-1,j), R.at(i,j));
+    
+    op_qr_update::rotate_rows(R, i-1, i, j, c, s);
+    op_qr_update::rotate_cols(Q, i-1, i,    c, s);
+    
+    R.at(i,j) = eT(0);
+    }
+  }
+
+
+
+//! X = [A(0:j-1,:); x; A(j:end,:)]
+template<typename T1>
+inline
+void
+op_qr_update::insert_row(Mat<typename T1::elem_type>& Q, Mat<typename T1::elem_type>& R, const uword j, const Base<typename T1::elem_type,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  typedef typename get_pod_type<eT>::result T;
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>& x     = U.M;
+  
+  const uword m = Q.n_rows;
+  const uword n = R.n_cols;
+  
+  arma_debug_check( ((Q.is_square() == false) || (R.n_rows != m)), "qr_insert(): Q and R do not form a full QR decomposition" );
+  arma_debug_check( ((x.is_vec() == false) || (x.n_elem != n)),    "qr_insert(): size of given row is incompatible with R"        );
+  arma_debug_check( (j > m),                                       "qr_insert(): index out of bounds"                             );
+  
+  // [x; A] = [1 0; 0 Q] * [x; R], where [x; R] is upper Hessenberg;
+  // the first row of the new Q is moved to row j
+  
+  Mat<eT> R1(m+1, n);
+  
+  R1.row(0) = strans(vectorise(x));
+  
+  if(m > 0)  { R1.rows(1, m) = R; }
+  
+  Mat<eT> Q1(m+1, m+1);
+  
+  Q1.zeros();
+  
+  Q1.at(j,0) = eT(1);
+  
+  if(j > 0)  { Q1.submat(0,   1, j-1, m) = Q.rows(0, j-1); }
+  if(j < m)  { Q1.submat(j+1, 1, m,   m) = Q.rows(j, m-1); }
+  
+  const uword n_rot = (std::min)(n, m);
+  
+  for(uword k=0; k < n_rot; ++k)
+    {
+    T  c;
+    eT s;
+    
+    op_qr_update::givens(c, s, R1.at(k,k), R1.at(k+1,k));
+    
+    op_qr_update::rotate_rows(R1, k, k+1, k, c, s);
+    op_qr_update::rotate_cols(Q1, k, k+1,    c, s);
+    
+    R1.at(k+1,k) = eT(0);
+    }
+  
+  Q.steal_mem(Q1);
+  R.steal_mem(R1);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_qr_update::delete_col(Mat<eT>& Q, Mat<eT>& R, const uword j)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword m = Q.n_rows;
+  
+  arma_debug_check( ((Q.is_square() == false) || (R.n_rows != m)), "qr_delete(): Q and R do not form a full QR decomposition" );
+  arma_debug_check( (j >= R.n_cols),                               "qr_delete(): index out of bounds"                             );
+  
+  R.shed_col(j);
+  
+  // R is now upper Hessenberg from column j onwards
+  
+  const uword n_rot = (m > 0) ? (std::min)(R.n_cols, m-1) : uword(0);
+  
+  for(uword k=j; k < n_rot; ++k)
+    {
+    T  c;
+    eT s;
+    
+    op_qr_update::givens(c, s, R.at(k,k), R.at(k+1,k));
+    
+    op_qr_update::rotate_rows(R, k, k+1, k, c, s);
+    op_qr_update::rotate_cols(Q, k, k+1,    c, s);
+    
+    R.at(k+1,k) = eT(0);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_qr_update::delete_row(Mat<eT>& Q, Mat<eT>& R, const uword j)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword m = Q.n_rows;
+  
+  arma_debug_check( ((Q.is_square() == false) || (R.n_rows != m)), "qr_delete(): Q and R do not form a full QR decomposition" );
+  arma_debug_check( (j >= m),                                      "qr_delete(): index out of bounds"                             );
+  
+  // rotate row j of Q to a multiple of the first unit vector;
+  // as Q is unitary, the first column of Q then has a single non-zero element (at row j),
+  // and R becomes upper Hessenberg
+  
+  for(uword i=(m-1); i > 0; --i)
+    {
+    T  c;
+    eT s;
+    
+    op_qr_update::givens(c, s, access::alt_conj(Q.at(j,i-1)), access::alt_conj(Q.at(j,i)));
+    
+    op_qr_update::rotate_cols(Q, i-1, i,    c, s);
+    op_qr_update::rotate_rows(R, i-1, i, i-1, c, s);
+    
+    Q.at(j,i) = eT(0);
+    }
+  
+  Q.shed_row(j);
+  Q.shed_col(0);
+  R.shed_row(0);
+  }
+
+
+
+//! c and s such that [c s; -conj(s) c] * [a; b] = [r; 0], with real c
+template<typename eT>
+arma_inline
+void
+op_qr_update::givens(typename get_pod_type<eT>::result& c, eT& s, const eT a, const eT b)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  const T a_abs = std::abs(a);
+  const T b_abs = std::abs(b);
+  
+  if(b_abs == T(0))  { c = T(1); s = eT(0);                            return; }
+  if(a_abs == T(0))  { c = T(0); s = access::alt_conj(b) / eT(b_abs); return; }
+  
+  const T scale = a_abs + b_abs;
+  const T a_tmp = a_abs / scale;
+  const T b_tmp = b_abs / scale;
+  
+  const T r = scale * std::sqrt(a_tmp*a_tmp + b_tmp*b_tmp);
+  
+  c = a_abs / r;
+  s = (a / eT(a_abs)) * access::alt_conj(b) / eT(r);
+  }
+
+
+
+//! rows row_a and row_b of R, starting at column col_start, are replaced by [c s; -conj(s) c] times themselves
+template<typename eT>
+inline
+void
+op_qr_update::rotate_rows(Mat<eT>& R, const uword row_a, const uword row_b, const uword col_start, const typename get_pod_type<eT>::result c, const eT s)
+  {
+  const eT s_conj = access::alt_conj(s);
+  
+  const uword R_n_cols = R.n_cols;
+  
+  for(uword col=col_start; col < R_n_cols; ++col)
+    {
+    const eT x = R.at(row_a, col);
+    const eT y = R.at(row_b, col);
+    
+    R.at(row_a, col) = c*x + s*y;
+    R.at(row_b, col) = c*y - s_conj*x;
+    }
+  }
+
+
+
+//! columns col_a and col_b of Q are replaced by Q times the conjugate transpose of the rotation used in rotate_rows()
+template<typename eT>
+inline
+void
+op_qr_update::rotate_cols(Mat<eT>& Q, const uword col_a, const uword col_b, const typename get_pod_type<eT>::result c, const eT s)
+  {
+  const eT s_conj = access::alt_conj(s);
+  
+  const uword Q_n_rows = Q.n_rows;
+  
+  eT* a_mem = Q.colptr(col_a);
+  eT* b_mem = Q.colptr(col_b);
+  
+  for(uword i=0; i < Q_n_rows; ++i)
+    {
+    const eT x = a_mem[i];
+    const eT y = b_mem[i];
+    
+    a_mem[i] = c*x + s_conj*y;
+    b_mem[i] = c*y - s*x;
+    }
+  }
+
+
+
+//! @}
@@ -27,6 +27,21 @@ class op_var
   template<typename T1>
   inline static void apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type, T1, op_var>& in);
   
+  template<typename eT>
+  inline static void apply_noalias(Mat<typename get_pod_type<eT>::result>& out, const Mat<eT>& X, const uword norm_type, const uword dim);
+  
+  template<typename eT>
+  inline static void apply_noalias_rows(eT* out_mem, const Mat<eT>& X, const uword norm_type);
+  
+  template<typename T>
+  inline static void apply_noalias_rows(T* out_mem, const Mat< std::complex<T> >& X, const uword norm_type);
+  
+  template<typename eT>
+  inline static void apply_noalias_rows_range(eT* out_mem, const Mat<eT>& X, const uword norm_type, const uword row_start, const uword row_end_p1);
+  
+  template<typename eT>
+  inline static void apply_noalias_rows_copy(typename get_pod_type<eT>::result* out_mem, const Mat<eT>& X, const uword norm_type, const uword row_start, const uword row_end_p1);
+  
   
   //
   
@@ -56,6 +71,32 @@ class op_var
   
   template<typename T>
   inline static  T direct_var_robust(const std::complex<T>* const X, const uword N, const uword norm_type = 0);
+  
+  
+  //
+  
+  template<typename eT>
+  inline static void direct_stats(eT& out_mean, typename get_pod_type<eT>::result& out_m2, const eT* const X, const uword N);
+  
+  template<typename eT>
+  inline static void direct_stats_blocks(eT& out_mean, typename get_pod_type<eT>::result& out_m2, const eT* const X, const uword N);
+  
+  template<typename eT>
+  inline static void direct_stats_mp(eT& out_mean, typename get_pod_type<eT>::result& out_m2, const eT* const X, const uword N);
+  
+  template<typename eT>
+  inline static void direct_stats_block(eT& out_mean, eT& out_m2, const eT* const X, const uword N);
+  
+  template<typename T>
+  inline static void direct_stats_block(std::complex<T>& out_mean, T& out_m2, const std::complex<T>* const X, const uword N);
+  
+  template<typename eT>
+  inline static void merge_stats(uword& N_a, eT& mean_a, typename get_pod_type<eT>::result& m2_a, const uword N_b, const eT mean_b, const typename get_pod_type<eT>::result m2_b);
+  
+  template<typename eT> arma_inline static eT sq_abs(const eT x)                { return x*x;          }
+  template<typename  T> arma_inline static  T sq_abs(const std::complex<T>& x) { return std::norm(x); }
+  
+  static const uword stats_block_size = 512;
   };
 
 
@@ -29,8 +29,7 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
   {
   arma_extra_debug_sigprint();
   
-  typedef typename T1::elem_type  in_eT;
-  typedef typename T1::pod_type  out_eT;
+  typedef typename T1::elem_type in_eT;
   
   const unwrap_check_mixed<T1> tmp(in.m, out);
   const Mat<in_eT>&        X = tmp.M;
@@ -41,6 +40,20 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
   arma_debug_check( (norm_type > 1), "var(): parameter 'norm_type' must be 0 or 1" );
   arma_debug_check( (dim > 1),       "var(): parameter 'dim' must be 0 or 1"       );
   
+  op_var::apply_noalias(out, X, norm_type, dim);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_var::apply_noalias(Mat<typename get_pod_type<eT>::result>& out, const Mat<eT>& X, const uword norm_type, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result out_eT;
+  
   const uword X_n_rows = X.n_rows;
   const uword X_n_cols = X.n_cols;
   
@@ -54,6 +67,23 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
       {
       out_eT* out_mem = out.memptr();
       
+      #if defined(ARMA_USE_OPENMP)
+        {
+        if( (X_n_cols > 1) && mp_gate<eT>::eval(X.n_elem) )
+          {
+          const int n_threads = mp_thread_limit::get();
+          
+          #pragma omp parallel for schedule(static) num_threads(n_threads)
+          for(uword col=0; col<X_n_cols; ++col)
+            {
+            out_mem[col] = op_var::direct_var( X.colptr(col), X_n_rows, norm_type );
+            }
+          
+          return;
+          }
+        }
+      #endif
+      
       for(uword col=0; col<X_n_cols; ++col)
         {
         out_mem[col] = op_var::direct_var( X.colptr(col), X_n_rows, norm_type );
@@ -69,19 +99,154 @@ op_var::apply(Mat<typename T1::pod_type>& out, const mtOp<typename T1::pod_type,
     
     if(X_n_cols > 0)
       {
-      podarray<in_eT> dat(X_n_cols);
-      
-      in_eT*  dat_mem = dat.memptr();
-      out_eT* out_mem = out.memptr();
+      op_var::apply_noalias_rows(out.memptr(), X, norm_type);
+      }
+    }
+  }
+
+
+
+//! find the variance of each row, without making a copy of each row;
+//! the columns are traversed once and the running mean and sum of squared deviations
+//! of all rows are updated together (Welford's method)
+template<typename eT>
+inline
+void
+op_var::apply_noalias_rows(eT* out_mem, const Mat<eT>& X, const uword norm_type)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_rows = X.n_rows;
+  
+  if(is_real<eT>::value == false)
+    {
+    op_var::apply_noalias_rows_copy(out_mem, X, norm_type, 0, X_n_rows);
+    
+    return;
+    }
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    if( (X_n_rows >= uword(2*n_threads)) && mp_gate<eT>::eval(X.n_elem) )
+      {
+      const uword chunk_size = X_n_rows / uword(n_threads);
       
-      for(uword row=0; row<X_n_rows; ++row)
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(int t=0; t < n_threads; ++t)
         {
-        dat.copy_row(X, row);
+        const uword row_start  = uword(t) * chunk_size;
+        const uword row_end_p1 = (t == (n_threads-1)) ? X_n_rows : (row_start + chunk_size);
         
-        out_mem[row] = op_var::direct_var( dat_mem, X_n_cols, norm_type );
+        op_var::apply_noalias_rows_range(out_mem, X, norm_type, row_start, row_end_p1);
         }
+      
+      return;
+      }
+    }
+  #endif
+  
+  op_var::apply_noalias_rows_range(out_mem, X, norm_type, 0, X_n_rows);
+  }
+
+
+
+template<typename T>
+inline
+void
+op_var::apply_noalias_rows(T* out_mem, const Mat< std::complex<T> >& X, const uword norm_type)
+  {
+  arma_extra_debug_sigprint();
+  
+  op_var::apply_noalias_rows_copy(out_mem, X, norm_type, 0, X.n_rows);
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_var::apply_noalias_rows_range(eT* out_mem, const Mat<eT>& X, const uword norm_type, const uword row_start, const uword row_end_p1)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword X_n_cols = X.n_cols;
+  const uword N        = row_end_p1 - row_start;
+  
+  if(N == 0)  { return; }
+  
+  if(X_n_cols < 2)
+    {
+    arrayops::fill_zeros(&(out_mem[row_start]), N);
+    
+    return;
+    }
+  
+  podarray<eT> r_mean(N);
+  
+  eT* r_mean_mem = r_mean.memptr();
+  eT* r_m2_mem   = &(out_mem[row_start]);
+  
+  arrayops::copy(r_mean_mem, &(X.colptr(0)[row_start]), N);
+  arrayops::fill_zeros(r_m2_mem, N);
+  
+  for(uword col=1; col < X_n_cols; ++col)
+    {
+    const eT* X_colmem = &(X.colptr(col)[row_start]);
+    
+    const eT alpha = eT(1) / eT(col+1);
+    
+    for(uword i=0; i < N; ++i)
+      {
+      const eT val   = X_colmem[i];
+      const eT delta = val - r_mean_mem[i];
+      
+      const eT new_mean = r_mean_mem[i] + alpha*delta;
+      
+      r_mean_mem[i] = new_mean;
+      r_m2_mem[i]  += delta * (val - new_mean);
       }
     }
+  
+  const eT norm_val = (norm_type == 0) ? eT(X_n_cols-1) : eT(X_n_cols);
+  
+  bool all_finite = true;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const eT var_val = r_m2_mem[i] / norm_val;
+    
+    r_m2_mem[i] = var_val;
+    
+    all_finite = all_finite && arma_isfinite(var_val);
+    }
+  
+  if(all_finite == false)
+    {
+    op_var::apply_noalias_rows_copy(out_mem, X, norm_type, row_start, row_end_p1);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_var::apply_noalias_rows_copy(typename get_pod_type<eT>::result* out_mem, const Mat<eT>& X, const uword norm_type, const uword row_start, const uword row_end_p1)
+  {
+  arma_extra_debug_sigprint();
+  
+  podarray<eT> dat(X.n_cols);
+  
+  eT* dat_mem = dat.memptr();
+  
+  for(uword row=row_start; row < row_end_p1; ++row)
+    {
+    dat.copy_row(X, row);
+    
+    out_mem[row] = op_var::direct_var( dat_mem, X.n_cols, norm_type );
+    }
   }
 
 
@@ -160,37 +325,13 @@ op_var::direct_var(const eT* const X, const uword n_elem, const uword norm_type)
   
   if(n_elem >= 2)
     {
-    const eT acc1 = op_mean::direct_mean(X, n_elem);
+    eT r_mean;
+    eT r_m2;
     
-    eT acc2 = eT(0);
-    eT acc3 = eT(0);
-    
-    uword i,j;
-    
-    for(i=0, j=1; j<n_elem; i+=2, j+=2)
-      {
-      const eT Xi = X[i];
-      const eT Xj = X[j];
-      
-      const eT tmpi = acc1 - Xi;
-      const eT tmpj = acc1 - Xj;
-      
-      acc2 += tmpi*tmpi + tmpj*tmpj;
-      acc3 += tmpi      + tmpj;
-      }
-    
-    if(i < n_elem)
-      {
-      const eT Xi = X[i];
-      
-      const eT tmpi = acc1 - Xi;
-      
-      acc2 += tmpi*tmpi;
-      acc3 += tmpi;
-      }
+    op_var::direct_stats(r_mean, r_m2, X, n_elem);
     
     const eT norm_val = (norm_type == 0) ? eT(n_elem-1) : eT(n_elem);
-    const eT var_val  = (acc2 - acc3*acc3/eT(n_elem)) / norm_val;
+    const eT var_val  = r_m2 / norm_val;
     
     return arma_isfinite(var_val) ? var_val : op_var::direct_var_robust(X, n_elem, norm_type);
     }
@@ -247,21 +388,13 @@ op_var::direct_var(const std::complex<T>* const X, const uword n_elem, const uwo
   
   if(n_elem >= 2)
     {
-    const eT acc1 = op_mean::direct_mean(X, n_elem);
+    eT r_mean;
+    T  r_m2;
     
-    T  acc2 =  T(0);
-    eT acc3 = eT(0);
-    
-    for(uword i=0; i<n_elem; ++i)
-      {
-      const eT tmp = acc1 - X[i];
-      
-      acc2 += std::norm(tmp);
-      acc3 += tmp;
-      }
+    op_var::direct_stats(r_mean, r_m2, X, n_elem);
     
     const T norm_val = (norm_type == 0) ? T(n_elem-1) : T(n_elem);
-    const T var_val  = (acc2 - std::norm(acc3)/T(n_elem)) / norm_val;
+    const T var_val  = r_m2 / norm_val;
     
     return arma_isfinite(var_val) ? var_val : op_var::direct_var_robust(X, n_elem, norm_type);
     }
@@ -308,5 +441,204 @@ op_var::direct_var_robust(const std::complex<T>* const X, const uword n_elem, co
 
 
 
-//! @}
+//! find the mean and the sum of squared deviations from the mean of an array in one pass over memory;
+//! the array is processed in cache-sized blocks, with the statistics of each block
+//! combined via the parallel algorithm of Chan, Golub and LeVeque
+template<typename eT>
+inline
+void
+op_var::direct_stats(eT& out_mean, typename get_pod_type<eT>::result& out_m2, const eT* const X, const uword n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  if( arma_config::openmp && mp_gate<eT>::eval(n_elem) && (mp_thread_limit::get() > 1) )
+    {
+    op_var::direct_stats_mp(out_mean, out_m2, X, n_elem);
+    }
+  else
+    {
+    op_var::direct_stats_blocks(out_mean, out_m2, X, n_elem);
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+op_var::direct_stats_blocks(eT& out_mean, typename get_pod_type<eT>::result& out_m2, const eT* const X, const uword n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword block_size = op_var::stats_block_size;
+  
+  uword N_a    = (std::min)(n_elem, block_size);
+  eT    mean_a = eT(0);
+  T     m2_a   = T(0);
+  
+  op_var::direct_stats_block(mean_a, m2_a, X, N_a);
+  
+  for(uword start = N_a; start < n_elem; start += block_size)
+    {
+    const uword N_b = (std::min)(block_size, n_elem - start);
+    
+    eT mean_b = eT(0);
+    T  m2_b   = T(0);
+    
+    op_var::direct_stats_block(mean_b, m2_b, &(X[start]), N_b);
+    
+    op_var::merge_stats(N_a, mean_a, m2_a, N_b, mean_b, m2_b);
+    }
+  
+  out_mean = mean_a;
+  out_m2   = m2_a;
+  }
+
 
+
+template<typename eT>
+inline
+void
+op_var::direct_stats_mp(eT& out_mean, typename get_pod_type<eT>::result& out_m2, const eT* const X, const uword n_elem)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    typedef typename get_pod_type<eT>::result T;
+    
+    const int   n_threads  = mp_thread_limit::get();
+    const uword chunk_size = n_elem / uword(n_threads);
+    
+    const uword n_partial = uword(n_threads);
+    
+    podarray<eT> partial_mean(n_partial);
+    podarray<T>  partial_m2  (n_partial);
+    
+    #pragma omp parallel for schedule(static) num_threads(n_threads)
+    for(int t=0; t < n_threads; ++t)
+      {
+      const uword start  = uword(t) * chunk_size;
+      const uword end_p1 = (t == (n_threads-1)) ? n_elem : (start + chunk_size);
+      
+      op_var::direct_stats_blocks(partial_mean[t], partial_m2[t], &(X[start]), end_p1 - start);
+      }
+    
+    uword N_a    = chunk_size;
+    eT    mean_a = partial_mean[0];
+    T     m2_a   = partial_m2[0];
+    
+    for(int t=1; t < n_threads; ++t)
+      {
+      const uword N_b = (t == (n_threads-1)) ? (n_elem - uword(t)*chunk_size) : chunk_size;
+      
+      op_var::merge_stats(N_a, mean_a, m2_a, N_b, partial_mean[t], partial_m2[t]);
+      }
+    
+    out_mean = mean_a;
+    out_m2   = m2_a;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(n_elem);
+    
+    out_mean = eT(0);
+    out_m2   = typename get_pod_type<eT>::result(0);
+    }
+  #endif
+  }
+
+
+
+//! two-pass mean and sum of squared deviations of a block that fits into the L1 cache
+template<typename eT>
+inline
+void
+op_var::direct_stats_block(eT& out_mean, eT& out_m2, const eT* const X, const uword n_elem)
+  {
+  const eT mean_val = op_mean::direct_mean(X, n_elem);
+  
+  eT acc1 = eT(0);
+  eT acc2 = eT(0);
+  
+  uword i,j;
+  
+  for(i=0, j=1; j<n_elem; i+=2, j+=2)
+    {
+    const eT tmpi = X[i] - mean_val;
+    const eT tmpj = X[j] - mean_val;
+    
+    acc1 += tmpi*tmpi;
+    acc2 += tmpj*tmpj;
+    }
+  
+  if(i < n_elem)
+    {
+    const eT tmpi = X[i] - mean_val;
+    
+    acc1 += tmpi*tmpi;
+    }
+  
+  out_mean = mean_val;
+  out_m2   = acc1 + acc2;
+  }
+
+
+
+template<typename T>
+inline
+void
+op_var::direct_stats_block(std::complex<T>& out_mean, T& out_m2, const std::complex<T>* const X, const uword n_elem)
+  {
+  typedef typename std::complex<T> eT;
+  
+  const eT mean_val = op_mean::direct_mean(X, n_elem);
+  
+  T acc = T(0);
+  
+  for(uword i=0; i<n_elem; ++i)
+    {
+    acc += std::norm(X[i] - mean_val);
+    }
+  
+  out_mean = mean_val;
+  out_m2   = acc;
+  }
+
+
+
+//! combine the statistics of two disjoint sets of samples; the result is stored in the first set
+template<typename eT>
+inline
+void
+op_var::merge_stats(uword& N_a, eT& mean_a, typename get_pod_type<eT>::result& m2_a, const uword N_b, const eT mean_b, const typename get_pod_type<eT>::result m2_b)
+  {
+  typedef typename get_pod_type<eT>::result T;
+  
+  if(N_b == 0)  { return; }
+  
+  if(N_a == 0)
+    {
+    N_a    = N_b;
+    mean_a = mean_b;
+    m2_a   = m2_b;
+    
+    return;
+    }
+  
+  const uword N = N_a + N_b;
+  
+  const T ratio_b = T(N_b) / T(N);
+  const eT delta  = mean_b - mean_a;
+  
+  mean_a += delta * ratio_b;
+  m2_a   += m2_b + op_var::sq_abs(delta) * T(N_a) * ratio_b;
+  N_a     = N;
+  }
+
+
+
+//! @}
@@ -100,6 +100,13 @@ operator%
   
   if( (pa.get_n_nonzero() != 0) && (pb.get_n_nonzero() != 0) )
     {
+    if( (SpProxy<T1>::use_iterator == false) && (SpProxy<T2>::use_iterator == false) )
+      {
+      sp_merge_helper::apply< sp_merge_helper::merge_schur<eT> >(result, pa, pb);
+      
+      return result;
+      }
+    
     // Resize memory to correct size.
     result.mem_resize(n_unique(x, y, op_n_unique_mul()));
     
@@ -260,6 +267,126 @@ operator%
 
 
 
+//! element-wise multiplication of a dense matrix product and a sparse object;
+//! the product is only evaluated at the locations of the non-zero elements of the sparse object
+template<typename T1, typename T2, typename T3>
+inline
+typename
+enable_if2
+  <
+  (is_arma_sparse_type<T3>::value && is_same_type<typename T1::elem_type, typename T3::elem_type>::value),
+  SpMat<typename T1::elem_type>
+  >::result
+operator%
+  (
+  const Glue<T1, T2, glue_times>& x,
+  const T3&                       y
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  SpMat<typename T1::elem_type> result;
+  
+  spglue_times_masked::apply(result, x, y);
+  
+  return result;
+  }
+
+
+
+//! element-wise multiplication of a sparse object and a dense matrix product
+template<typename T1, typename T2, typename T3>
+inline
+typename
+enable_if2
+  <
+  (is_arma_sparse_type<T3>::value && is_same_type<typename T1::elem_type, typename T3::elem_type>::value),
+  SpMat<typename T1::elem_type>
+  >::result
+operator%
+  (
+  const T3&                       x,
+  const Glue<T1, T2, glue_times>& y
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  SpMat<typename T1::elem_type> result;
+  
+  spglue_times_masked::apply(result, y, x);
+  
+  return result;
+  }
+
+
+
+//! element-wise multiplication of a sparse matrix product and a sparse object;
+//! the product is only evaluated at the locations of the non-zero elements of the sparse object
+template<typename T1, typename T2, typename T3>
+inline
+SpMat<typename T1::elem_type>
+operator%
+  (
+  const SpGlue<T1, T2, spglue_times>&     x,
+  const SpBase<typename T1::elem_type,T3>& y
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  SpMat<typename T1::elem_type> result;
+  
+  spglue_times_masked::apply(result, x, y);
+  
+  return result;
+  }
+
+
+
+//! element-wise multiplication of a sparse object and a sparse matrix product
+template<typename T1, typename T2, typename T3>
+inline
+SpMat<typename T1::elem_type>
+operator%
+  (
+  const SpBase<typename T1::elem_type,T3>& x,
+  const SpGlue<T1, T2, spglue_times>&     y
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  SpMat<typename T1::elem_type> result;
+  
+  spglue_times_masked::apply(result, y, x);
+  
+  return result;
+  }
+
+
+
+//! element-wise multiplication of two sparse matrix products;
+//! the first product is evaluated in full and used as the mask for the second
+template<typename T1, typename T2, typename T3, typename T4>
+inline
+SpMat<typename T1::elem_type>
+operator%
+  (
+  const SpGlue<T1, T2, spglue_times>& x,
+  const SpGlue<T3, T4, spglue_times>& y
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  const SpMat<typename T1::elem_type> tmp(x);
+  
+  SpMat<typename T1::elem_type> result;
+  
+  spglue_times_masked::apply(result, y, tmp);
+  
+  return result;
+  }
+
+
+
 template<typename parent, unsigned int mode, typename T2>
 inline
 Mat<typename parent::elem_type>
@@ -509,6 +509,74 @@ operator*
 
 
 
+//! multiplication of a transposed sparse matrix and a dense object;
+//! the columns of the sparse matrix are the rows of the transpose,
+//! so each element of the result is a dot product with a column and the transpose is not formed
+template<typename T1, typename spop_type, typename T2>
+inline
+typename
+enable_if2
+  <
+  (
+     is_arma_type<T2>::value
+  && is_same_type<typename T1::elem_type, typename T2::elem_type>::value
+  && (is_same_type<spop_type, spop_strans>::value || is_same_type<spop_type, spop_htrans>::value)
+  ),
+  Mat<typename T1::elem_type>
+  >::result
+operator*
+  (
+  const SpOp<T1,spop_type>& x,
+  const T2&                 y
+  )
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> UA(x.m);
+  const quasi_unwrap<T2> UB(y);
+  
+  const SpMat<eT>& A = UA.M;
+  const   Mat<eT>& B = UB.M;
+  
+  arma_debug_assert_mul_size(A.n_cols, A.n_rows, B.n_rows, B.n_cols, "matrix multiplication");
+  
+  Mat<eT> result(A.n_cols, B.n_cols);
+  
+  const bool do_conj = is_same_type<spop_type, spop_htrans>::value;
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  const eT*    A_values      = A.values;
+  
+  for(uword col=0; col < B.n_cols; ++col)
+    {
+    const eT*      B_col = B.colptr(col);
+          eT* result_col = result.colptr(col);
+    
+    for(uword i=0; i < A.n_cols; ++i)
+      {
+      const uword k_end = A_col_ptrs[i + 1];
+      
+      eT acc = eT(0);
+      
+      for(uword k = A_col_ptrs[i]; k < k_end; ++k)
+        {
+        const eT A_val = (do_conj) ? eT(access::alt_conj(A_values[k])) : A_values[k];
+        
+        acc += A_val * B_col[ A_row_indices[k] ];
+        }
+      
+      result_col[i] = acc;
+      }
+    }
+  
+  return result;
+  }
+
+
+
 //! multiplication of one dense and one sparse object
 template<typename T1, typename T2>
 inline
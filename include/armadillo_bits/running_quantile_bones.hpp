@@ -0,0 +1,83 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_quantile
+//! @{
+
+
+
+//! Class for estimating quantiles of a continuously sampled process / signal,
+//! using a bounded amount of memory.
+//! The samples are kept in a hierarchy of compactors (as in the KLL sketch):
+//! when a level is full, it is sorted and every second sample is promoted
+//! to the next level, where each sample represents twice as many samples.
+//! The quantiles are exact as long as no compaction has taken place.
+//! Estimators built from separate parts of the data (eg. by separate threads) can be merged.
+template<typename eT>
+class running_quantile
+  {
+  public:
+  
+  inline ~running_quantile();
+  inline explicit running_quantile(const uword in_k = 200);
+  
+  inline void operator() (const eT sample);
+  
+  template<typename T1> inline void operator() (const Base<eT,T1>& X);
+  
+  inline void merge(const running_quantile& in);
+  
+  inline void reset();
+  
+  inline eT quantile(const eT P) const;
+  
+  template<typename T1> inline Mat<eT> quantile(const Base<eT,T1>& P) const;
+  
+  inline uword count() const;
+  
+  inline eT min() const;
+  inline eT max() const;
+  
+  inline bool is_exact() const;
+  
+  //
+  //
+  
+  private:
+  
+  inline void update_capacity();
+  inline bool compress();
+  inline void insert(const eT* X_mem, const uword N);
+  
+  inline void quantiles_exact (eT* out_mem, const Mat<eT>& P) const;
+  inline void quantiles_approx(eT* out_mem, const Mat<eT>& P) const;
+  
+  arma_aligned uword k;
+  arma_aligned uword n_samples;
+  arma_aligned uword n_stored;
+  arma_aligned uword total_capacity;
+  
+  arma_aligned eT min_val;
+  arma_aligned eT max_val;
+  
+  arma_aligned std::vector< std::vector<eT> > levels;
+  arma_aligned std::vector< uword >           level_capacity;
+  arma_aligned std::vector< uword >           level_offset;
+  };
+
+
+
+//! @}
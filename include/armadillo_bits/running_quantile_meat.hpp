@@ -0,0 +1,481 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup running_quantile
+//! @{
+
+
+
+template<typename eT>
+inline
+running_quantile<eT>::~running_quantile()
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+//! in_k sets the capacity of the top level, which determines the accuracy;
+//! the rank error of the estimated quantiles is roughly proportional to 1/in_k
+template<typename eT>
+inline
+running_quantile<eT>::running_quantile(const uword in_k)
+  : k              ( (std::max)(in_k, uword(8)) )
+  , n_samples      (0)
+  , n_stored       (0)
+  , total_capacity (0)
+  , min_val        (eT(0))
+  , max_val        (eT(0))
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  arma_type_check(( is_real<eT>::value == false ));
+  
+  reset();
+  }
+
+
+
+//! update the estimator to reflect new sample
+template<typename eT>
+inline
+void
+running_quantile<eT>::operator() (const eT sample)
+  {
+  arma_extra_debug_sigprint();
+  
+  if( arma_isfinite(sample) == false )
+    {
+    arma_debug_warn("running_quantile: sample ignored as it is non-finite" );
+    return;
+    }
+  
+  if(n_samples > 0)
+    {
+    if(sample < min_val)  { min_val = sample; }
+    if(sample > max_val)  { max_val = sample; }
+    }
+  else
+    {
+    min_val = sample;
+    max_val = sample;
+    }
+  
+  ++n_samples;
+  
+  levels[0].push_back(sample);
+  
+  ++n_stored;
+  
+  if(n_stored >= total_capacity)  { compress(); }
+  }
+
+
+
+//! update the estimator to reflect a block of new samples;
+//! long blocks are split across threads, with each thread building a separate estimator
+template<typename eT>
+template<typename T1>
+inline
+void
+running_quantile<eT>::operator() (const Base<eT,T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  
+  const eT*   X_mem = U.M.memptr();
+  const uword N     = U.M.n_elem;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int   n_threads = mp_thread_limit::get();
+    const uword n_chunks  = uword(n_threads);
+    
+    if( (n_threads >= 2) && (N >= (16 * k * n_chunks)) && mp_gate<eT>::eval(N) )
+      {
+      const uword chunk_size = N / n_chunks;
+      
+      std::vector< running_quantile<eT> > parts(n_chunks, running_quantile<eT>(k));
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        const uword start  = chunk * chunk_size;
+        const uword end_p1 = (chunk == (n_chunks-1)) ? N : (start + chunk_size);
+        
+        parts[chunk].insert(&(X_mem[start]), end_p1 - start);
+        }
+      
+      for(uword chunk=0; chunk < n_chunks; ++chunk)  { merge(parts[chunk]); }
+      
+      return;
+      }
+    }
+  #endif
+  
+  insert(X_mem, N);
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_quantile<eT>::insert(const eT* X_mem, const uword N)
+  {
+  arma_extra_debug_sigprint();
+  
+  for(uword i=0; i < N; ++i)  { (*this)(X_mem[i]); }
+  }
+
+
+
+//! merge the samples summarised by another estimator
+template<typename eT>
+inline
+void
+running_quantile<eT>::merge(const running_quantile<eT>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(in.n_samples == 0)  { return; }
+  
+  if(&in == this)
+    {
+    const running_quantile<eT> tmp(in);
+    
+    merge(tmp);
+    
+    return;
+    }
+  
+  if(n_samples > 0)
+    {
+    if(in.min_val < min_val)  { min_val = in.min_val; }
+    if(in.max_val > max_val)  { max_val = in.max_val; }
+    }
+  else
+    {
+    min_val = in.min_val;
+    max_val = in.max_val;
+    }
+  
+  n_samples += in.n_samples;
+  
+  while(levels.size() < in.levels.size())
+    {
+    levels.push_back( std::vector<eT>() );
+    level_offset.push_back(0);
+    }
+  
+  for(uword level=0; level < in.levels.size(); ++level)
+    {
+    levels[level].insert( levels[level].end(), in.levels[level].begin(), in.levels[level].end() );
+    }
+  
+  n_stored += in.n_stored;
+  
+  update_capacity();
+  
+  while( (n_stored >= total_capacity) && compress() )  { ; }
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_quantile<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  n_samples = 0;
+  n_stored  = 0;
+  
+  min_val = eT(0);
+  max_val = eT(0);
+  
+  levels.clear();
+  level_offset.clear();
+  
+  levels.push_back( std::vector<eT>() );
+  level_offset.push_back(0);
+  
+  update_capacity();
+  }
+
+
+
+//! capacity of each level; lower levels hold fewer samples, as each sample there represents fewer samples
+template<typename eT>
+inline
+void
+running_quantile<eT>::update_capacity()
+  {
+  const uword n_levels = uword(levels.size());
+  
+  level_capacity.resize(n_levels);
+  
+  total_capacity = 0;
+  
+  for(uword level=0; level < n_levels; ++level)
+    {
+    const uword depth = n_levels - 1 - level;
+    
+    const uword cap = uword( std::ceil( double(k) * std::pow(double(2)/double(3), double(depth)) ) );
+    
+    level_capacity[level] = (std::max)(cap, uword(2));
+    
+    total_capacity += level_capacity[level];
+    }
+  }
+
+
+
+//! compact the lowest level that is at capacity, promoting every second sample (in sorted order) to the next level;
+//! the starting position alternates between compactions, so that the rank errors tend to cancel out
+template<typename eT>
+inline
+bool
+running_quantile<eT>::compress()
+  {
+  arma_extra_debug_sigprint();
+  
+  uword level = 0;
+  
+  while( (level < levels.size()) && (levels[level].size() < level_capacity[level]) )  { ++level; }
+  
+  if(level == levels.size())  { return false; }
+  
+  if( (level+1) == levels.size() )
+    {
+    levels.push_back( std::vector<eT>() );
+    level_offset.push_back(0);
+    
+    update_capacity();
+    }
+  
+  std::vector<eT>& cur = levels[level  ];
+  std::vector<eT>& nxt = levels[level+1];
+  
+  std::sort( cur.begin(), cur.end() );
+  
+  const uword n_pairs = uword(cur.size()) / 2;
+  const uword offset  = level_offset[level];
+  
+  level_offset[level] = 1 - offset;
+  
+  for(uword i=0; i < n_pairs; ++i)  { nxt.push_back( cur[2*i + offset] ); }
+  
+  // with an odd number of samples, the largest one stays in the current level
+  
+  if( (cur.size() % 2) == 1 )
+    {
+    const eT last = cur.back();
+    
+    cur.clear();
+    cur.push_back(last);
+    }
+  else
+    {
+    cur.clear();
+    }
+  
+  n_stored -= n_pairs;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+running_quantile<eT>::is_exact() const
+  {
+  return (levels.size() == 1);
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_quantile<eT>::quantiles_exact(eT* out_mem, const Mat<eT>& P) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = uword(levels[0].size());
+  
+  podarray<eT> Y( &(levels[0][0]), N );
+  
+  glue_quantile::worker(out_mem, Y.memptr(), N, P);
+  }
+
+
+
+//! each sample in level L represents 2^L samples;
+//! the quantile is the sample whose cumulative weight covers the target rank
+template<typename eT>
+inline
+void
+running_quantile<eT>::quantiles_approx(eT* out_mem, const Mat<eT>& P) const
+  {
+  arma_extra_debug_sigprint();
+  
+  std::vector< std::pair<eT,uword> > items;
+  
+  for(uword level=0; level < levels.size(); ++level)
+    {
+    const std::vector<eT>& cur = levels[level];
+    
+    const uword weight = uword(1) << level;
+    
+    for(uword i=0; i < cur.size(); ++i)  { items.push_back( std::pair<eT,uword>(cur[i], weight) ); }
+    }
+  
+  std::sort( items.begin(), items.end() );
+  
+  const uword n_items = uword(items.size());
+  
+  podarray<double> cum_weight(n_items);
+  
+  double total = 0.0;
+  
+  for(uword i=0; i < n_items; ++i)
+    {
+    total += double(items[i].second);
+    
+    cum_weight[i] = total;
+    }
+  
+  const eT*   P_mem    = P.memptr();
+  const uword P_n_elem = P.n_elem;
+  
+  for(uword j=0; j < P_n_elem; ++j)
+    {
+    const eT P_j = P_mem[j];
+    
+    if(P_j <= eT(0))  { out_mem[j] = min_val; continue; }
+    if(P_j >= eT(1))  { out_mem[j] = max_val; continue; }
+    
+    const double rank = (std::min)( (std::max)( double(P_j) * total - 0.5, 0.0 ), total - 1.0 );
+    
+    const uword index = uword( std::upper_bound(cum_weight.memptr(), cum_weight.memptr() + n_items, rank) - cum_weight.memptr() );
+    
+    out_mem[j] = (index < n_items) ? items[index].first : max_val;
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+running_quantile<eT>::quantile(const Base<eT,T1>& X) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X.get_ref());
+  const Mat<eT>& P     = U.M;
+  
+  arma_debug_check( ((P.is_vec() == false) && (P.is_empty() == false)), "running_quantile::quantile(): parameter 'P' must be a vector" );
+  
+  const eT*   P_mem    = P.memptr();
+  const uword P_n_elem = P.n_elem;
+  
+  for(uword i=0; i < P_n_elem; ++i)
+    {
+    const eT P_i = P_mem[i];
+    
+    arma_debug_check( ((P_i < eT(0)) || (P_i > eT(1)) || arma_isnan(P_i)), "running_quantile::quantile(): parameter 'P' must contain values in the [0,1] interval" );
+    }
+  
+  Mat<eT> out(P.n_rows, P.n_cols);
+  
+  if(n_samples == 0)
+    {
+    out.fill(Datum<eT>::nan);
+    }
+  else
+  if(is_exact())
+    {
+    quantiles_exact(out.memptr(), P);
+    }
+  else
+    {
+    quantiles_approx(out.memptr(), P);
+    }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+eT
+running_quantile<eT>::quantile(const eT P) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<eT> PP(1);
+  
+  PP[0] = P;
+  
+  const Mat<eT> out = (*this).quantile(PP);
+  
+  return out[0];
+  }
+
+
+
+//! number of samples so far
+template<typename eT>
+inline
+uword
+running_quantile<eT>::count() const
+  {
+  return n_samples;
+  }
+
+
+
+//! minimum value so far
+template<typename eT>
+inline
+eT
+running_quantile<eT>::min() const
+  {
+  return min_val;
+  }
+
+
+
+//! maximum value so far
+template<typename eT>
+inline
+eT
+running_quantile<eT>::max() const
+  {
+  return max_val;
+  }
+
+
+
+//! @}
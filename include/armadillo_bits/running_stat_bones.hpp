@@ -30,7 +30,11 @@ class arma_counter
   inline const arma_counter& operator++();
   inline void                operator++(int);
   
+  inline const arma_counter& operator+=(const uword N);
+  inline const arma_counter& operator+=(const arma_counter& in);
+  
   inline void reset();
+  inline void set_value(const eT val);
   inline eT   value()         const;
   inline eT   value_plus_1()  const;
   inline eT   value_minus_1() const;
@@ -62,6 +66,11 @@ class running_stat
   inline void operator() (const T sample);
   inline void operator() (const std::complex<T>& sample);
   
+  template<typename T1> inline void operator() (const Base<              T, T1>& X);
+  template<typename T1> inline void operator() (const Base<std::complex<T>, T1>& X);
+  
+  inline void merge(const running_stat& in);
+  
   inline void reset();
   
   inline eT mean() const;
@@ -75,6 +84,9 @@ class running_stat
   
   inline T count() const;
   
+  inline bool save(std::ostream& os) const;
+  inline bool load(std::istream& is);
+  
   //
   //
   
@@ -112,6 +124,24 @@ class running_stat_aux
   
   template<typename eT>
   inline static void update_stats(running_stat<eT>& x, const eT& sample, const typename arma_cx_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void update_stats_batch(running_stat<eT>& x, const Mat<eT>& samples);
+  
+  template<typename eT>
+  inline static void update_stats_batch(running_stat<eT>& x, const Mat< std::complex<eT> >& samples, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void update_stats_batch(running_stat<eT>& x, const Mat<typename eT::value_type>& samples, const typename arma_cx_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_not_cx<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_cx_only<eT>::result* junk = 0);
+  
+  template<typename eT>
+  inline static void merge_moments(running_stat<eT>& x, const running_stat<eT>& y);
   };
 
 
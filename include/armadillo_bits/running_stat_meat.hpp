@@ -69,6 +69,39 @@ arma_counter<eT>::operator++(int)
 
 
 
+template<typename eT>
+inline
+const arma_counter<eT>&
+arma_counter<eT>::operator+=(const uword N)
+  {
+  if(i_count <= (ARMA_MAX_UWORD - N))
+    {
+    i_count += N;
+    }
+  else
+    {
+    d_count += eT(i_count);
+    d_count += eT(N);
+    i_count  = 0;
+    }
+  
+  return *this;
+  }
+
+
+
+template<typename eT>
+inline
+const arma_counter<eT>&
+arma_counter<eT>::operator+=(const arma_counter<eT>& in)
+  {
+  d_count += in.d_count;
+  
+  return (*this).operator+=(in.i_count);
+  }
+
+
+
 template<typename eT>
 inline
 void
@@ -80,6 +113,17 @@ arma_counter<eT>::reset()
 
 
 
+template<typename eT>
+inline
+void
+arma_counter<eT>::set_value(const eT val)
+  {
+  d_count = val;
+  i_count = uword(0);
+  }
+
+
+
 template<typename eT>
 inline
 eT
@@ -190,6 +234,85 @@ running_stat<eT>::operator() (const std::complex< typename running_stat<eT>::T >
 
 
 
+//! update statistics to reflect a block of new samples;
+//! the statistics of the block are computed separately and then merged
+template<typename eT>
+template<typename T1>
+inline
+void
+running_stat<eT>::operator() (const Base<typename running_stat<eT>::T, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  const Mat<T>& samples = tmp.M;
+  
+  if(samples.is_empty())  { return; }
+  
+  if(samples.is_finite() == false)
+    {
+    const uword N = samples.n_elem;
+    
+    for(uword i=0; i<N; ++i)  { (*this).operator()(samples[i]); }
+    
+    return;
+    }
+  
+  running_stat_aux::update_stats_batch(*this, samples);
+  }
+
+
+
+//! update statistics to reflect a block of new samples (version for complex numbers)
+template<typename eT>
+template<typename T1>
+inline
+void
+running_stat<eT>::operator() (const Base<std::complex<typename running_stat<eT>::T>, T1>& X)
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> tmp(X.get_ref());
+  const Mat< std::complex<T> >& samples = tmp.M;
+  
+  if(samples.is_empty())  { return; }
+  
+  if(samples.is_finite() == false)
+    {
+    const uword N = samples.n_elem;
+    
+    for(uword i=0; i<N; ++i)  { (*this).operator()(samples[i]); }
+    
+    return;
+    }
+  
+  running_stat_aux::update_stats_batch(*this, samples);
+  }
+
+
+
+//! combine with the statistics of another set of samples, eg. one gathered by another thread
+template<typename eT>
+inline
+void
+running_stat<eT>::merge(const running_stat<eT>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this == &in)
+    {
+    const running_stat<eT> tmp(in);
+    
+    running_stat_aux::merge_stats(*this, tmp);
+    }
+  else
+    {
+    running_stat_aux::merge_stats(*this, in);
+    }
+  }
+
+
+
 //! set all statistics to zero
 template<typename eT>
 inline
@@ -321,6 +444,56 @@ running_stat<eT>::count() const
 
 
 
+//! save the internal state, so that it can be restored or merged in another process
+template<typename eT>
+inline
+bool
+running_stat<eT>::save(std::ostream& os) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<eT> state(7);
+  
+  state[0] = eT(counter.value());
+  state[1] = r_mean;
+  state[2] = eT(r_var);
+  state[3] = min_val;
+  state[4] = max_val;
+  state[5] = eT(min_val_norm);
+  state[6] = eT(max_val_norm);
+  
+  return state.quiet_save(os, arma_binary);
+  }
+
+
+
+template<typename eT>
+inline
+bool
+running_stat<eT>::load(std::istream& is)
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<eT> state;
+  
+  const bool load_okay = state.quiet_load(is, arma_binary) && (state.n_elem == 7);
+  
+  if(load_okay == false)  { return false; }
+  
+  counter.set_value( access::tmp_real(state[0]) );
+  
+  r_mean       = state[1];
+  r_var        = access::tmp_real(state[2]);
+  min_val      = state[3];
+  max_val      = state[4];
+  min_val_norm = access::tmp_real(state[5]);
+  max_val_norm = access::tmp_real(state[6]);
+  
+  return true;
+  }
+
+
+
 //! update statistics to reflect new sample (version for non-complex numbers, non-complex sample)
 template<typename eT>
 inline
@@ -458,4 +631,152 @@ running_stat_aux::update_stats(running_stat<eT>& x, const eT& sample, const type
 
 
 
+//! update statistics to reflect a block of new samples
+template<typename eT>
+inline
+void
+running_stat_aux::update_stats_batch(running_stat<eT>& x, const Mat<eT>& samples)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename running_stat<eT>::T T;
+  
+  const eT*   mem = samples.memptr();
+  const uword N   = samples.n_elem;
+  
+  running_stat<eT> y;
+  
+  T r_m2 = T(0);
+  
+  op_var::direct_stats(y.r_mean, r_m2, mem, N);
+  
+  y.r_var = (N > 1) ? (r_m2 / T(N-1)) : T(0);
+  
+  y.min_val = op_min::direct_min(mem, N);
+  y.max_val = op_max::direct_max(mem, N);
+  
+  y.min_val_norm = op_var::sq_abs(y.min_val);
+  y.max_val_norm = op_var::sq_abs(y.max_val);
+  
+  y.counter += N;
+  
+  running_stat_aux::merge_stats(x, y);
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_stat_aux::update_stats_batch(running_stat<eT>& x, const Mat< std::complex<eT> >& samples, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const Mat<eT> tmp = real(samples);
+  
+  running_stat_aux::update_stats_batch(x, tmp);
+  }
+
+
+
+template<typename eT>
+inline
+void
+running_stat_aux::update_stats_batch(running_stat<eT>& x, const Mat<typename eT::value_type>& samples, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  const Mat<eT> tmp = conv_to< Mat<eT> >::from(samples);
+  
+  running_stat_aux::update_stats_batch(x, tmp);
+  }
+
+
+
+//! merge statistics of two sets of samples (version for non-complex numbers)
+template<typename eT>
+inline
+void
+running_stat_aux::merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_not_cx<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat<eT>::T T;
+  
+  if(y.counter.value() == T(0))  { return; }
+  
+  if(x.counter.value() == T(0))  { x = y; return; }
+  
+  if(y.min_val < x.min_val)  { x.min_val = y.min_val; }
+  if(y.max_val > x.max_val)  { x.max_val = y.max_val; }
+  
+  running_stat_aux::merge_moments(x, y);
+  }
+
+
+
+//! merge statistics of two sets of samples (version for complex numbers)
+template<typename eT>
+inline
+void
+running_stat_aux::merge_stats(running_stat<eT>& x, const running_stat<eT>& y, const typename arma_cx_only<eT>::result* junk)
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat<eT>::T T;
+  
+  if(y.counter.value() == T(0))  { return; }
+  
+  if(x.counter.value() == T(0))  { x = y; return; }
+  
+  if(y.min_val_norm < x.min_val_norm)
+    {
+    x.min_val_norm = y.min_val_norm;
+    x.min_val      = y.min_val;
+    }
+  
+  if(y.max_val_norm > x.max_val_norm)
+    {
+    x.max_val_norm = y.max_val_norm;
+    x.max_val      = y.max_val;
+    }
+  
+  running_stat_aux::merge_moments(x, y);
+  }
+
+
+
+//! combine mean and variance via the parallel algorithm of Chan, Golub and LeVeque
+template<typename eT>
+inline
+void
+running_stat_aux::merge_moments(running_stat<eT>& x, const running_stat<eT>& y)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename running_stat<eT>::T T;
+  
+  const T N_a = x.counter.value();
+  const T N_b = y.counter.value();
+  
+  x.counter += y.counter;
+  
+  const T N         = x.counter.value();
+  const T N_minus_1 = x.counter.value_minus_1();
+  
+  const T m2_a = (N_a > T(1)) ? (x.r_var * (N_a - T(1))) : T(0);
+  const T m2_b = (N_b > T(1)) ? (y.r_var * (N_b - T(1))) : T(0);
+  
+  const eT delta = y.r_mean - x.r_mean;
+  
+  x.r_mean += delta * (N_b / N);
+  x.r_var   = (m2_a + m2_b + op_var::sq_abs(delta) * (N_a / N) * N_b) / N_minus_1;
+  }
+
+
+
 //! @}
@@ -65,6 +65,8 @@ class running_stat_vec
   template<typename T1> arma_hot inline void operator() (const Base<              T, T1>& X);
   template<typename T1> arma_hot inline void operator() (const Base<std::complex<T>, T1>& X);
   
+  inline void merge(const running_stat_vec& in);
+  
   inline void reset();
   
   inline const return_type1&  mean() const;
@@ -79,6 +81,9 @@ class running_stat_vec
   
   inline T count() const;
   
+  inline bool save(std::ostream& os) const;
+  inline bool load(std::istream& is);
+  
   //
   //
   
@@ -148,6 +153,70 @@ class running_stat_vec_aux
     const                   Mat<typename running_stat_vec<obj_type>::eT>& sample,
     const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
     );
+  
+  //
+  
+  template<typename obj_type>
+  inline static bool samples_in_rows(const running_stat_vec<obj_type>& x);
+  
+  template<typename obj_type>
+  inline static void
+  update_stats_batch
+    (
+    running_stat_vec<obj_type>& x,
+    const                  Mat<typename running_stat_vec<obj_type>::eT>& samples,
+    const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  update_stats_batch
+    (
+    running_stat_vec<obj_type>& x,
+    const          Mat<std::complex< typename running_stat_vec<obj_type>::T > >& samples,
+    const typename       arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  update_stats_batch
+    (
+    running_stat_vec<obj_type>& x,
+    const                  Mat< typename running_stat_vec<obj_type>::T >& samples,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  update_stats_batch
+    (
+    running_stat_vec<obj_type>& x,
+    const                   Mat<typename running_stat_vec<obj_type>::eT>& samples,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  //
+  
+  template<typename obj_type>
+  inline static void
+  merge_stats
+    (
+    running_stat_vec<obj_type>& x,
+    const running_stat_vec<obj_type>& y,
+    const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static void
+  merge_stats
+    (
+    running_stat_vec<obj_type>& x,
+    const running_stat_vec<obj_type>& y,
+    const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk = 0
+    );
+  
+  template<typename obj_type>
+  inline static bool merge_init(running_stat_vec<obj_type>& x, const running_stat_vec<obj_type>& y);
   };
 
 
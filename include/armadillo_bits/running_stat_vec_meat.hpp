@@ -97,6 +97,27 @@ running_stat_vec<obj_type>::operator() (const Base<typename running_stat_vec<obj
     return;
     }
   
+  if( sample.is_vec() == false )
+    {
+    // block of samples; each column (or each row, for row vectors) is one sample
+    
+    if( sample.is_finite() )
+      {
+      running_stat_vec_aux::update_stats_batch(*this, sample);
+      }
+    else
+    if( running_stat_vec_aux::samples_in_rows(*this) )
+      {
+      for(uword row=0; row < sample.n_rows; ++row)  { (*this).operator()(sample.row(row)); }
+      }
+    else
+      {
+      for(uword col=0; col < sample.n_cols; ++col)  { (*this).operator()(sample.col(col)); }
+      }
+    
+    return;
+    }
+  
   if( sample.is_finite() == false )
     {
     arma_debug_warn("running_stat_vec: sample ignored as it has non-finite elements");
@@ -126,6 +147,27 @@ running_stat_vec<obj_type>::operator() (const Base< std::complex<typename runnin
     return;
     }
   
+  if( sample.is_vec() == false )
+    {
+    // block of samples; each column (or each row, for row vectors) is one sample
+    
+    if( sample.is_finite() )
+      {
+      running_stat_vec_aux::update_stats_batch(*this, sample);
+      }
+    else
+    if( running_stat_vec_aux::samples_in_rows(*this) )
+      {
+      for(uword row=0; row < sample.n_rows; ++row)  { (*this).operator()(sample.row(row)); }
+      }
+    else
+      {
+      for(uword col=0; col < sample.n_cols; ++col)  { (*this).operator()(sample.col(col)); }
+      }
+    
+    return;
+    }
+  
   if( sample.is_finite() == false )
     {
     arma_debug_warn("running_stat_vec: sample ignored as it has non-finite elements");
@@ -137,6 +179,28 @@ running_stat_vec<obj_type>::operator() (const Base< std::complex<typename runnin
 
 
 
+//! combine with the statistics of another set of samples, eg. one gathered by another thread
+template<typename obj_type>
+inline
+void
+running_stat_vec<obj_type>::merge(const running_stat_vec<obj_type>& in)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(this == &in)
+    {
+    const running_stat_vec<obj_type> tmp(in);
+    
+    running_stat_vec_aux::merge_stats(*this, tmp);
+    }
+  else
+    {
+    running_stat_vec_aux::merge_stats(*this, in);
+    }
+  }
+
+
+
 //! set all statistics to zero
 template<typename obj_type>
 inline
@@ -345,6 +409,84 @@ running_stat_vec<obj_type>::count() const
 
 
 
+//! save the internal state, so that it can be restored or merged in another process
+template<typename obj_type>
+inline
+bool
+running_stat_vec<obj_type>::save(std::ostream& os) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<T> info(2);
+  
+  info[0] = counter.value();
+  info[1] = (calc_cov) ? T(1) : T(0);
+  
+  bool save_okay = info.quiet_save(os, arma_binary);
+  
+  save_okay = save_okay && r_mean.quiet_save(os, arma_binary);
+  save_okay = save_okay && r_var.quiet_save(os, arma_binary);
+  save_okay = save_okay && r_cov.quiet_save(os, arma_binary);
+  save_okay = save_okay && min_val.quiet_save(os, arma_binary);
+  save_okay = save_okay && max_val.quiet_save(os, arma_binary);
+  save_okay = save_okay && min_val_norm.quiet_save(os, arma_binary);
+  save_okay = save_okay && max_val_norm.quiet_save(os, arma_binary);
+  
+  return save_okay;
+  }
+
+
+
+template<typename obj_type>
+inline
+bool
+running_stat_vec<obj_type>::load(std::istream& is)
+  {
+  arma_extra_debug_sigprint();
+  
+  Col<T>  info;
+  Mat<eT> tmp_mean;
+  Mat<T>  tmp_var;
+  Mat<eT> tmp_cov;
+  Mat<eT> tmp_min_val;
+  Mat<eT> tmp_max_val;
+  Mat<T>  tmp_min_val_norm;
+  Mat<T>  tmp_max_val_norm;
+  
+  bool load_okay = info.quiet_load(is, arma_binary) && (info.n_elem == 2);
+  
+  load_okay = load_okay && tmp_mean.quiet_load(is, arma_binary);
+  load_okay = load_okay && tmp_var.quiet_load(is, arma_binary);
+  load_okay = load_okay && tmp_cov.quiet_load(is, arma_binary);
+  load_okay = load_okay && tmp_min_val.quiet_load(is, arma_binary);
+  load_okay = load_okay && tmp_max_val.quiet_load(is, arma_binary);
+  load_okay = load_okay && tmp_min_val_norm.quiet_load(is, arma_binary);
+  load_okay = load_okay && tmp_max_val_norm.quiet_load(is, arma_binary);
+  
+  if(load_okay == false)  { return false; }
+  
+  (*this).reset();
+  
+  access::rw(calc_cov) = (info[1] != T(0));
+  
+  if(info[0] > T(0))
+    {
+    counter.set_value(info[0]);
+    
+    r_mean       = tmp_mean;
+    r_var        = tmp_var;
+    r_cov        = tmp_cov;
+    min_val      = tmp_min_val;
+    max_val      = tmp_max_val;
+    min_val_norm = tmp_min_val_norm;
+    max_val_norm = tmp_max_val_norm;
+    }
+  
+  return true;
+  }
+
+
+
 //
 
 
@@ -385,21 +527,23 @@ running_stat_vec_aux::update_stats
     if(x.calc_cov)
       {
       Mat<eT>& tmp1 = x.tmp1;
-      Mat<eT>& tmp2 = x.tmp2;
       
       tmp1 = sample - x.r_mean;
       
+      // r_cov = (N_minus_1/N) * r_cov + (tmp1 * trans(tmp1)) / N_plus_1,
+      // computed in one sweep over r_cov and exploiting symmetry
+      
+      const eT alpha = eT(1) / eT(N_plus_1);
+      const eT beta  = eT(N_minus_1 / N);
+      
       if(sample.n_cols == 1)
         {
-        tmp2 = tmp1*trans(tmp1);
+        syrk_vec<false, true, true>::apply(x.r_cov, tmp1, alpha, beta);
         }
       else
         {
-        tmp2 = trans(tmp1)*tmp1;
+        syrk_vec<true, true, true>::apply(x.r_cov, tmp1, alpha, beta);
         }
-      
-      x.r_cov *= (N_minus_1/N);
-      x.r_cov += tmp2 / N_plus_1;
       }
     
     
@@ -633,4 +777,467 @@ running_stat_vec_aux::update_stats
 
 
 
+//! determine whether the rows of a block of samples are the individual samples
+template<typename obj_type>
+inline
+bool
+running_stat_vec_aux::samples_in_rows(const running_stat_vec<obj_type>& x)
+  {
+  typedef typename running_stat_vec<obj_type>::T            T;
+  typedef typename running_stat_vec<obj_type>::return_type1 return_type1;
+  
+  if(is_Row<return_type1>::value)  { return true; }
+  
+  return ( (x.counter.value() > T(0)) && (x.r_mean.n_rows == 1) && (x.r_mean.n_cols > 1) );
+  }
+
+
+
+//! update statistics to reflect a block of new samples (version for non-complex numbers);
+//! the statistics of the block are computed in one sweep and then merged
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::update_stats_batch
+  (
+  running_stat_vec<obj_type>& x,
+  const                  Mat<typename running_stat_vec<obj_type>::eT>& samples,
+  const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  const bool in_rows = running_stat_vec_aux::samples_in_rows(x);
+  
+  Mat<eT> samples_t;
+  
+  if(in_rows)  { op_strans::apply_mat_noalias(samples_t, samples); }
+  
+  // each column of S is one sample
+  const Mat<eT>& S = (in_rows) ? samples_t : samples;
+  
+  const uword n_dim = S.n_rows;
+  const uword N     = S.n_cols;
+  
+  const uword out_n_rows = (in_rows) ? uword(1) : n_dim;
+  const uword out_n_cols = (in_rows) ? n_dim    : uword(1);
+  
+  running_stat_vec<obj_type> y(x.calc_cov);
+  
+  y.r_mean.set_size (out_n_rows, out_n_cols);
+  y.r_var.set_size  (out_n_rows, out_n_cols);
+  y.min_val.set_size(out_n_rows, out_n_cols);
+  y.max_val.set_size(out_n_rows, out_n_cols);
+  
+  eT* r_mean_mem  = y.r_mean.memptr();
+  eT* r_var_mem   = y.r_var.memptr();
+  eT* min_val_mem = y.min_val.memptr();
+  eT* max_val_mem = y.max_val.memptr();
+  
+  arrayops::copy(r_mean_mem,  S.colptr(0), n_dim);
+  arrayops::copy(min_val_mem, S.colptr(0), n_dim);
+  arrayops::copy(max_val_mem, S.colptr(0), n_dim);
+  
+  arrayops::fill_zeros(r_var_mem, n_dim);
+  
+  for(uword col=1; col < N; ++col)
+    {
+    const eT* S_colmem = S.colptr(col);
+    
+    const eT alpha = eT(1) / eT(col+1);
+    
+    for(uword i=0; i < n_dim; ++i)
+      {
+      const eT val   = S_colmem[i];
+      const eT delta = val - r_mean_mem[i];
+      
+      const eT new_mean = r_mean_mem[i] + alpha*delta;
+      
+      r_mean_mem[i] = new_mean;
+      r_var_mem[i] += delta * (val - new_mean);
+      
+      min_val_mem[i] = (val < min_val_mem[i]) ? val : min_val_mem[i];
+      max_val_mem[i] = (val > max_val_mem[i]) ? val : max_val_mem[i];
+      }
+    }
+  
+  const eT norm_val = eT(N-1);
+  
+  arrayops::inplace_div(r_var_mem, norm_val, n_dim);
+  
+  if(x.calc_cov)
+    {
+    Mat<eT> B(n_dim, N);
+    
+    for(uword col=0; col < N; ++col)
+      {
+      const eT* S_colmem = S.colptr(col);
+            eT* B_colmem = B.colptr(col);
+      
+      for(uword i=0; i < n_dim; ++i)  { B_colmem[i] = S_colmem[i] - r_mean_mem[i]; }
+      }
+    
+    y.r_cov.set_size(n_dim, n_dim);
+    
+    syrk<false, true, false>::apply(y.r_cov, B, eT(1) / norm_val);
+    }
+  
+  y.counter += N;
+  
+  running_stat_vec_aux::merge_stats(x, y);
+  }
+
+
+
+//! update statistics to reflect a block of new samples (version for non-complex numbers, complex samples)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::update_stats_batch
+  (
+  running_stat_vec<obj_type>& x,
+  const          Mat<std::complex< typename running_stat_vec<obj_type>::T > >& samples,
+  const typename       arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  running_stat_vec_aux::update_stats_batch(x, conv_to< Mat<eT> >::from(samples));
+  }
+
+
+
+//! update statistics to reflect a block of new samples (version for complex numbers, non-complex samples)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::update_stats_batch
+  (
+  running_stat_vec<obj_type>& x,
+  const                  Mat< typename running_stat_vec<obj_type>::T >& samples,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  
+  running_stat_vec_aux::update_stats_batch(x, conv_to< Mat<eT> >::from(samples));
+  }
+
+
+
+//! update statistics to reflect a block of new samples (version for complex numbers, complex samples)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::update_stats_batch
+  (
+  running_stat_vec<obj_type>& x,
+  const                   Mat<typename running_stat_vec<obj_type>::eT>& samples,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  const bool in_rows = running_stat_vec_aux::samples_in_rows(x);
+  
+  Mat<eT> samples_t;
+  
+  if(in_rows)  { op_strans::apply_mat_noalias(samples_t, samples); }
+  
+  const Mat<eT>& S = (in_rows) ? samples_t : samples;
+  
+  const uword n_dim = S.n_rows;
+  const uword N     = S.n_cols;
+  
+  const uword out_n_rows = (in_rows) ? uword(1) : n_dim;
+  const uword out_n_cols = (in_rows) ? n_dim    : uword(1);
+  
+  running_stat_vec<obj_type> y(x.calc_cov);
+  
+  y.r_mean.set_size      (out_n_rows, out_n_cols);
+  y.r_var.set_size       (out_n_rows, out_n_cols);
+  y.min_val.set_size     (out_n_rows, out_n_cols);
+  y.max_val.set_size     (out_n_rows, out_n_cols);
+  y.min_val_norm.set_size(out_n_rows, out_n_cols);
+  y.max_val_norm.set_size(out_n_rows, out_n_cols);
+  
+  eT* r_mean_mem       = y.r_mean.memptr();
+   T* r_var_mem        = y.r_var.memptr();
+  eT* min_val_mem      = y.min_val.memptr();
+  eT* max_val_mem      = y.max_val.memptr();
+   T* min_val_norm_mem = y.min_val_norm.memptr();
+   T* max_val_norm_mem = y.max_val_norm.memptr();
+  
+  arrayops::copy(r_mean_mem,  S.colptr(0), n_dim);
+  arrayops::copy(min_val_mem, S.colptr(0), n_dim);
+  arrayops::copy(max_val_mem, S.colptr(0), n_dim);
+  
+  arrayops::fill_zeros(r_var_mem, n_dim);
+  
+  for(uword i=0; i < n_dim; ++i)
+    {
+    const T val_norm = std::norm(r_mean_mem[i]);
+    
+    min_val_norm_mem[i] = val_norm;
+    max_val_norm_mem[i] = val_norm;
+    }
+  
+  for(uword col=1; col < N; ++col)
+    {
+    const eT* S_colmem = S.colptr(col);
+    
+    const T alpha = T(1) / T(col+1);
+    
+    for(uword i=0; i < n_dim; ++i)
+      {
+      const eT& val      = S_colmem[i];
+      const  T  val_norm = std::norm(val);
+      const eT  delta    = val - r_mean_mem[i];
+      
+      const eT new_mean = r_mean_mem[i] + alpha*delta;
+      
+      r_mean_mem[i] = new_mean;
+      r_var_mem[i] += std::real( std::conj(delta) * (val - new_mean) );
+      
+      if(val_norm < min_val_norm_mem[i])
+        {
+        min_val_norm_mem[i] = val_norm;
+        min_val_mem[i]      = val;
+        }
+      
+      if(val_norm > max_val_norm_mem[i])
+        {
+        max_val_norm_mem[i] = val_norm;
+        max_val_mem[i]      = val;
+        }
+      }
+    }
+  
+  const T norm_val = T(N-1);
+  
+  arrayops::inplace_div(r_var_mem, norm_val, n_dim);
+  
+  if(x.calc_cov)
+    {
+    Mat<eT> B(n_dim, N);
+    
+    for(uword col=0; col < N; ++col)
+      {
+      const eT* S_colmem = S.colptr(col);
+            eT* B_colmem = B.colptr(col);
+      
+      for(uword i=0; i < n_dim; ++i)  { B_colmem[i] = S_colmem[i] - r_mean_mem[i]; }
+      }
+    
+    y.r_cov = arma::conj(B) * strans(B);
+    y.r_cov /= norm_val;
+    }
+  
+  y.counter += N;
+  
+  running_stat_vec_aux::merge_stats(x, y);
+  }
+
+
+
+//! handle the trivial cases of merging; returns true if nothing else needs to be done
+template<typename obj_type>
+inline
+bool
+running_stat_vec_aux::merge_init(running_stat_vec<obj_type>& x, const running_stat_vec<obj_type>& y)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename running_stat_vec<obj_type>::T T;
+  
+  if(y.counter.value() == T(0))  { return true; }
+  
+  if( x.calc_cov && (y.calc_cov == false) )
+    {
+    arma_stop_logic_error("running_stat_vec::merge(): covariance was not tracked by the given object");
+    return true;
+    }
+  
+  if(x.counter.value() == T(0))
+    {
+    const bool calc_cov = x.calc_cov;
+    
+    x = y;
+    
+    access::rw(x.calc_cov) = calc_cov;
+    
+    if(calc_cov == false)  { x.r_cov.reset(); }
+    
+    return true;
+    }
+  
+  arma_debug_assert_same_size(x.r_mean, y.r_mean, "running_stat_vec::merge(): dimensionality mismatch");
+  
+  return false;
+  }
+
+
+
+//! merge statistics of two sets of samples (version for non-complex numbers);
+//! uses the parallel algorithm of Chan, Golub and LeVeque
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::merge_stats
+  (
+  running_stat_vec<obj_type>& x,
+  const running_stat_vec<obj_type>& y,
+  const typename arma_not_cx<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  if(running_stat_vec_aux::merge_init(x, y))  { return; }
+  
+  const T N_a = x.counter.value();
+  const T N_b = y.counter.value();
+  
+  x.counter += y.counter;
+  
+  const T N         = x.counter.value();
+  const T N_minus_1 = x.counter.value_minus_1();
+  
+  const T coeff_a = (N_a > T(1)) ? ((N_a - T(1)) / N_minus_1) : T(0);
+  const T coeff_b = (N_b > T(1)) ? ((N_b - T(1)) / N_minus_1) : T(0);
+  const T coeff_d = (N_a / N) * (N_b / N_minus_1);
+  
+  const uword n_elem = x.r_mean.n_elem;
+  
+  x.tmp1.set_size(n_elem, 1);
+  
+        eT* delta_mem   = x.tmp1.memptr();
+        eT* r_mean_mem  = x.r_mean.memptr();
+        eT* r_var_mem   = x.r_var.memptr();
+        eT* min_val_mem = x.min_val.memptr();
+        eT* max_val_mem = x.max_val.memptr();
+  const eT* y_mean_mem  = y.r_mean.memptr();
+  const eT* y_var_mem   = y.r_var.memptr();
+  const eT* y_min_mem   = y.min_val.memptr();
+  const eT* y_max_mem   = y.max_val.memptr();
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT delta = y_mean_mem[i] - r_mean_mem[i];
+    
+    delta_mem[i] = delta;
+    
+    r_var_mem[i]   = coeff_a * r_var_mem[i] + coeff_b * y_var_mem[i] + coeff_d * (delta*delta);
+    r_mean_mem[i] += delta * (N_b / N);
+    
+    if(y_min_mem[i] < min_val_mem[i])  { min_val_mem[i] = y_min_mem[i]; }
+    if(y_max_mem[i] > max_val_mem[i])  { max_val_mem[i] = y_max_mem[i]; }
+    }
+  
+  if(x.calc_cov)
+    {
+    // r_cov = coeff_a * r_cov + coeff_b * y.r_cov + coeff_d * delta * trans(delta)
+    
+    x.r_cov *= coeff_a;
+    x.r_cov += coeff_b * y.r_cov;
+    
+    syrk_vec<false, true, true>::apply(x.r_cov, x.tmp1, eT(coeff_d), eT(1));
+    }
+  }
+
+
+
+//! merge statistics of two sets of samples (version for complex numbers)
+template<typename obj_type>
+inline
+void
+running_stat_vec_aux::merge_stats
+  (
+  running_stat_vec<obj_type>& x,
+  const running_stat_vec<obj_type>& y,
+  const typename arma_cx_only<typename running_stat_vec<obj_type>::eT>::result* junk
+  )
+  {
+  arma_extra_debug_sigprint();
+  arma_ignore(junk);
+  
+  typedef typename running_stat_vec<obj_type>::eT eT;
+  typedef typename running_stat_vec<obj_type>::T   T;
+  
+  if(running_stat_vec_aux::merge_init(x, y))  { return; }
+  
+  const T N_a = x.counter.value();
+  const T N_b = y.counter.value();
+  
+  x.counter += y.counter;
+  
+  const T N         = x.counter.value();
+  const T N_minus_1 = x.counter.value_minus_1();
+  
+  const T coeff_a = (N_a > T(1)) ? ((N_a - T(1)) / N_minus_1) : T(0);
+  const T coeff_b = (N_b > T(1)) ? ((N_b - T(1)) / N_minus_1) : T(0);
+  const T coeff_d = (N_a / N) * (N_b / N_minus_1);
+  
+  const uword n_elem = x.r_mean.n_elem;
+  
+  x.tmp1.set_size(n_elem, 1);
+  
+        eT* delta_mem        = x.tmp1.memptr();
+        eT* r_mean_mem       = x.r_mean.memptr();
+         T* r_var_mem        = x.r_var.memptr();
+        eT* min_val_mem      = x.min_val.memptr();
+        eT* max_val_mem      = x.max_val.memptr();
+         T* min_val_norm_mem = x.min_val_norm.memptr();
+         T* max_val_norm_mem = x.max_val_norm.memptr();
+  
+  for(uword i=0; i < n_elem; ++i)
+    {
+    const eT delta = y.r_mean[i] - r_mean_mem[i];
+    
+    delta_mem[i] = delta;
+    
+    r_var_mem[i]   = coeff_a * r_var_mem[i] + coeff_b * y.r_var[i] + coeff_d * std::norm(delta);
+    r_mean_mem[i] += delta * (N_b / N);
+    
+    if(y.min_val_norm[i] < min_val_norm_mem[i])
+      {
+      min_val_norm_mem[i] = y.min_val_norm[i];
+      min_val_mem[i]      = y.min_val[i];
+      }
+    
+    if(y.max_val_norm[i] > max_val_norm_mem[i])
+      {
+      max_val_norm_mem[i] = y.max_val_norm[i];
+      max_val_mem[i]      = y.max_val[i];
+      }
+    }
+  
+  if(x.calc_cov)
+    {
+    const Mat<eT>& delta = x.tmp1;
+    
+    x.r_cov *= coeff_a;
+    x.r_cov += coeff_b * y.r_cov;
+    x.r_cov += coeff_d * (arma::conj(delta) * strans(delta));
+    }
+  }
+
+
+
 //! @}
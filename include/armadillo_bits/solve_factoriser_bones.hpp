@@ -0,0 +1,94 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup solve_factoriser
+//! @{
+
+
+//! Factorisation of a dense matrix, computed once and then used to solve any number of systems.
+//! Supported methods: "lu", "chol", "ldl", "qr" and "band" (LU of a band matrix).
+template<typename eT>
+class solve_factoriser
+  {
+  public:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  inline solve_factoriser();
+  
+  template<typename T1>
+  inline explicit solve_factoriser(const Base<eT,T1>& A, const char* method = "lu");
+  
+  template<typename T1>
+  inline bool factorise(const Base<eT,T1>& A, const char* method = "lu");
+  
+  template<typename T1>
+  inline bool factorise_band(const Base<eT,T1>& A, const uword KL, const uword KU);
+  
+  template<typename T1>
+  inline bool update(const Base<eT,T1>& A);
+  
+  inline void reset();
+  
+  inline bool  is_empty() const;
+  inline uword n_rows()   const;
+  inline uword n_cols()   const;
+  
+  template<typename T1>
+  inline bool solve(Mat<eT>& X, const Base<eT,T1>& B) const;
+  
+  template<typename T1>
+  inline Mat<eT> solve(const Base<eT,T1>& B) const;
+  
+  inline T rcond() const;
+  
+  inline bool log_det(eT& out_val, T& out_sign) const;
+  
+  
+  private:
+  
+  enum method_type { method_none, method_lu, method_chol, method_ldl, method_qr, method_band };
+  
+  method_type method;
+  
+  uword M;              // rows of the original matrix
+  uword N;              // columns of the original matrix
+  uword KL;             // band only
+  uword KU;             // band only
+  
+  T  anorm;             // 1-norm of the original matrix
+  eT Q_det;             // QR only: determinant of Q
+  
+  Mat<eT> F;            // LU: L and U;  chol: upper triangular R;  ldl: L and D;  qr: R;  band: LU in band storage
+  Mat<eT> Q;            // QR only: orthonormal columns
+  
+  podarray<blas_int> ipiv;
+  
+  template<typename T1>
+  inline bool factorise_method(const Base<eT,T1>& A, const method_type in_method);
+  
+  inline bool init_lu  ();
+  inline bool init_chol();
+  inline bool init_ldl ();
+  inline bool init_qr  ();
+  inline bool init_band();
+  
+  inline static void accumulate_det(eT& val, T& sign, const eT x);
+  };
+
+
+
+//! @}
@@ -0,0 +1,856 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup solve_factoriser
+//! @{
+
+
+
+template<typename eT>
+inline
+solve_factoriser<eT>::solve_factoriser()
+  : method(method_none)
+  , M     (0)
+  , N     (0)
+  , KL    (0)
+  , KU    (0)
+  , anorm (T(0))
+  , Q_det (eT(1))
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+solve_factoriser<eT>::solve_factoriser(const Base<eT,T1>& A, const char* in_method)
+  : method(method_none)
+  , M     (0)
+  , N     (0)
+  , KL    (0)
+  , KU    (0)
+  , anorm (T(0))
+  , Q_det (eT(1))
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = factorise(A, in_method);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("solve_factoriser(): factorisation failed");
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+solve_factoriser<eT>::factorise(const Base<eT,T1>& A, const char* in_method)
+  {
+  arma_extra_debug_sigprint();
+  
+  const char sig1 = (in_method != NULL) ? in_method[0] : char(0);
+  const char sig2 = (sig1      != 0   ) ? in_method[1] : char(0);
+  
+  method_type new_method = method_none;
+  
+  if( (sig1 == 'l') && (sig2 == 'u') )  { new_method = method_lu;   }
+  if( (sig1 == 'c')                  )  { new_method = method_chol; }
+  if( (sig1 == 'l') && (sig2 == 'd') )  { new_method = method_ldl;  }
+  if( (sig1 == 'q')                  )  { new_method = method_qr;   }
+  
+  if(new_method == method_none)
+    {
+    arma_stop_logic_error("solve_factoriser::factorise(): unknown method");
+    return false;
+    }
+  
+  return factorise_method(A, new_method);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+solve_factoriser<eT>::factorise_band(const Base<eT,T1>& A, const uword in_KL, const uword in_KU)
+  {
+  arma_extra_debug_sigprint();
+  
+  KL = in_KL;
+  KU = in_KU;
+  
+  return factorise_method(A, method_band);
+  }
+
+
+
+//! factorise a new matrix with the same method (and bandwidth) as before, re-using the existing storage
+template<typename eT>
+template<typename T1>
+inline
+bool
+solve_factoriser<eT>::update(const Base<eT,T1>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (method == method_none), "solve_factoriser::update(): no factorisation to update" );
+  
+  return factorise_method(A, method);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+solve_factoriser<eT>::factorise_method(const Base<eT,T1>& A, const method_type in_method)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    #if defined(ARMA_CRIPPLED_LAPACK)
+      {
+      if(is_cx<eT>::yes)
+        {
+        arma_stop_logic_error("solve_factoriser::factorise(): complex matrices not supported due to crippled LAPACK");
+        return false;
+        }
+      }
+    #endif
+    
+    // the factors from a previous call are overwritten in place, so repeated factorisations of same sized matrices do not reallocate
+    
+    method = method_none;
+    Q_det  = eT(1);
+    
+    if(in_method == method_band)
+      {
+      const quasi_unwrap<T1> U(A.get_ref());
+      
+      const Mat<eT>& X = U.M;
+      
+      arma_debug_check( (X.is_square() == false), "solve_factoriser::factorise_band(): given matrix must be square sized" );
+      
+      arma_debug_check( ( (X.n_rows > 0) && ((KL >= X.n_rows) || (KU >= X.n_rows)) ), "solve_factoriser::factorise_band(): KL and KU must be less than the size of the matrix" );
+      
+      M = X.n_rows;
+      N = X.n_cols;
+      
+      anorm = (X.is_empty()) ? T(0) : T( norm(X, 1) );
+      
+      band_helper::compress(F, X, KL, KU, true);
+      }
+    else
+      {
+      F = A.get_ref();
+      
+      if(in_method == method_qr)
+        {
+        arma_debug_check( (F.n_rows < F.n_cols), "solve_factoriser::factorise(): given matrix must have at least as many rows as columns" );
+        }
+      else
+        {
+        arma_debug_check( (F.is_square() == false), "solve_factoriser::factorise(): given matrix must be square sized" );
+        }
+      
+      M = F.n_rows;
+      N = F.n_cols;
+      
+      anorm = T(0);
+      
+      if(F.is_empty() == false)
+        {
+        arma_debug_assert_blas_size(F);
+        
+        char     norm_id = '1';
+        blas_int m       = blas_int(F.n_rows);
+        blas_int n       = blas_int(F.n_cols);
+        
+        podarray<T> junk(1);
+        
+        anorm = lapack::lange(&norm_id, &m, &n, F.memptr(), &m, junk.memptr());
+        }
+      }
+    
+    if(F.is_empty())
+      {
+      Q.set_size(M, N);
+      ipiv.reset();
+      
+      method = in_method;
+      return true;
+      }
+    
+    arma_debug_assert_blas_size(F);
+    
+    bool status = false;
+    
+    switch(in_method)
+      {
+      case method_lu:    status = init_lu();    break;
+      case method_chol:  status = init_chol();  break;
+      case method_ldl:   status = init_ldl();   break;
+      case method_qr:    status = init_qr();    break;
+      case method_band:  status = init_band();  break;
+      default:           status = false;
+      }
+    
+    if(status == false)  { reset(); return false; }
+    
+    method = in_method;
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(A);
+    arma_ignore(in_method);
+    arma_stop_logic_error("solve_factoriser::factorise(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+void
+solve_factoriser<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  method = method_none;
+  M      = 0;
+  N      = 0;
+  KL     = 0;
+  KU     = 0;
+  anorm  = T(0);
+  Q_det  = eT(1);
+  
+  F.reset();
+  Q.reset();
+  ipiv.reset();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve_factoriser<eT>::is_empty() const
+  {
+  return (method == method_none);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+solve_factoriser<eT>::n_rows() const
+  {
+  return M;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+solve_factoriser<eT>::n_cols() const
+  {
+  return N;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve_factoriser<eT>::init_lu()
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    blas_int n    = blas_int(N);
+    blas_int info = blas_int(0);
+    
+    ipiv.set_size(N + 2);  // +2 for paranoia
+    
+    arma_extra_debug_print("lapack::getrf()");
+    lapack::getrf(&n, &n, F.memptr(), &n, ipiv.memptr(), &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve_factoriser<eT>::init_chol()
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char     uplo = 'U';
+    blas_int n    = blas_int(N);
+    blas_int info = blas_int(0);
+    
+    arma_extra_debug_print("lapack::potrf()");
+    lapack::potrf(&uplo, &n, F.memptr(), &n, &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve_factoriser<eT>::init_ldl()
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    char     uplo  = 'U';
+    blas_int n     = blas_int(N);
+    blas_int lwork = (std::max)(blas_int(podarray_prealloc_n_elem::val), 64*n);
+    blas_int info  = blas_int(0);
+    
+    ipiv.set_size(N + 2);  // +2 for paranoia
+    
+    podarray<eT> work( static_cast<uword>(lwork) );
+    
+    if(is_cx<eT>::no)
+      {
+      arma_extra_debug_print("lapack::sytrf()");
+      lapack::sytrf(&uplo, &n, F.memptr(), &n, ipiv.memptr(), work.memptr(), &lwork, &info);
+      }
+    else
+      {
+      arma_extra_debug_print("lapack::hetrf()");
+      lapack::hetrf(&uplo, &n, F.memptr(), &n, ipiv.memptr(), work.memptr(), &lwork, &info);
+      }
+    
+    return (info == 0);
+    }
+  #else
+    {
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve_factoriser<eT>::init_qr()
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    Q.steal_mem(F);
+    
+    blas_int m         = blas_int(M);
+    blas_int n         = blas_int(N);
+    blas_int k         = blas_int(N);
+    blas_int lwork     = 0;
+    blas_int lwork_min = (std::max)(blas_int(1), (std::max)(m,n));
+    blas_int info      = 0;
+    
+    podarray<eT> tau(N);
+    
+    eT        work_query[2];
+    blas_int lwork_query = -1;
+    
+    arma_extra_debug_print("lapack::geqrf()");
+    lapack::geqrf(&m, &n, Q.memptr(), &m, tau.memptr(), &work_query[0], &lwork_query, &info);
+    
+    if(info != 0)  { return false; }
+    
+    blas_int lwork_proposed = static_cast<blas_int>( access::tmp_real(work_query[0]) );
+    
+    lwork = (std::max)(lwork_proposed, lwork_min);
+    
+    podarray<eT> work( static_cast<uword>(lwork) );
+    
+    arma_extra_debug_print("lapack::geqrf()");
+    lapack::geqrf(&m, &n, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork, &info);
+    
+    if(info != 0)  { return false; }
+    
+    F.set_size(N, N);
+    
+    for(uword col=0; col < N; ++col)
+      {
+      for(uword row=0;       row <= col; ++row)  { F.at(row,col) = Q.at(row,col); }
+      for(uword row=(col+1); row <  N;   ++row)  { F.at(row,col) = eT(0);         }
+      }
+    
+    // each elementary reflector H(i) = I - tau(i) v v' has determinant 1 - tau(i) v'v, with v(i) = 1
+    
+    if(M == N)
+      {
+      for(uword i=0; i < N; ++i)
+        {
+        const eT* v = Q.colptr(i);
+        
+        T v_norm_sq = T(1);
+        
+        for(uword row=(i+1); row < M; ++row)  { const T a = std::abs(v[row]); v_norm_sq += a*a; }
+        
+        Q_det *= ( eT(1) - tau[i] * v_norm_sq );
+        }
+      }
+    
+    if(is_cx<eT>::no)
+      {
+      arma_extra_debug_print("lapack::orgqr()");
+      lapack::orgqr(&m, &n, &k, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork, &info);
+      }
+    else
+      {
+      arma_extra_debug_print("lapack::ungqr()");
+      lapack::ungqr(&m, &n, &k, Q.memptr(), &m, tau.memptr(), work.memptr(), &lwork, &info);
+      }
+    
+    if(info != 0)  { return false; }
+    
+    // R must be non-singular for the factorisation to be usable
+    
+    for(uword i=0; i < N; ++i)  { if(F.at(i,i) == eT(0))  { return false; } }
+    
+    return true;
+    }
+  #else
+    {
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+bool
+solve_factoriser<eT>::init_band()
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    // for gbtrf, matrix F size: 2*KL+KU+1 x N; band representation of A stored in rows KL+1 to 2*KL+KU+1  (note: fortran counts from 1)
+    
+    blas_int n    = blas_int(N);
+    blas_int kl   = blas_int(KL);
+    blas_int ku   = blas_int(KU);
+    blas_int ldab = blas_int(F.n_rows);
+    blas_int info = blas_int(0);
+    
+    ipiv.set_size(N + 2);  // +2 for paranoia
+    
+    arma_extra_debug_print("lapack::gbtrf()");
+    lapack::gbtrf(&n, &n, &kl, &ku, F.memptr(), &ldab, ipiv.memptr(), &info);
+    
+    return (info == 0);
+    }
+  #else
+    {
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+solve_factoriser<eT>::solve(Mat<eT>& X, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (method == method_none), "solve_factoriser::solve(): no factorisation available" );
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(method == method_qr)
+      {
+      const quasi_unwrap<T1> U(B.get_ref());
+      
+      arma_debug_check( (U.M.n_rows != M), "solve_factoriser::solve(): number of rows in the given matrix must be the same as in the factorised matrix" );
+      
+      if(U.M.is_empty() || (N == 0))  { X.zeros(N, U.M.n_cols); return true; }
+      
+      X = trans(Q) * U.M;
+      }
+    else
+      {
+      X = B.get_ref();
+      
+      arma_debug_check( (X.n_rows != M), "solve_factoriser::solve(): number of rows in the given matrix must be the same as in the factorised matrix" );
+      
+      if(X.is_empty() || (N == 0))  { X.zeros(N, X.n_cols); return true; }
+      }
+    
+    arma_debug_assert_blas_size(X);
+    
+    char     trans = 'N';
+    char     uplo  = 'U';
+    char     diag  = 'N';
+    blas_int n     = blas_int(N);
+    blas_int nrhs  = blas_int(X.n_cols);
+    blas_int ldf   = blas_int(F.n_rows);
+    blas_int ldx   = blas_int(X.n_rows);
+    blas_int info  = blas_int(0);
+    
+    eT*       X_mem =    X.memptr();
+    eT*       F_mem = const_cast<eT*>(F.memptr());
+    blas_int* p_mem = const_cast<blas_int*>(ipiv.memptr());
+    
+    switch(method)
+      {
+      case method_lu:
+        arma_extra_debug_print("lapack::getrs()");
+        lapack::getrs(&trans, &n, &nrhs, F_mem, &ldf, p_mem, X_mem, &ldx, &info);
+        break;
+      
+      case method_chol:
+        arma_extra_debug_print("lapack::potrs()");
+        lapack::potrs(&uplo, &n, &nrhs, F_mem, &ldf, X_mem, &ldx, &info);
+        break;
+      
+      case method_ldl:
+        if(is_cx<eT>::no)
+          {
+          arma_extra_debug_print("lapack::sytrs()");
+          lapack::sytrs(&uplo, &n, &nrhs, F_mem, &ldf, p_mem, X_mem, &ldx, &info);
+          }
+        else
+          {
+          arma_extra_debug_print("lapack::hetrs()");
+          lapack::hetrs(&uplo, &n, &nrhs, F_mem, &ldf, p_mem, X_mem, &ldx, &info);
+          }
+        break;
+      
+      case method_qr:
+        arma_extra_debug_print("lapack::trtrs()");
+        lapack::trtrs(&uplo, &trans, &diag, &n, &nrhs, F_mem, &ldf, X_mem, &ldx, &info);
+        break;
+      
+      case method_band:
+        {
+        blas_int kl = blas_int(KL);
+        blas_int ku = blas_int(KU);
+        
+        arma_extra_debug_print("lapack::gbtrs()");
+        lapack::gbtrs(&trans, &n, &kl, &ku, &nrhs, F_mem, &ldf, p_mem, X_mem, &ldx, &info);
+        }
+        break;
+      
+      default:
+        info = blas_int(-1);
+      }
+    
+    if(info != 0)  { X.soft_reset(); return false; }
+    
+    return true;
+    }
+  #else
+    {
+    arma_ignore(X);
+    arma_ignore(B);
+    arma_stop_logic_error("solve_factoriser::solve(): use of LAPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+solve_factoriser<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> X;
+  
+  const bool status = solve(X, B);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("solve_factoriser::solve(): solution not found");
+    }
+  
+  return X;
+  }
+
+
+
+//! estimate of the reciprocal of the 1-norm condition number, using the stored factors;
+//! for QR this is the 1-norm estimate for R, a proxy for the 2-norm condition number of A
+template<typename eT>
+inline
+typename get_pod_type<eT>::result
+solve_factoriser<eT>::rcond() const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (method == method_none), "solve_factoriser::rcond(): no factorisation available" );
+  
+  #if defined(ARMA_USE_LAPACK)
+    {
+    if(N == 0)  { return Datum<T>::inf; }
+    
+    typedef std::complex<T> cx_eT;
+    
+    char     norm_id = '1';
+    char     uplo    = 'U';
+    char     diag    = 'N';
+    blas_int n       = blas_int(N);
+    blas_int ldf     = blas_int(F.n_rows);
+    T        norm_val = anorm;
+    T        out_val  = T(0);
+    blas_int info     = blas_int(0);
+    
+    podarray<eT>        work(4*N);
+    podarray<T>        rwork(2*N);
+    podarray<blas_int> iwork(N);
+    
+    eT*       F_mem = const_cast<eT*>(F.memptr());
+    blas_int* p_mem = const_cast<blas_int*>(ipiv.memptr());
+    
+    cx_eT* F_cx_mem    = (cx_eT*)(F_mem);
+    cx_eT* work_cx_mem = (cx_eT*)(work.memptr());
+    
+    switch(method)
+      {
+      case method_lu:
+        if(is_cx<eT>::no)
+          {
+          lapack::gecon(&norm_id, &n, F_mem, &ldf, (eT*)&norm_val, (eT*)&out_val, work.memptr(), iwork.memptr(), &info);
+          }
+        else
+          {
+          lapack::cx_gecon(&norm_id, &n, F_cx_mem, &ldf, &norm_val, &out_val, work_cx_mem, rwork.memptr(), &info);
+          }
+        break;
+      
+      case method_chol:
+        if(is_cx<eT>::no)
+          {
+          lapack::pocon(&uplo, &n, F_mem, &ldf, (eT*)&norm_val, (eT*)&out_val, work.memptr(), iwork.memptr(), &info);
+          }
+        else
+          {
+          lapack::cx_pocon(&uplo, &n, F_cx_mem, &ldf, &norm_val, &out_val, work_cx_mem, rwork.memptr(), &info);
+          }
+        break;
+      
+      case method_ldl:
+        if(is_cx<eT>::no)
+          {
+          lapack::sycon(&uplo, &n, F_mem, &ldf, p_mem, (eT*)&norm_val, (eT*)&out_val, work.memptr(), iwork.memptr(), &info);
+          }
+        else
+          {
+          lapack::cx_hecon(&uplo, &n, F_cx_mem, &ldf, p_mem, &norm_val, &out_val, work_cx_mem, &info);
+          }
+        break;
+      
+      case method_qr:
+        // Q is unitary, so cond_2(A) = cond_2(R); the 1-norm condition number of R is within a factor of N of cond_2(R),
+        // which makes it a cheap proxy for the conditioning of A (it is not the 1-norm condition number of A itself)
+        if(is_cx<eT>::no)
+          {
+          lapack::trcon(&norm_id, &uplo, &diag, &n, F_mem, &ldf, (eT*)&out_val, work.memptr(), iwork.memptr(), &info);
+          }
+        else
+          {
+          lapack::cx_trcon(&norm_id, &uplo, &diag, &n, F_cx_mem, &ldf, &out_val, work_cx_mem, rwork.memptr(), &info);
+          }
+        break;
+      
+      case method_band:
+        {
+        blas_int kl = blas_int(KL);
+        blas_int ku = blas_int(KU);
+        
+        if(is_cx<eT>::no)
+          {
+          lapack::gbcon(&norm_id, &n, &kl, &ku, F_mem, &ldf, p_mem, (eT*)&norm_val, (eT*)&out_val, work.memptr(), iwork.memptr(), &info);
+          }
+        else
+          {
+          lapack::cx_gbcon(&norm_id, &n, &kl, &ku, F_cx_mem, &ldf, p_mem, &norm_val, &out_val, work_cx_mem, rwork.memptr(), &info);
+          }
+        }
+        break;
+      
+      default:
+        info = blas_int(-1);
+      }
+    
+    return (info == 0) ? out_val : T(0);
+    }
+  #else
+    {
+    arma_stop_logic_error("solve_factoriser::rcond(): use of LAPACK must be enabled");
+    return T(0);
+    }
+  #endif
+  }
+
+
+
+template<typename eT>
+inline
+void
+solve_factoriser<eT>::accumulate_det(eT& val, T& sign, const eT x)
+  {
+  if(is_cx<eT>::no)
+    {
+    const T x_real = access::tmp_real(x);
+    
+    if(x_real < T(0))  { sign = -sign; }
+    
+    val += eT( std::log(std::abs(x_real)) );
+    }
+  else
+    {
+    val += std::log(x);
+    }
+  }
+
+
+
+//! log of the determinant of the factorised matrix, using the same conventions as log_det()
+template<typename eT>
+inline
+bool
+solve_factoriser<eT>::log_det(eT& out_val, T& out_sign) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (method == method_none), "solve_factoriser::log_det(): no factorisation available" );
+  
+  arma_debug_check( (M != N), "solve_factoriser::log_det(): factorised matrix must be square sized" );
+  
+  eT val  = eT(0);
+  T  sign = T(1);
+  
+  switch(method)
+    {
+    case method_lu:
+      for(uword i=0; i < N; ++i)
+        {
+        accumulate_det(val, sign, F.at(i,i));
+        
+        if( blas_int(i) != (ipiv[i] - 1) )  { sign = -sign; }  // NOTE: adjustment of -1 is required as Fortran counts from 1
+        }
+      break;
+    
+    case method_chol:
+      for(uword i=0; i < N; ++i)  { val += eT( T(2) * std::log( access::tmp_real(F.at(i,i)) ) ); }
+      break;
+    
+    case method_ldl:
+      // A = P U D U' P', where D is block diagonal with 1x1 and 2x2 blocks; det(P)^2 = 1
+      for(uword i=0; i < N; ++i)
+        {
+        if( (ipiv[i] > 0) || ((i+1) >= N) )
+          {
+          accumulate_det(val, sign, F.at(i,i));
+          }
+        else
+          {
+          const eT a = F.at(i,  i  );
+          const eT b = F.at(i,  i+1);
+          const eT c = F.at(i+1,i+1);
+          
+          accumulate_det(val, sign, a*c - b*access::alt_conj(b));
+          
+          ++i;
+          }
+        }
+      break;
+    
+    case method_qr:
+      accumulate_det(val, sign, Q_det);
+      for(uword i=0; i < N; ++i)  { accumulate_det(val, sign, F.at(i,i)); }
+      break;
+    
+    case method_band:
+      {
+      // U is stored in rows 0 to KL+KU, with its main diagonal in row KL+KU
+      const uword diag_row = KL + KU;
+      
+      for(uword i=0; i < N; ++i)
+        {
+        accumulate_det(val, sign, F.at(diag_row,i));
+        
+        if( blas_int(i) != (ipiv[i] - 1) )  { sign = -sign; }
+        }
+      }
+      break;
+    
+    default:
+      return false;
+    }
+  
+  out_val  = val;
+  out_sign = sign;
+  
+  return true;
+  }
+
+
+
+//! @}
@@ -42,6 +42,15 @@ class sp_auxlib
   template<typename eT, typename T1>
   inline static bool eigs_sym_arpack(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1>& X, const uword n_eigvals, const char* form_str, const eT default_tol);
   
+  template<typename eT, typename T1>
+  inline static bool eigs_sym_shift(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1>& X, const uword n_eigvals, const eT sigma, const eT default_tol);
+  
+  template<typename eT, typename T1, typename T2>
+  inline static bool eigs_sym_pair(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1>& A, const SpBase<eT, T2>& B, const uword n_eigvals, const char* form_str, const bool use_sigma, const eT sigma, const eT default_tol);
+  
+  template<typename eT, typename op_type>
+  inline static bool eigs_sym_op(Col<eT>& eigval, Mat<eT>& eigvec, const op_type& A, const uword n_eigvals, const char* form_str, const eT default_tol);
+  
   //
   // eigs_gen()
   
@@ -54,6 +63,15 @@ class sp_auxlib
   template<typename T, typename T1>
   inline static bool eigs_gen_arpack(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X, const uword n_eigvals, const char* form_str, const T default_tol);
   
+  template<typename T, typename T1>
+  inline static bool eigs_gen_shift(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X, const uword n_eigvals, const T sigma, const T default_tol);
+  
+  template<typename T, typename T1, typename T2>
+  inline static bool eigs_gen_pair(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& A, const SpBase<T, T2>& B, const uword n_eigvals, const char* form_str, const bool use_sigma, const T sigma, const T default_tol);
+  
+  template<typename T, typename op_type>
+  inline static bool eigs_gen_op(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const op_type& A, const uword n_eigvals, const char* form_str, const T default_tol);
+  
   template<typename T, typename T1>
   inline static bool eigs_gen(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase< std::complex<T>, T1>& X, const uword n_eigvals, const char* form_str, const T default_tol);
   
@@ -97,5 +115,12 @@ class sp_auxlib
     podarray<T>& workd, podarray<T>& workl, blas_int& lworkl, podarray<eT>& rwork,
     blas_int& info
     );
-
+  
+  #if defined(ARMA_USE_NEWARP)
+    template<typename eT, typename OpType>
+    inline static bool run_newarp_sym(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const uword n_eigvals, const uword ncv, const form_type form_val, const eT tol);
+    
+    template<typename T, typename OpType>
+    inline static bool run_newarp_gen(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const OpType& op, const uword n_eigvals, const uword ncv, const form_type form_val, const T tol);
+  #endif
   };
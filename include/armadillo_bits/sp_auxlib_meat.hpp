@@ -124,62 +124,7 @@ sp_auxlib::eigs_sym_newarp(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1
     
     eT tol = (std::max)(default_tol, std::numeric_limits<eT>::epsilon());
     
-    // eigval.set_size(n_eigvals);
-    // eigvec.set_size(n, n_eigvals);
-    
-    bool status = true;
-    
-    uword nconv = 0;
-    
-    try
-      {
-      if(form_val == form_lm)
-        {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
-        }
-      else
-      if(form_val == form_sm)
-        {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_MAGN, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
-        }
-      else
-      if(form_val == form_la)
-        {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_ALGE, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
-        }
-      else
-      if(form_val == form_sa)
-        {
-        newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_ALGE, newarp::SparseGenMatProd<eT> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
-        }
-      }
-    catch(const std::runtime_error&)
-      {
-      status = false;
-      }
-    
-    if(status == true)
-      {
-      if(nconv == 0)  { status = false; }
-      }
-    
-    return status;
+    return sp_auxlib::run_newarp_sym(eigval, eigvec, op, n_eigvals, ncv, form_val, tol);
     }
   #else
     {
@@ -298,32 +243,76 @@ sp_auxlib::eigs_sym_arpack(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1
 
 
 
-//! immediate eigendecomposition of non-symmetric real sparse object
-template<typename T, typename T1>
+//! eigendecomposition of symmetric real sparse object in shift-invert mode:
+//! finds the eigenvalues closest to sigma, via the largest eigenvalues of inv(X - sigma*I)
+template<typename eT, typename T1>
 inline
 bool
-sp_auxlib::eigs_gen(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X, const uword n_eigvals, const char* form_str, const T default_tol)
+sp_auxlib::eigs_sym_shift(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1>& X_expr, const uword n_eigvals, const eT sigma, const eT default_tol)
   {
   arma_extra_debug_sigprint();
   
   #if defined(ARMA_USE_NEWARP)
     {
-    return sp_auxlib::eigs_gen_newarp(eigval, eigvec, X, n_eigvals, form_str, default_tol);
-    }
-  #elif defined(ARMA_USE_ARPACK)
-    {
-    return sp_auxlib::eigs_gen_arpack(eigval, eigvec, X, n_eigvals, form_str, default_tol);
+    const unwrap_spmat<T1> U(X_expr.get_ref());
+    const SpMat<eT>&       X = U.M;
+    
+    arma_debug_check( (X.n_rows != X.n_cols), "eigs_sym(): given matrix must be square sized" );
+    
+    arma_debug_check( (n_eigvals >= X.n_rows), "eigs_sym(): n_eigvals must be less than the number of rows in the matrix" );
+    
+    if( (X.n_cols == 0) || (n_eigvals == 0) )
+      {
+      eigval.reset();
+      eigvec.reset();
+      return true;
+      }
+    
+    const uword n   = X.n_rows;
+          uword ncv = (std::max)(n_eigvals + 2 + 1, 2 * n_eigvals + 1);
+    
+    if(ncv > n)  { ncv = n; }
+    
+    const eT tol = (std::max)(default_tol, std::numeric_limits<eT>::epsilon());
+    
+    bool status = true;
+    
+    uword nconv = 0;
+    
+    try
+      {
+      const SpMat<eT> M = X - sigma * speye< SpMat<eT> >(n, n);
+      
+      const newarp::SparseSolveMatProd<eT> op(M, true);
+      
+      newarp::SymEigsShiftSolver< eT, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseSolveMatProd<eT> > eigs(op, n_eigvals, ncv, sigma);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    catch(const std::runtime_error&)
+      {
+      status = false;
+      }
+    
+    if(status == true)
+      {
+      if(nconv == 0)  { status = false; }
+      }
+    
+    return status;
     }
   #else
     {
     arma_ignore(eigval);
     arma_ignore(eigvec);
-    arma_ignore(X);
+    arma_ignore(X_expr);
     arma_ignore(n_eigvals);
-    arma_ignore(form_str);
+    arma_ignore(sigma);
     arma_ignore(default_tol);
     
-    arma_stop_logic_error("eigs_gen(): use of NEWARP or ARPACK must be enabled");
+    arma_stop_logic_error("eigs_sym(): use of NEWARP must be enabled for shift-invert mode");
     return false;
     }
   #endif
@@ -331,128 +320,139 @@ sp_auxlib::eigs_gen(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigv
 
 
 
-template<typename T, typename T1>
+//! eigendecomposition of symmetric real sparse pair (A,B), with B positive definite, such that A*x = lambda*B*x;
+//! regular mode uses the operator inv(B)*A, while shift-invert mode uses inv(A - sigma*B)*B.
+//! The operators are not symmetric, so the Arnoldi process is used and the eigenvectors are scaled so that x.t()*B*x = 1
+template<typename eT, typename T1, typename T2>
 inline
 bool
-sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X_expr, const uword n_eigvals, const char* form_str, const T default_tol)
+sp_auxlib::eigs_sym_pair(Col<eT>& eigval, Mat<eT>& eigvec, const SpBase<eT, T1>& A_expr, const SpBase<eT, T2>& B_expr, const uword n_eigvals, const char* form_str, const bool use_sigma, const eT sigma, const eT default_tol)
   {
   arma_extra_debug_sigprint();
   
   #if defined(ARMA_USE_NEWARP)
     {
-    const form_type form_val = sp_auxlib::interpret_form_str(form_str);
+    const form_type form_val = (use_sigma) ? form_lm : sp_auxlib::interpret_form_str(form_str);
     
-    arma_debug_check( (form_val == form_none), "eigs_gen(): unknown form specified" );
+    arma_debug_check( (form_val != form_lm) && (form_val != form_sm) && (form_val != form_la) && (form_val != form_sa), "eigs_sym(): unknown form specified" );
     
-    const unwrap_spmat<T1> U(X_expr.get_ref());
-    const SpMat<T>&        X = U.M;
+    const unwrap_spmat<T1> UA(A_expr.get_ref());
+    const unwrap_spmat<T2> UB(B_expr.get_ref());
     
-    const newarp::SparseGenMatProd<T> op(X);
+    const SpMat<eT>& A = UA.M;
+    const SpMat<eT>& B = UB.M;
     
-    arma_debug_check( (op.n_rows != op.n_cols), "eigs_sym(): given matrix must be square sized" );
+    arma_debug_check( (A.n_rows != A.n_cols), "eigs_sym(): given matrix must be square sized" );
     
-    arma_debug_check( (n_eigvals + 1 >= op.n_rows), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
+    arma_debug_assert_same_size(A, B, "eigs_sym()");
     
-    // If the matrix is empty, the case is trivial.
-    if( (op.n_cols == 0) || (n_eigvals == 0) ) // We already know n_cols == n_rows.
+    arma_debug_check( (n_eigvals + 1 >= A.n_rows), "eigs_sym(): n_eigvals + 1 must be less than the number of rows in the matrix" );
+    
+    if( (A.n_cols == 0) || (n_eigvals == 0) )
       {
       eigval.reset();
       eigvec.reset();
       return true;
       }
     
-    uword n   = op.n_rows;
-    uword ncv = n_eigvals + 2 + 1;
+    const uword n   = A.n_rows;
+          uword ncv = (std::max)(n_eigvals + 2 + 1, 2 * n_eigvals + 1);
     
-    if(ncv < (2 * n_eigvals + 1)) { ncv = 2 * n_eigvals + 1; }
-    if(ncv > n)                   { ncv = n; }
+    if(ncv > n)  { ncv = n; }
     
-    T tol = (std::max)(default_tol, std::numeric_limits<T>::epsilon());
+    const eT tol = (std::max)(default_tol, std::numeric_limits<eT>::epsilon());
     
-    // eigval.set_size(n_eigvals);
-    // eigvec.set_size(n, n_eigvals);
+    Col< std::complex<eT> > eigval_cx;
+    Mat< std::complex<eT> > eigvec_cx;
     
     bool status = true;
     
-    uword nconv = 0;
-    
-    try
+    if(use_sigma)
       {
-      if(form_val == form_lm)
-        {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
-        }
-      else
-      if(form_val == form_sm)
-        {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_MAGN, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
-        }
-      else
-      if(form_val == form_lr)
+      uword nconv = 0;
+      
+      try
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_REAL, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
+        const SpMat<eT> M = A - sigma * B;
+        
+        const newarp::SparseSolveMatProd<eT> op(M, true, B);
+        
+        newarp::GenEigsRealShiftSolver< eT, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseSolveMatProd<eT> > eigs(op, n_eigvals, ncv, sigma);
         eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
+        nconv     = eigs.compute(1000, tol);
+        eigval_cx = eigs.eigenvalues();
+        eigvec_cx = eigs.eigenvectors();
         }
-      else
-      if(form_val == form_sr)
+      catch(const std::runtime_error&)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_REAL, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
+        status = false;
         }
-      else
-      if(form_val == form_li)
+      
+      if(nconv == 0)  { status = false; }
+      }
+    else
+      {
+      const form_type gen_form_val = (form_val == form_la) ? form_lr : ( (form_val == form_sa) ? form_sr : form_val );
+      
+      try
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_IMAG, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
+        const newarp::SparseSolveMatProd<eT> op(B, true, A);
+        
+        status = sp_auxlib::run_newarp_gen(eigval_cx, eigvec_cx, op, n_eigvals, ncv, gen_form_val, tol);
         }
-      else
-      if(form_val == form_si)
+      catch(const std::runtime_error&)
         {
-        newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_IMAG, newarp::SparseGenMatProd<T> > eigs(op, n_eigvals, ncv);
-        eigs.init();
-        nconv  = eigs.compute(1000, tol);
-        eigval = eigs.eigenvalues();
-        eigvec = eigs.eigenvectors();
+        status = false;
         }
       }
-    catch(const std::runtime_error&)
-      {
-      status = false;
-      }
     
-    if(status == true)
+    if(status == false)  { return false; }
+    
+    // the eigenvalues are real; each eigenvector is real up to a complex scale factor,
+    // which is removed by rotating the largest element onto the real axis
+    
+    const uword n_found = eigval_cx.n_elem;
+    
+    const Col<eT> eigval_tmp = real(eigval_cx);
+          Mat<eT> eigvec_tmp(n, n_found);
+    
+    for(uword col=0; col < n_found; ++col)
       {
-      if(nconv == 0)  { status = false; }
+      const std::complex<eT>* src = eigvec_cx.colptr(col);
+                          eT* dst = eigvec_tmp.colptr(col);
+      
+      const std::complex<eT> pivot = src[ index_max(abs(eigvec_cx.col(col))) ];
+      const std::complex<eT> phase = std::conj(pivot) / std::abs(pivot);
+      
+      for(uword row=0; row < n; ++row)  { dst[row] = std::real(src[row] * phase); }
+      
+      const eT xBx = as_scalar( eigvec_tmp.col(col).t() * B * eigvec_tmp.col(col) );
+      
+      eigvec_tmp.col(col) /= (xBx > eT(0)) ? std::sqrt(xBx) : norm(eigvec_tmp.col(col), 2);
       }
     
-    return status;
+    // sort eigenvalues in ascending order, to be consistent with eigs_sym() for a single matrix
+    
+    const uvec indices = sort_index(eigval_tmp);
+    
+    eigval = eigval_tmp.elem(indices);
+    eigvec = eigvec_tmp.cols(indices);
+    
+    return true;
     }
   #else
     {
     arma_ignore(eigval);
     arma_ignore(eigvec);
-    arma_ignore(X_expr);
+    arma_ignore(A_expr);
+    arma_ignore(B_expr);
     arma_ignore(n_eigvals);
     arma_ignore(form_str);
+    arma_ignore(use_sigma);
+    arma_ignore(sigma);
     arma_ignore(default_tol);
     
+    arma_stop_logic_error("eigs_sym(): use of NEWARP must be enabled for generalised decomposition");
     return false;
     }
   #endif
@@ -460,99 +460,242 @@ sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T>
 
 
 
-
-template<typename T, typename T1>
+//! eigenvalues and eigenvectors of a symmetric structured operator (eg. sp_kron_op, sp_blockdiag_op),
+//! using only products of the operator with vectors
+template<typename eT, typename op_type>
 inline
 bool
-sp_auxlib::eigs_gen_arpack(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X, const uword n_eigvals, const char* form_str, const T default_tol)
+sp_auxlib::eigs_sym_op(Col<eT>& eigval, Mat<eT>& eigvec, const op_type& A, const uword n_eigvals, const char* form_str, const eT default_tol)
   {
   arma_extra_debug_sigprint();
   
-  #if defined(ARMA_USE_ARPACK)
+  #if defined(ARMA_USE_NEWARP)
     {
     const form_type form_val = sp_auxlib::interpret_form_str(form_str);
     
-    arma_debug_check( (form_val == form_none), "eigs_gen(): unknown form specified" );
-    
-    char which_lm[3] = "LM";
-    char which_sm[3] = "SM";
-    char which_lr[3] = "LR";
-    char which_sr[3] = "SR";
-    char which_li[3] = "LI";
-    char which_si[3] = "SI";
-    
-    char* which;
-    
-    switch(form_val)
-      {
-      case form_lm:  which = which_lm;  break;
-      case form_sm:  which = which_sm;  break;
-      case form_lr:  which = which_lr;  break;
-      case form_sr:  which = which_sr;  break;
-      case form_li:  which = which_li;  break;
-      case form_si:  which = which_si;  break;
-      
-      default:       which = which_lm;
-      }
-    
+    arma_debug_check( (form_val != form_lm) && (form_val != form_sm) && (form_val != form_la) && (form_val != form_sa), "eigs_sym(): unknown form specified" );
     
-    // Make a sparse proxy object.
-    SpProxy<T1> p(X.get_ref());
+    const newarp::LinOpMatProd<op_type> op(A);
     
-    // Make sure it's square.
-    arma_debug_check( (p.get_n_rows() != p.get_n_cols()), "eigs_gen(): given matrix must be square sized" );
+    arma_debug_check( (op.n_rows != op.n_cols), "eigs_sym(): given operator must be square sized" );
     
-    // Make sure we aren't asking for every eigenvalue.
-    arma_debug_check( (n_eigvals + 1 >= p.get_n_rows()), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
+    arma_debug_check( (n_eigvals >= op.n_rows), "eigs_sym(): n_eigvals must be less than the number of rows in the operator" );
     
-    // If the matrix is empty, the case is trivial.
-    if( (p.get_n_cols() == 0) || (n_eigvals == 0) ) // We already know n_cols == n_rows.
+    if( (op.n_cols == 0) || (n_eigvals == 0) )
       {
       eigval.reset();
       eigvec.reset();
       return true;
       }
     
-    // Set up variables that get used for neupd().
-    blas_int n, ncv, ldv, lworkl, info;
-    T tol = default_tol;
-    podarray<T> resid, v, workd, workl;
-    podarray<blas_int> iparam, ipntr;
-    podarray<T> rwork; // Not used in the real case.
-    
-    run_aupd(n_eigvals, which, p, false /* gen, not sym */, n, tol, resid, ncv, v, ldv, iparam, ipntr, workd, workl, lworkl, rwork, info);
-    
-    if(info != 0)
-      {
-      return false;
-      }
-
-    // The process has converged, and now we need to recover the actual eigenvectors using neupd().
-    blas_int rvec = 1; // .TRUE
-    blas_int nev = n_eigvals;
-    
-    char howmny = 'A';
-    char bmat   = 'I'; // We are considering the standard eigenvalue problem.
+    const uword n   = op.n_rows;
+          uword ncv = (std::max)(n_eigvals + 2 + 1, 2 * n_eigvals + 1);
     
-    podarray<blas_int> select(ncv); // Logical array of dimension NCV.
-    podarray<T> dr(nev + 1); // Real array of dimension NEV + 1.
-    podarray<T> di(nev + 1); // Real array of dimension NEV + 1.
-    podarray<T> z(n * (nev + 1)); // Real N by NEV array if HOWMNY = 'A'.
-    blas_int ldz = n;
-    podarray<T> workev(3 * ncv);
+    if(ncv > n)  { ncv = n; }
     
-    dr.zeros();
-    di.zeros();
-    z.zeros();
+    const eT tol = (std::max)(default_tol, std::numeric_limits<eT>::epsilon());
     
-    arpack::neupd(&rvec, &howmny, select.memptr(), dr.memptr(), di.memptr(), z.memptr(), &ldz, (T*) NULL, (T*) NULL, workev.memptr(), &bmat, &n, which, &nev, &tol, resid.memptr(), &ncv, v.memptr(), &ldv, iparam.memptr(), ipntr.memptr(), workd.memptr(), workl.memptr(), &lworkl, rwork.memptr(), &info);
+    return sp_auxlib::run_newarp_sym(eigval, eigvec, op, n_eigvals, ncv, form_val, tol);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(A);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_str);
+    arma_ignore(default_tol);
     
-    // Check for errors.
-    if(info != 0)
-      {
-      arma_debug_warn("eigs_gen(): ARPACK error ", info, " in neupd()");
-      return false;
-      }
+    arma_stop_logic_error("eigs_sym(): use of NEWARP must be enabled for structured operators");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! immediate eigendecomposition of non-symmetric real sparse object
+template<typename T, typename T1>
+inline
+bool
+sp_auxlib::eigs_gen(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X, const uword n_eigvals, const char* form_str, const T default_tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    return sp_auxlib::eigs_gen_newarp(eigval, eigvec, X, n_eigvals, form_str, default_tol);
+    }
+  #elif defined(ARMA_USE_ARPACK)
+    {
+    return sp_auxlib::eigs_gen_arpack(eigval, eigvec, X, n_eigvals, form_str, default_tol);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(X);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_str);
+    arma_ignore(default_tol);
+    
+    arma_stop_logic_error("eigs_gen(): use of NEWARP or ARPACK must be enabled");
+    return false;
+    }
+  #endif
+  }
+
+
+
+template<typename T, typename T1>
+inline
+bool
+sp_auxlib::eigs_gen_newarp(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X_expr, const uword n_eigvals, const char* form_str, const T default_tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    const form_type form_val = sp_auxlib::interpret_form_str(form_str);
+    
+    arma_debug_check( (form_val == form_none), "eigs_gen(): unknown form specified" );
+    
+    const unwrap_spmat<T1> U(X_expr.get_ref());
+    const SpMat<T>&        X = U.M;
+    
+    const newarp::SparseGenMatProd<T> op(X);
+    
+    arma_debug_check( (op.n_rows != op.n_cols), "eigs_sym(): given matrix must be square sized" );
+    
+    arma_debug_check( (n_eigvals + 1 >= op.n_rows), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
+    
+    // If the matrix is empty, the case is trivial.
+    if( (op.n_cols == 0) || (n_eigvals == 0) ) // We already know n_cols == n_rows.
+      {
+      eigval.reset();
+      eigvec.reset();
+      return true;
+      }
+    
+    uword n   = op.n_rows;
+    uword ncv = n_eigvals + 2 + 1;
+    
+    if(ncv < (2 * n_eigvals + 1)) { ncv = 2 * n_eigvals + 1; }
+    if(ncv > n)                   { ncv = n; }
+    
+    T tol = (std::max)(default_tol, std::numeric_limits<T>::epsilon());
+    
+    return sp_auxlib::run_newarp_gen(eigval, eigvec, op, n_eigvals, ncv, form_val, tol);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(X_expr);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_str);
+    arma_ignore(default_tol);
+    
+    return false;
+    }
+  #endif
+  }
+
+
+
+
+template<typename T, typename T1>
+inline
+bool
+sp_auxlib::eigs_gen_arpack(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X, const uword n_eigvals, const char* form_str, const T default_tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_ARPACK)
+    {
+    const form_type form_val = sp_auxlib::interpret_form_str(form_str);
+    
+    arma_debug_check( (form_val == form_none), "eigs_gen(): unknown form specified" );
+    
+    char which_lm[3] = "LM";
+    char which_sm[3] = "SM";
+    char which_lr[3] = "LR";
+    char which_sr[3] = "SR";
+    char which_li[3] = "LI";
+    char which_si[3] = "SI";
+    
+    char* which;
+    
+    switch(form_val)
+      {
+      case form_lm:  which = which_lm;  break;
+      case form_sm:  which = which_sm;  break;
+      case form_lr:  which = which_lr;  break;
+      case form_sr:  which = which_sr;  break;
+      case form_li:  which = which_li;  break;
+      case form_si:  which = which_si;  break;
+      
+      default:       which = which_lm;
+      }
+    
+    
+    // Make a sparse proxy object.
+    SpProxy<T1> p(X.get_ref());
+    
+    // Make sure it's square.
+    arma_debug_check( (p.get_n_rows() != p.get_n_cols()), "eigs_gen(): given matrix must be square sized" );
+    
+    // Make sure we aren't asking for every eigenvalue.
+    arma_debug_check( (n_eigvals + 1 >= p.get_n_rows()), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
+    
+    // If the matrix is empty, the case is trivial.
+    if( (p.get_n_cols() == 0) || (n_eigvals == 0) ) // We already know n_cols == n_rows.
+      {
+      eigval.reset();
+      eigvec.reset();
+      return true;
+      }
+    
+    // Set up variables that get used for neupd().
+    blas_int n, ncv, ldv, lworkl, info;
+    T tol = default_tol;
+    podarray<T> resid, v, workd, workl;
+    podarray<blas_int> iparam, ipntr;
+    podarray<T> rwork; // Not used in the real case.
+    
+    run_aupd(n_eigvals, which, p, false /* gen, not sym */, n, tol, resid, ncv, v, ldv, iparam, ipntr, workd, workl, lworkl, rwork, info);
+    
+    if(info != 0)
+      {
+      return false;
+      }
+
+    // The process has converged, and now we need to recover the actual eigenvectors using neupd().
+    blas_int rvec = 1; // .TRUE
+    blas_int nev = n_eigvals;
+    
+    char howmny = 'A';
+    char bmat   = 'I'; // We are considering the standard eigenvalue problem.
+    
+    podarray<blas_int> select(ncv); // Logical array of dimension NCV.
+    podarray<T> dr(nev + 1); // Real array of dimension NEV + 1.
+    podarray<T> di(nev + 1); // Real array of dimension NEV + 1.
+    podarray<T> z(n * (nev + 1)); // Real N by NEV array if HOWMNY = 'A'.
+    blas_int ldz = n;
+    podarray<T> workev(3 * ncv);
+    
+    dr.zeros();
+    di.zeros();
+    z.zeros();
+    
+    arpack::neupd(&rvec, &howmny, select.memptr(), dr.memptr(), di.memptr(), z.memptr(), &ldz, (T*) NULL, (T*) NULL, workev.memptr(), &bmat, &n, which, &nev, &tol, resid.memptr(), &ncv, v.memptr(), &ldv, iparam.memptr(), ipntr.memptr(), workd.memptr(), workl.memptr(), &lworkl, rwork.memptr(), &info);
+    
+    // Check for errors.
+    if(info != 0)
+      {
+      arma_debug_warn("eigs_gen(): ARPACK error ", info, " in neupd()");
+      return false;
+      }
     
     // Put it into the outputs.
     eigval.set_size(n_eigvals);
@@ -615,6 +758,391 @@ sp_auxlib::eigs_gen_arpack(Col< std::complex<T> >& eigval, Mat< std::complex<T>
 
 
 //! immediate eigendecomposition of non-symmetric complex sparse object
+//! eigendecomposition of non-symmetric real sparse object in shift-invert mode:
+//! finds the eigenvalues closest to the real shift sigma, via the largest eigenvalues of inv(X - sigma*I)
+template<typename T, typename T1>
+inline
+bool
+sp_auxlib::eigs_gen_shift(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& X_expr, const uword n_eigvals, const T sigma, const T default_tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    const unwrap_spmat<T1> U(X_expr.get_ref());
+    const SpMat<T>&        X = U.M;
+    
+    arma_debug_check( (X.n_rows != X.n_cols), "eigs_gen(): given matrix must be square sized" );
+    
+    arma_debug_check( (n_eigvals + 1 >= X.n_rows), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
+    
+    if( (X.n_cols == 0) || (n_eigvals == 0) )
+      {
+      eigval.reset();
+      eigvec.reset();
+      return true;
+      }
+    
+    const uword n   = X.n_rows;
+          uword ncv = (std::max)(n_eigvals + 2 + 1, 2 * n_eigvals + 1);
+    
+    if(ncv > n)  { ncv = n; }
+    
+    const T tol = (std::max)(default_tol, std::numeric_limits<T>::epsilon());
+    
+    bool status = true;
+    
+    uword nconv = 0;
+    
+    try
+      {
+      const SpMat<T> M = X - sigma * speye< SpMat<T> >(n, n);
+      
+      const newarp::SparseSolveMatProd<T> op(M, false);
+      
+      newarp::GenEigsRealShiftSolver< T, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseSolveMatProd<T> > eigs(op, n_eigvals, ncv, sigma);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    catch(const std::runtime_error&)
+      {
+      status = false;
+      }
+    
+    if(status == true)
+      {
+      if(nconv == 0)  { status = false; }
+      }
+    
+    return status;
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(X_expr);
+    arma_ignore(n_eigvals);
+    arma_ignore(sigma);
+    arma_ignore(default_tol);
+    
+    arma_stop_logic_error("eigs_gen(): use of NEWARP must be enabled for shift-invert mode");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! eigendecomposition of non-symmetric real sparse pair (A,B), such that A*x = lambda*B*x;
+//! regular mode uses the operator inv(B)*A, while shift-invert mode uses inv(A - sigma*B)*B
+template<typename T, typename T1, typename T2>
+inline
+bool
+sp_auxlib::eigs_gen_pair(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const SpBase<T, T1>& A_expr, const SpBase<T, T2>& B_expr, const uword n_eigvals, const char* form_str, const bool use_sigma, const T sigma, const T default_tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    const form_type form_val = (use_sigma) ? form_lm : sp_auxlib::interpret_form_str(form_str);
+    
+    arma_debug_check( (form_val == form_none), "eigs_gen(): unknown form specified" );
+    
+    const unwrap_spmat<T1> UA(A_expr.get_ref());
+    const unwrap_spmat<T2> UB(B_expr.get_ref());
+    
+    const SpMat<T>& A = UA.M;
+    const SpMat<T>& B = UB.M;
+    
+    arma_debug_check( (A.n_rows != A.n_cols), "eigs_gen(): given matrix must be square sized" );
+    
+    arma_debug_assert_same_size(A, B, "eigs_gen()");
+    
+    arma_debug_check( (n_eigvals + 1 >= A.n_rows), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the matrix" );
+    
+    if( (A.n_cols == 0) || (n_eigvals == 0) )
+      {
+      eigval.reset();
+      eigvec.reset();
+      return true;
+      }
+    
+    const uword n   = A.n_rows;
+          uword ncv = (std::max)(n_eigvals + 2 + 1, 2 * n_eigvals + 1);
+    
+    if(ncv > n)  { ncv = n; }
+    
+    const T tol = (std::max)(default_tol, std::numeric_limits<T>::epsilon());
+    
+    bool status = true;
+    
+    if(use_sigma)
+      {
+      uword nconv = 0;
+      
+      try
+        {
+        const SpMat<T> M = A - sigma * B;
+        
+        const newarp::SparseSolveMatProd<T> op(M, false, B);
+        
+        newarp::GenEigsRealShiftSolver< T, newarp::EigsSelect::LARGEST_MAGN, newarp::SparseSolveMatProd<T> > eigs(op, n_eigvals, ncv, sigma);
+        eigs.init();
+        nconv  = eigs.compute(1000, tol);
+        eigval = eigs.eigenvalues();
+        eigvec = eigs.eigenvectors();
+        }
+      catch(const std::runtime_error&)
+        {
+        status = false;
+        }
+      
+      if(nconv == 0)  { status = false; }
+      }
+    else
+      {
+      try
+        {
+        const newarp::SparseSolveMatProd<T> op(B, false, A);
+        
+        status = sp_auxlib::run_newarp_gen(eigval, eigvec, op, n_eigvals, ncv, form_val, tol);
+        }
+      catch(const std::runtime_error&)
+        {
+        status = false;
+        }
+      }
+    
+    return status;
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(A_expr);
+    arma_ignore(B_expr);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_str);
+    arma_ignore(use_sigma);
+    arma_ignore(sigma);
+    arma_ignore(default_tol);
+    
+    arma_stop_logic_error("eigs_gen(): use of NEWARP must be enabled for generalised decomposition");
+    return false;
+    }
+  #endif
+  }
+
+
+
+//! eigenvalues and eigenvectors of a general real structured operator (eg. sp_kron_op, sp_blockdiag_op),
+//! using only products of the operator with vectors
+template<typename T, typename op_type>
+inline
+bool
+sp_auxlib::eigs_gen_op(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const op_type& A, const uword n_eigvals, const char* form_str, const T default_tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_NEWARP)
+    {
+    const form_type form_val = sp_auxlib::interpret_form_str(form_str);
+    
+    arma_debug_check( (form_val == form_none), "eigs_gen(): unknown form specified" );
+    
+    const newarp::LinOpMatProd<op_type> op(A);
+    
+    arma_debug_check( (op.n_rows != op.n_cols), "eigs_gen(): given operator must be square sized" );
+    
+    arma_debug_check( (n_eigvals + 1 >= op.n_rows), "eigs_gen(): n_eigvals + 1 must be less than the number of rows in the operator" );
+    
+    if( (op.n_cols == 0) || (n_eigvals == 0) )
+      {
+      eigval.reset();
+      eigvec.reset();
+      return true;
+      }
+    
+    const uword n   = op.n_rows;
+          uword ncv = (std::max)(n_eigvals + 2 + 1, 2 * n_eigvals + 1);
+    
+    if(ncv > n)  { ncv = n; }
+    
+    const T tol = (std::max)(default_tol, std::numeric_limits<T>::epsilon());
+    
+    return sp_auxlib::run_newarp_gen(eigval, eigvec, op, n_eigvals, ncv, form_val, tol);
+    }
+  #else
+    {
+    arma_ignore(eigval);
+    arma_ignore(eigvec);
+    arma_ignore(A);
+    arma_ignore(n_eigvals);
+    arma_ignore(form_str);
+    arma_ignore(default_tol);
+    
+    arma_stop_logic_error("eigs_gen(): use of NEWARP must be enabled for structured operators");
+    return false;
+    }
+  #endif
+  }
+
+
+
+#if defined(ARMA_USE_NEWARP)
+
+//! runs the newarp solver for symmetric real matrices, with the selection rule given by form_val
+template<typename eT, typename OpType>
+inline
+bool
+sp_auxlib::run_newarp_sym(Col<eT>& eigval, Mat<eT>& eigvec, const OpType& op, const uword n_eigvals, const uword ncv, const form_type form_val, const eT tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  bool status = true;
+  
+  uword nconv = 0;
+  
+  try
+    {
+    if(form_val == form_lm)
+      {
+      newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_sm)
+      {
+      newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_la)
+      {
+      newarp::SymEigsSolver< eT, newarp::EigsSelect::LARGEST_ALGE, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_sa)
+      {
+      newarp::SymEigsSolver< eT, newarp::EigsSelect::SMALLEST_ALGE, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    }
+  catch(const std::runtime_error&)
+    {
+    status = false;
+    }
+  
+  if(status == true)
+    {
+    if(nconv == 0)  { status = false; }
+    }
+  
+  return status;
+  }
+
+
+
+//! runs the newarp solver for general real matrices, with the selection rule given by form_val
+template<typename T, typename OpType>
+inline
+bool
+sp_auxlib::run_newarp_gen(Col< std::complex<T> >& eigval, Mat< std::complex<T> >& eigvec, const OpType& op, const uword n_eigvals, const uword ncv, const form_type form_val, const T tol)
+  {
+  arma_extra_debug_sigprint();
+  
+  bool status = true;
+  
+  uword nconv = 0;
+  
+  try
+    {
+    if(form_val == form_lm)
+      {
+      newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_sm)
+      {
+      newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_MAGN, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_lr)
+      {
+      newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_REAL, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_sr)
+      {
+      newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_REAL, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_li)
+      {
+      newarp::GenEigsSolver< T, newarp::EigsSelect::LARGEST_IMAG, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    else
+    if(form_val == form_si)
+      {
+      newarp::GenEigsSolver< T, newarp::EigsSelect::SMALLEST_IMAG, OpType > eigs(op, n_eigvals, ncv);
+      eigs.init();
+      nconv  = eigs.compute(1000, tol);
+      eigval = eigs.eigenvalues();
+      eigvec = eigs.eigenvectors();
+      }
+    }
+  catch(const std::runtime_error&)
+    {
+    status = false;
+    }
+  
+  if(status == true)
+    {
+    if(nconv == 0)  { status = false; }
+    }
+  
+  return status;
+  }
+
+#endif
+
+
+
 template<typename T, typename T1>
 inline
 bool
@@ -0,0 +1,398 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_batch_helper
+//! @{
+
+
+//! construction of sparse matrices from unsorted (row, column) locations,
+//! via counting sorts instead of comparison based sorting
+namespace sp_batch_helper
+{
+
+
+
+//! first pass: elements in input order, bucketed by row;
+//! the column and value of each element are carried along, so that the second pass reads them sequentially
+template<typename eT>
+struct row_pass
+  {
+  const uword* locs_mem;
+  const eT*    vals_mem;
+        uword* tmp_cols;
+        eT*    tmp_vals;
+  
+  inline row_pass(const uword* in_locs_mem, const eT* in_vals_mem, uword* in_tmp_cols, eT* in_tmp_vals)
+    : locs_mem(in_locs_mem)
+    , vals_mem(in_vals_mem)
+    , tmp_cols(in_tmp_cols)
+    , tmp_vals(in_tmp_vals)
+    {
+    }
+  
+  arma_inline void  seek(const uword)                    {}
+  arma_inline uword  key(const uword j)            const { return locs_mem[2*j]; }
+  arma_inline void  emit(const uword pos, const uword j) { tmp_cols[pos] = locs_mem[2*j + 1];  tmp_vals[pos] = vals_mem[j]; }
+  };
+
+
+
+//! second pass: elements in row order, bucketed by column and placed directly into the CSC arrays;
+//! as the rows are visited in order, the rows within each column come out sorted
+template<typename eT>
+struct col_pass
+  {
+  const uword* row_ptrs;
+  const uword  n_rows;
+  const uword* tmp_cols;
+  const eT*    tmp_vals;
+        uword* row_indices;
+        eT*    values;
+        uword  row;
+  
+  inline col_pass(const uword* in_row_ptrs, const uword in_n_rows, const uword* in_tmp_cols, const eT* in_tmp_vals, uword* in_row_indices, eT* in_values)
+    : row_ptrs   (in_row_ptrs   )
+    , n_rows     (in_n_rows     )
+    , tmp_cols   (in_tmp_cols   )
+    , tmp_vals   (in_tmp_vals   )
+    , row_indices(in_row_indices)
+    , values     (in_values     )
+    , row        (0             )
+    {
+    }
+  
+  arma_inline
+  void
+  seek(const uword j)
+    {
+    // the last row starting at or before position j; empty rows share their start with the next row
+    row = uword( std::upper_bound(row_ptrs, row_ptrs + n_rows + 1, j) - row_ptrs ) - 1;
+    }
+  
+  arma_inline uword key(const uword j) const { return tmp_cols[j]; }
+  
+  arma_inline
+  void
+  emit(const uword pos, const uword j)
+    {
+    while(row_ptrs[row + 1] <= j)  { ++row; }
+    
+    row_indices[pos] = row;
+    values[pos]      = tmp_vals[j];
+    }
+  };
+
+
+
+//! the elements are bucketed by column straight from the input;
+//! used when there are more rows than elements
+template<typename eT>
+struct direct_col_pass
+  {
+  const uword* locs_mem;
+  const eT*    vals_mem;
+        uword* row_indices;
+        eT*    values;
+  
+  inline direct_col_pass(const uword* in_locs_mem, const eT* in_vals_mem, uword* in_row_indices, eT* in_values)
+    : locs_mem   (in_locs_mem   )
+    , vals_mem   (in_vals_mem   )
+    , row_indices(in_row_indices)
+    , values     (in_values     )
+    {
+    }
+  
+  arma_inline void  seek(const uword)                    {}
+  arma_inline uword  key(const uword j)            const { return locs_mem[2*j + 1]; }
+  arma_inline void  emit(const uword pos, const uword j) { row_indices[pos] = locs_mem[2*j];  values[pos] = vals_mem[j]; }
+  };
+
+
+
+//! the elements of a CSC matrix in storage order, bucketed by row;
+//! builds the row-compressed mirror (see SpMat::init_csr()), which records the column and CSC position of each element
+struct csr_pass
+  {
+  const uword* col_ptrs;
+  const uword  n_cols;
+  const uword* row_indices;
+        uword* col_indices;
+        uword* locs;
+        uword  col;
+  
+  inline csr_pass(const uword* in_col_ptrs, const uword in_n_cols, const uword* in_row_indices, uword* in_col_indices, uword* in_locs)
+    : col_ptrs   (in_col_ptrs   )
+    , n_cols     (in_n_cols     )
+    , row_indices(in_row_indices)
+    , col_indices(in_col_indices)
+    , locs       (in_locs       )
+    , col        (0             )
+    {
+    }
+  
+  arma_inline
+  void
+  seek(const uword j)
+    {
+    col = uword( std::upper_bound(col_ptrs, col_ptrs + n_cols + 1, j) - col_ptrs ) - 1;
+    }
+  
+  arma_inline uword key(const uword j) const { return row_indices[j]; }
+  
+  arma_inline
+  void
+  emit(const uword pos, const uword j)
+    {
+    while(col_ptrs[col + 1] <= j)  { ++col; }
+    
+    col_indices[pos] = col;
+    locs[pos]        = j;
+    }
+  };
+
+
+
+//! one stable pass of a counting sort over elements 0,1,...,N-1,
+//! using the bucket given by pass.key() and placing each element via pass.emit().
+//! on return, bucket_ptrs (n_buckets+1 elements) holds the start of each bucket.
+//! with OpenMP, each thread bucket-counts a contiguous chunk of the elements;
+//! the chunks are placed in thread order within each bucket, so the pass remains stable.
+template<typename pass_type>
+inline
+void
+counting_pass(const pass_type& pass, const uword N, const uword n_buckets, uword* bucket_ptrs)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    // the per-thread histograms must not take more memory than the elements themselves
+    if( mp_gate<uword>::eval(N) && (n_threads >= 2) && (n_buckets <= N / uword(n_threads)) )
+      {
+      podarray<uword> hist( uword(n_threads) * n_buckets );
+      
+      uword* hist_mem = hist.memptr();
+      
+      #pragma omp parallel num_threads(n_threads)
+        {
+        const uword t       = uword(omp_get_thread_num());
+        const uword t_count = uword(omp_get_num_threads());
+        const uword chunk   = (N + t_count - 1) / t_count;
+        const uword j_start = (std::min)(N, t * chunk);
+        const uword j_end   = (std::min)(N, j_start + chunk);
+        
+        pass_type local(pass);
+        
+        uword* h = &hist_mem[t * n_buckets];
+        
+        arrayops::fill_zeros(h, n_buckets);
+        
+        for(uword j=j_start; j < j_end; ++j)  { ++h[ local.key(j) ]; }
+        
+        #pragma omp barrier
+        
+        // the offset of each thread within each bucket, and the size of each bucket
+        #pragma omp for schedule(static)
+        for(uword b=0; b < n_buckets; ++b)
+          {
+          uword acc = 0;
+          
+          for(uword tt=0; tt < t_count; ++tt)
+            {
+            uword& val = hist_mem[tt * n_buckets + b];
+            
+            const uword tmp = val;  val = acc;  acc += tmp;
+            }
+          
+          bucket_ptrs[b + 1] = acc;
+          }
+        
+        #pragma omp single
+          {
+          bucket_ptrs[0] = 0;
+          
+          for(uword b=0; b < n_buckets; ++b)  { bucket_ptrs[b + 1] += bucket_ptrs[b]; }
+          }
+        
+        for(uword b=0; b < n_buckets; ++b)  { h[b] += bucket_ptrs[b]; }
+        
+        if(j_start < j_end)  { local.seek(j_start); }
+        
+        for(uword j=j_start; j < j_end; ++j)  { local.emit( h[ local.key(j) ]++, j ); }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  pass_type local(pass);
+  
+  arrayops::fill_zeros(bucket_ptrs, n_buckets + 1);
+  
+  for(uword j=0; j < N; ++j)  { ++bucket_ptrs[ local.key(j) + 1 ]; }
+  
+  for(uword b=0; b < n_buckets; ++b)  { bucket_ptrs[b + 1] += bucket_ptrs[b]; }
+  
+  podarray<uword> next(bucket_ptrs, n_buckets);
+  
+  uword* next_mem = next.memptr();
+  
+  if(N > 0)  { local.seek(0); }
+  
+  for(uword j=0; j < N; ++j)  { local.emit( next_mem[ local.key(j) ]++, j ); }
+  }
+
+
+
+//! fill the CSC arrays of out from unsorted locations.
+//! out must already have the correct size, with space for N = locs.n_cols elements.
+//! when add_values is true, elements at identical locations are summed,
+//! and out is shrunk to the number of unique locations.
+template<typename eT>
+inline
+void
+fill_unsorted(SpMat<eT>& out, const Mat<uword>& locs, const Mat<eT>& vals, const bool add_values)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N      = locs.n_cols;
+  const uword n_rows = out.n_rows;
+  const uword n_cols = out.n_cols;
+  
+  const uword* locs_mem = locs.memptr();
+  
+  for(uword i=0; i < N; ++i)
+    {
+    arma_debug_check( ( (locs_mem[2*i] >= n_rows) || (locs_mem[2*i + 1] >= n_cols) ), "SpMat::SpMat(): invalid row or column index" );
+    }
+  
+  uword* col_ptrs    = access::rwp(out.col_ptrs);
+  uword* row_indices = access::rwp(out.row_indices);
+  eT*    values      = access::rwp(out.values);
+  
+  if(n_rows <= N)
+    {
+    // two stable passes: by row, and then by column
+    
+    podarray<uword> row_ptrs(n_rows + 1);
+    podarray<uword> tmp_cols(N);
+    podarray<eT>    tmp_vals(N);
+    
+    counting_pass( row_pass<eT>(locs_mem, vals.memptr(), tmp_cols.memptr(), tmp_vals.memptr()), N, n_rows, row_ptrs.memptr() );
+    
+    counting_pass( col_pass<eT>(row_ptrs.memptr(), n_rows, tmp_cols.memptr(), tmp_vals.memptr(), row_indices, values), N, n_cols, col_ptrs );
+    }
+  else
+    {
+    // the histogram of rows would be larger than the elements themselves,
+    // so only the columns are counting sorted; the typically short columns are then sorted by row
+    
+    counting_pass( direct_col_pass<eT>(locs_mem, vals.memptr(), row_indices, values), N, n_cols, col_ptrs );
+    
+    podarray<uword> seg_rows;
+    podarray<eT>    seg_vals;
+    
+    std::vector< arma_sort_index_packet<uword> > packet_vec;
+    
+    arma_sort_index_helper_ascend<uword> comparator;
+    
+    for(uword c=0; c < n_cols; ++c)
+      {
+      const uword start = col_ptrs[c];
+      const uword m     = col_ptrs[c+1] - start;
+      
+      bool is_sorted = true;
+      
+      for(uword k=1; k < m; ++k)  { if(row_indices[start + k] < row_indices[start + k - 1])  { is_sorted = false; break; } }
+      
+      if(is_sorted)  { continue; }
+      
+      // see op_sort_index_bones.hpp for the definition of arma_sort_index_packet and arma_sort_index_helper_ascend
+      
+      packet_vec.resize(m);
+      
+      for(uword k=0; k < m; ++k)  { packet_vec[k].val = row_indices[start + k];  packet_vec[k].index = k; }
+      
+      std::stable_sort( packet_vec.begin(), packet_vec.end(), comparator );
+      
+      seg_rows.set_size(m);  arrayops::copy(seg_rows.memptr(), &row_indices[start], m);
+      seg_vals.set_size(m);  arrayops::copy(seg_vals.memptr(), &values[start],      m);
+      
+      for(uword k=0; k < m; ++k)
+        {
+        row_indices[start + k] = seg_rows[ packet_vec[k].index ];
+        values[start + k]      = seg_vals[ packet_vec[k].index ];
+        }
+      }
+    }
+  
+  if(add_values == false)
+    {
+    for(uword c=0; c < n_cols; ++c)
+      {
+      const uword k_end = col_ptrs[c+1];
+      
+      for(uword k = col_ptrs[c] + 1; k < k_end; ++k)
+        {
+        arma_debug_check( (row_indices[k] == row_indices[k-1]), "SpMat::SpMat(): detected identical locations" );
+        }
+      }
+    
+    return;
+    }
+  
+  // sum the elements at identical locations, which are adjacent after sorting
+  
+  uword count   = 0;
+  uword k_start = 0;
+  
+  for(uword c=0; c < n_cols; ++c)
+    {
+    const uword k_end   = col_ptrs[c+1];
+    const uword c_start = count;
+    
+    for(uword k=k_start; k < k_end; ++k)
+      {
+      if( (count > c_start) && (row_indices[k] == row_indices[count-1]) )
+        {
+        values[count-1] += values[k];
+        }
+      else
+        {
+        row_indices[count] = row_indices[k];
+        values[count]      = values[k];
+        
+        ++count;
+        }
+      }
+    
+    k_start = k_end;
+    
+    col_ptrs[c+1] = count;
+    }
+  
+  if(count < N)  { out.mem_resize(count); }
+  }
+
+
+
+}  // namespace sp_batch_helper
+
+
+//! @}
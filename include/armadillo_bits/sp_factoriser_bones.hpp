@@ -0,0 +1,163 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_factoriser
+//! @{
+
+
+//! doubly linked lists of variables with the same approximate degree, used by the AMD ordering
+struct sp_factoriser_degree_lists
+  {
+  const uword none;
+  
+  uword mindeg;
+  
+  podarray<uword> head;
+  podarray<uword> next;
+  podarray<uword> prev;
+  
+  inline sp_factoriser_degree_lists(const uword n)
+    : none  (n)
+    , mindeg(n)
+    , head  (n)
+    , next  (n)
+    , prev  (n)
+    {
+    head.fill(none);
+    }
+  
+  inline
+  void
+  insert(const uword i, const uword d)
+    {
+    next[i] = head[d];
+    prev[i] = none;
+    
+    if(head[d] != none)  { prev[ head[d] ] = i; }
+    
+    head[d] = i;
+    
+    if(d < mindeg)  { mindeg = d; }
+    }
+  
+  inline
+  void
+  remove(const uword i, const uword d)
+    {
+    if(prev[i] != none)  { next[ prev[i] ] = next[i]; }  else  { head[d] = next[i]; }
+    if(next[i] != none)  { prev[ next[i] ] = prev[i]; }
+    }
+  
+  //! remove and return a variable with the smallest degree; the lists must not be empty
+  inline
+  uword
+  pop_min()
+    {
+    while(head[mindeg] == none)  { ++mindeg; }
+    
+    const uword i = head[mindeg];
+    
+    remove(i, mindeg);
+    
+    return i;
+    }
+  };
+
+
+
+//! Direct factorisation of a sparse symmetric (or hermitian) matrix, computed once and then used to solve any number of systems.
+//! Supported methods: "chol" (positive definite matrices) and "ldl" (indefinite matrices with non-zero pivots).
+//! Supported orderings: "amd" (approximate minimum degree) and "none".
+//! The symbolic analysis (ordering, elimination tree and column counts of L) is kept,
+//! and is reused by factorise() when the given matrix has the same sparsity pattern.
+template<typename eT>
+class sp_factoriser
+  {
+  public:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  inline sp_factoriser();
+  
+  template<typename T1>
+  inline explicit sp_factoriser(const SpBase<eT,T1>& A, const char* method = "chol", const char* ordering = "amd");
+  
+  template<typename T1>
+  inline bool analyse(const SpBase<eT,T1>& A, const char* ordering = "amd");
+  
+  template<typename T1>
+  inline bool factorise(const SpBase<eT,T1>& A, const char* method = "chol", const char* ordering = "amd");
+  
+  inline void reset();
+  
+  inline bool  is_empty()  const;
+  inline uword n_rows()    const;
+  inline uword n_nonzero() const;
+  
+  template<typename T1>
+  inline bool solve(Mat<eT>& X, const Base<eT,T1>& B) const;
+  
+  template<typename T1>
+  inline Mat<eT> solve(const Base<eT,T1>& B) const;
+  
+  inline bool log_det(eT& out_val, T& out_sign) const;
+  
+  
+  private:
+  
+  enum method_type   { method_none,   method_chol, method_ldl };
+  enum ordering_type { ordering_none, ordering_amd            };
+  
+  method_type   method;
+  ordering_type ordering;
+  
+  bool  analysed;
+  uword N;
+  
+  // symbolic analysis;
+  // the factorisation is P*A*P' = L*D*L', with P given by perm (row k of P*A*P' is row perm[k] of A)
+  
+  uvec pattern_col_ptrs;      // sparsity pattern of the analysed matrix
+  uvec pattern_row_indices;
+  
+  uvec perm;
+  uvec iperm;
+  uvec parent;                // elimination tree; parent[k] == N for roots
+  uvec L_col_ptrs;
+  
+  // numeric factorisation: unit lower triangular L in compressed sparse column format, without its diagonal
+  
+  uvec    L_row_indices;
+  Col<eT> L_values;
+  Col<eT> D;
+  
+  inline static bool get_method  (method_type&   out, const char* in_method  );
+  inline static bool get_ordering(ordering_type& out, const char* in_ordering);
+  
+  inline bool same_pattern(const SpMat<eT>& A) const;
+  
+  inline void analyse_matrix(const SpMat<eT>& A, const ordering_type in_ordering);
+  
+  inline bool init_numeric(const SpMat<eT>& A, const method_type in_method);
+  
+  inline void solve_inplace(eT* x_mem, eT* c_mem) const;
+  
+  inline static void order_amd(uvec& out, const SpMat<eT>& A);
+  };
+
+
+
+//! @}
@@ -0,0 +1,895 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_factoriser
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_factoriser<eT>::sp_factoriser()
+  : method  (method_none  )
+  , ordering(ordering_none)
+  , analysed(false        )
+  , N       (0            )
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+sp_factoriser<eT>::sp_factoriser(const SpBase<eT,T1>& A, const char* in_method, const char* in_ordering)
+  : method  (method_none  )
+  , ordering(ordering_none)
+  , analysed(false        )
+  , N       (0            )
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = factorise(A, in_method, in_ordering);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("sp_factoriser(): factorisation failed");
+    }
+  }
+
+
+
+//! symbolic analysis only; the numeric factorisation is done by factorise()
+template<typename eT>
+template<typename T1>
+inline
+bool
+sp_factoriser<eT>::analyse(const SpBase<eT,T1>& A, const char* in_ordering)
+  {
+  arma_extra_debug_sigprint();
+  
+  reset();
+  
+  ordering_type in_ordering_type = ordering_none;
+  
+  if(get_ordering(in_ordering_type, in_ordering) == false)
+    {
+    arma_stop_logic_error("sp_factoriser::analyse(): unknown ordering");
+    return false;
+    }
+  
+  const unwrap_spmat<T1> U(A.get_ref());
+  
+  const SpMat<eT>& X = U.M;
+  
+  arma_debug_check( (X.n_rows != X.n_cols), "sp_factoriser::analyse(): given matrix must be square sized" );
+  
+  analyse_matrix(X, in_ordering_type);
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+sp_factoriser<eT>::factorise(const SpBase<eT,T1>& A, const char* in_method, const char* in_ordering)
+  {
+  arma_extra_debug_sigprint();
+  
+  method_type   in_method_type   = method_none;
+  ordering_type in_ordering_type = ordering_none;
+  
+  if(get_method(in_method_type, in_method) == false)
+    {
+    arma_stop_logic_error("sp_factoriser::factorise(): unknown method");
+    return false;
+    }
+  
+  if(get_ordering(in_ordering_type, in_ordering) == false)
+    {
+    arma_stop_logic_error("sp_factoriser::factorise(): unknown ordering");
+    return false;
+    }
+  
+  const unwrap_spmat<T1> U(A.get_ref());
+  
+  const SpMat<eT>& X = U.M;
+  
+  arma_debug_check( (X.n_rows != X.n_cols), "sp_factoriser::factorise(): given matrix must be square sized" );
+  
+  method = method_none;
+  
+  L_row_indices.reset();
+  L_values.reset();
+  D.reset();
+  
+  if( (analysed == false) || (ordering != in_ordering_type) || (same_pattern(X) == false) )
+    {
+    analyse_matrix(X, in_ordering_type);
+    }
+  else
+    {
+    arma_extra_debug_print("sp_factoriser::factorise(): reusing symbolic analysis");
+    }
+  
+  const bool status = init_numeric(X, in_method_type);
+  
+  if(status == false)
+    {
+    L_row_indices.reset();
+    L_values.reset();
+    D.reset();
+    
+    return false;
+    }
+  
+  method = in_method_type;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_factoriser<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  method   = method_none;
+  ordering = ordering_none;
+  analysed = false;
+  N        = 0;
+  
+  pattern_col_ptrs.reset();
+  pattern_row_indices.reset();
+  
+  perm.reset();
+  iperm.reset();
+  parent.reset();
+  L_col_ptrs.reset();
+  
+  L_row_indices.reset();
+  L_values.reset();
+  D.reset();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_factoriser<eT>::is_empty() const
+  {
+  return (method == method_none);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+sp_factoriser<eT>::n_rows() const
+  {
+  return N;
+  }
+
+
+
+//! number of non-zeros in L, including the diagonal
+template<typename eT>
+inline
+uword
+sp_factoriser<eT>::n_nonzero() const
+  {
+  return (method == method_none) ? uword(0) : (L_row_indices.n_elem + N);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+sp_factoriser<eT>::solve(Mat<eT>& X, const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (method == method_none), "sp_factoriser::solve(): no factorisation available" );
+  
+  X = B.get_ref();
+  
+  arma_debug_check( (X.n_rows != N), "sp_factoriser::solve(): number of rows in the given matrix must be the same as in the factorised matrix" );
+  
+  if(X.is_empty())  { return true; }
+  
+  podarray<eT> work(N);
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    solve_inplace(X.colptr(col), work.memptr());
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+sp_factoriser<eT>::solve(const Base<eT,T1>& B) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> X;
+  
+  solve(X, B);
+  
+  return X;
+  }
+
+
+
+//! log of the determinant of the factorised matrix, using the same conventions as log_det()
+template<typename eT>
+inline
+bool
+sp_factoriser<eT>::log_det(eT& out_val, T& out_sign) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (method == method_none), "sp_factoriser::log_det(): no factorisation available" );
+  
+  // det(A) = det(D), as det(P)^2 = 1 and L has a unit diagonal
+  
+  eT val  = eT(0);
+  T  sign = T(1);
+  
+  for(uword k=0; k < N; ++k)
+    {
+    const T d = access::tmp_real(D[k]);
+    
+    if(d < T(0))  { sign = -sign; }
+    
+    val += eT( std::log(std::abs(d)) );
+    }
+  
+  out_val  = val;
+  out_sign = sign;
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_factoriser<eT>::get_method(method_type& out, const char* in_method)
+  {
+  const char sig = (in_method != NULL) ? in_method[0] : char(0);
+  
+  if(sig == 'c')  { out = method_chol; return true; }
+  if(sig == 'l')  { out = method_ldl;  return true; }
+  
+  return false;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_factoriser<eT>::get_ordering(ordering_type& out, const char* in_ordering)
+  {
+  const char sig = (in_ordering != NULL) ? in_ordering[0] : char(0);
+  
+  if(sig == 'a')  { out = ordering_amd;  return true; }
+  if(sig == 'n')  { out = ordering_none; return true; }
+  
+  return false;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_factoriser<eT>::same_pattern(const SpMat<eT>& A) const
+  {
+  arma_extra_debug_sigprint();
+  
+  if( (A.n_rows != N) || (A.n_nonzero != pattern_row_indices.n_elem) )  { return false; }
+  
+  return ( std::equal(A.col_ptrs, A.col_ptrs + N+1, pattern_col_ptrs.memptr()) && std::equal(A.row_indices, A.row_indices + A.n_nonzero, pattern_row_indices.memptr()) );
+  }
+
+
+
+//! fill-reducing ordering, elimination tree and column counts of L, following the LDL package by T. Davis
+template<typename eT>
+inline
+void
+sp_factoriser<eT>::analyse_matrix(const SpMat<eT>& A, const ordering_type in_ordering)
+  {
+  arma_extra_debug_sigprint();
+  
+  N = A.n_rows;
+  
+  pattern_col_ptrs    = uvec(const_cast<uword*>(A.col_ptrs),    N+1,         false, true);
+  pattern_row_indices = uvec(const_cast<uword*>(A.row_indices), A.n_nonzero, false, true);
+  
+  if(in_ordering == ordering_amd)
+    {
+    order_amd(perm, A);
+    }
+  else
+    {
+    perm.set_size(N);
+    
+    for(uword k=0; k < N; ++k)  { perm[k] = k; }
+    }
+  
+  iperm.set_size(N);
+  
+  for(uword k=0; k < N; ++k)  { iperm[ perm[k] ] = k; }
+  
+  parent.set_size(N);
+  L_col_ptrs.set_size(N+1);
+  
+  podarray<uword> flag(N);
+  podarray<uword> L_nnz(N);
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  
+  // row k of L is found by walking up the elimination tree from each non-zero in column k of the upper triangle of P*A*P'
+  
+  for(uword k=0; k < N; ++k)
+    {
+    parent[k] = N;
+    flag[k]   = k;
+    L_nnz[k]  = 0;
+    
+    const uword kk = perm[k];
+    
+    for(uword p = A_col_ptrs[kk]; p < A_col_ptrs[kk+1]; ++p)
+      {
+      uword i = iperm[ A_row_indices[p] ];
+      
+      if(i >= k)  { continue; }
+      
+      for(; flag[i] != k; i = parent[i])
+        {
+        if(parent[i] == N)  { parent[i] = k; }
+        
+        ++L_nnz[i];
+        flag[i] = k;
+        }
+      }
+    }
+  
+  L_col_ptrs[0] = 0;
+  
+  for(uword k=0; k < N; ++k)  { L_col_ptrs[k+1] = L_col_ptrs[k] + L_nnz[k]; }
+  
+  ordering = in_ordering;
+  analysed = true;
+  }
+
+
+
+//! up-looking LDL' factorisation: row k of L is found by a sparse triangular solve with the rows computed so far
+template<typename eT>
+inline
+bool
+sp_factoriser<eT>::init_numeric(const SpMat<eT>& A, const method_type in_method)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword L_n_nonzero = L_col_ptrs[N];
+  
+  L_row_indices.set_size(L_n_nonzero);
+  L_values.set_size(L_n_nonzero);
+  D.set_size(N);
+  
+  podarray<eT>    Y(N);
+  podarray<uword> pattern(N);
+  podarray<uword> flag(N);
+  podarray<uword> L_nnz(N);
+  
+  Y.zeros();
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  const eT*    A_values      = A.values;
+  
+  const uword* parent_mem  = parent.memptr();
+  const uword* col_ptrs    = L_col_ptrs.memptr();
+        uword* row_indices = L_row_indices.memptr();
+        eT*    values      = L_values.memptr();
+  
+  eT* Y_mem = Y.memptr();
+  
+  for(uword k=0; k < N; ++k)
+    {
+    uword top = N;
+    
+    flag[k]  = k;
+    L_nnz[k] = 0;
+    
+    const uword kk = perm[k];
+    
+    // scatter column k of the upper triangle of P*A*P' into Y, and find the pattern of row k of L
+    for(uword p = A_col_ptrs[kk]; p < A_col_ptrs[kk+1]; ++p)
+      {
+      uword i = iperm[ A_row_indices[p] ];
+      
+      if(i > k)  { continue; }
+      
+      Y_mem[i] += A_values[p];
+      
+      uword len = 0;
+      
+      for(; flag[i] != k; i = parent_mem[i])
+        {
+        pattern[len++] = i;
+        flag[i]        = k;
+        }
+      
+      while(len > 0)  { pattern[--top] = pattern[--len]; }
+      }
+    
+    eT d = Y_mem[k];
+    
+    Y_mem[k] = eT(0);
+    
+    for(; top < N; ++top)
+      {
+      const uword i  = pattern[top];
+      const eT    yi = Y_mem[i];
+      
+      Y_mem[i] = eT(0);
+      
+      const uword p_end = col_ptrs[i] + L_nnz[i];
+      
+      for(uword p = col_ptrs[i]; p < p_end; ++p)  { Y_mem[ row_indices[p] ] -= values[p] * yi; }
+      
+      const eT l_ki = access::alt_conj(yi) / D[i];
+      
+      d -= l_ki * yi;
+      
+      row_indices[p_end] = k;
+      values[p_end]      = l_ki;
+      
+      ++L_nnz[i];
+      }
+    
+    // the pivots of a hermitian matrix are real
+    const T d_real = access::tmp_real(d);
+    
+    if(arma_isfinite(d_real) == false)  { return false; }
+    
+    if( (in_method == method_chol) && (d_real <= T(0)) )  { return false; }
+    
+    if( (in_method == method_ldl ) && (d_real == T(0)) )  { return false; }
+    
+    D[k] = eT(d_real);
+    }
+  
+  return true;
+  }
+
+
+
+//! x = inv(A) * x, where c is a work array of length N
+template<typename eT>
+inline
+void
+sp_factoriser<eT>::solve_inplace(eT* x_mem, eT* c_mem) const
+  {
+  const uword* perm_mem    = perm.memptr();
+  const uword* col_ptrs    = L_col_ptrs.memptr();
+  const uword* row_indices = L_row_indices.memptr();
+  const eT*    values      = L_values.memptr();
+  
+  for(uword k=0; k < N; ++k)  { c_mem[k] = x_mem[ perm_mem[k] ]; }
+  
+  for(uword j=0; j < N; ++j)
+    {
+    const eT c_j = c_mem[j];
+    
+    if(c_j == eT(0))  { continue; }
+    
+    for(uword p = col_ptrs[j]; p < col_ptrs[j+1]; ++p)  { c_mem[ row_indices[p] ] -= values[p] * c_j; }
+    }
+  
+  for(uword j=0; j < N; ++j)  { c_mem[j] /= D[j]; }
+  
+  for(uword j=N; j > 0; --j)
+    {
+    const uword jj = j-1;
+    
+    eT acc = c_mem[jj];
+    
+    for(uword p = col_ptrs[jj]; p < col_ptrs[jj+1]; ++p)  { acc -= access::alt_conj(values[p]) * c_mem[ row_indices[p] ]; }
+    
+    c_mem[jj] = acc;
+    }
+  
+  for(uword k=0; k < N; ++k)  { x_mem[ perm_mem[k] ] = c_mem[k]; }
+  }
+
+
+
+//! approximate minimum degree ordering (P. Amestoy, T. Davis, I. Duff, SIAM J. Matrix Anal. Appl., 1996)
+//! on the pattern of A + A'.
+//! the quotient graph holds variables (not yet eliminated) and elements (eliminated variables);
+//! indistinguishable variables are merged into supervariables, and elements contained in the newest element are absorbed.
+//! rows with more than max(16, 10*sqrt(n)) entries are ordered last.
+template<typename eT>
+inline
+void
+sp_factoriser<eT>::order_amd(uvec& out, const SpMat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n    = A.n_rows;
+  const uword none = n;
+  
+  out.set_size(n);
+  
+  if(n == 0)  { return; }
+  
+  enum { st_var, st_merged, st_elem, st_absorbed, st_dense };
+  
+  // variables: adjacent variables;  elements: the variables of the element
+  std::vector< std::vector<uword> > adj(n);
+  
+  // variables only: adjacent elements
+  std::vector< std::vector<uword> > elems(n);
+  
+  podarray<uword> status(n);
+  podarray<uword> mark(n);
+  podarray<uword> nv(n);
+  podarray<uword> degree(n);
+  podarray<uword> hash(n);
+  podarray<uword> elem_weight(n);
+  podarray<uword> w_tag(n);
+  podarray<uword> w_val(n);
+  podarray<uword> member_next(n);
+  podarray<uword> member_last(n);
+  
+  uword tag   = 0;
+  uword w_cur = 0;
+  
+  mark.zeros();
+  w_tag.zeros();
+  
+  // pattern of A + A', without the diagonal and without duplicates
+  
+    {
+    const uword* A_col_ptrs    = A.col_ptrs;
+    const uword* A_row_indices = A.row_indices;
+    
+    for(uword c=0; c < n; ++c)
+    for(uword p = A_col_ptrs[c]; p < A_col_ptrs[c+1]; ++p)
+      {
+      const uword r = A_row_indices[p];
+      
+      if(r != c)  { adj[r].push_back(c);  adj[c].push_back(r); }
+      }
+    
+    for(uword i=0; i < n; ++i)
+      {
+      ++tag;
+      
+      std::vector<uword>& list = adj[i];
+      
+      uword count = 0;
+      
+      for(uword q=0; q < list.size(); ++q)
+        {
+        const uword j = list[q];
+        
+        if(mark[j] != tag)  { mark[j] = tag;  list[count++] = j; }
+        }
+      
+      list.resize(count);
+      }
+    }
+  
+  const uword dense = (std::max)( uword(16), uword(10.0 * std::sqrt(double(n))) );
+  
+  uword n_dense = 0;
+  
+  for(uword i=0; i < n; ++i)
+    {
+    const bool is_dense = (adj[i].size() > dense);
+    
+    status[i]      = (is_dense) ? uword(st_dense) : uword(st_var);
+    nv[i]          = 1;
+    member_next[i] = none;
+    member_last[i] = i;
+    
+    if(is_dense)  { ++n_dense; }
+    }
+  
+  sp_factoriser_degree_lists lists(n);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    if(status[i] == st_dense)  { std::vector<uword>().swap(adj[i]);  continue; }
+    
+    std::vector<uword>& list = adj[i];
+    
+    uword count = 0;
+    
+    for(uword q=0; q < list.size(); ++q)
+      {
+      const uword j = list[q];
+      
+      if(status[j] != st_dense)  { list[count++] = j; }
+      }
+    
+    list.resize(count);
+    
+    degree[i] = count;
+    
+    lists.insert(i, degree[i]);
+    }
+  
+  uword n_live = n - n_dense;
+  uword k_out  = 0;
+  
+  std::vector<uword> Lp;
+  
+  std::vector< std::pair<uword,uword> > hash_list;
+  
+  while(n_live > 0)
+    {
+    // pivot: the supervariable with the smallest approximate degree
+    
+    const uword p = lists.pop_min();
+    
+    // the new element: L_p = ( A_p U (union of L_e for e in E_p) ) \ p
+    
+    ++tag;
+    
+    mark[p] = tag;
+    
+    Lp.clear();
+    
+    uword Lp_weight = 0;
+    
+    for(uword q=0; q < adj[p].size(); ++q)
+      {
+      const uword j = adj[p][q];
+      
+      if( (status[j] == st_var) && (mark[j] != tag) )  { mark[j] = tag;  Lp.push_back(j);  Lp_weight += nv[j]; }
+      }
+    
+    for(uword qe=0; qe < elems[p].size(); ++qe)
+      {
+      const uword e = elems[p][qe];
+      
+      if(status[e] != st_elem)  { continue; }
+      
+      for(uword q=0; q < adj[e].size(); ++q)
+        {
+        const uword j = adj[e][q];
+        
+        if( (status[j] == st_var) && (mark[j] != tag) )  { mark[j] = tag;  Lp.push_back(j);  Lp_weight += nv[j]; }
+        }
+      
+      // e is contained in the new element
+      status[e] = st_absorbed;
+      
+      std::vector<uword>().swap(adj[e]);
+      }
+    
+    for(uword j = p; j != none; j = member_next[j])  { out[k_out++] = j; }
+    
+    n_live -= nv[p];
+    
+    status[p]      = st_elem;
+    elem_weight[p] = Lp_weight;
+    
+    adj[p] = Lp;
+    
+    std::vector<uword>().swap(elems[p]);
+    
+    const std::vector<uword>& L = adj[p];
+    
+    const uword L_size = uword(L.size());
+    
+    for(uword q=0; q < L_size; ++q)  { lists.remove(L[q], degree[L[q]]); }
+    
+    // w(e) = |L_e \ L_p| for the elements adjacent to L_p
+    
+    ++w_cur;
+    
+    for(uword q=0; q < L_size; ++q)
+      {
+      const uword i = L[q];
+      
+      for(uword qe=0; qe < elems[i].size(); ++qe)
+        {
+        const uword e = elems[i][qe];
+        
+        if(status[e] != st_elem)  { continue; }
+        
+        if(w_tag[e] != w_cur)  { w_tag[e] = w_cur;  w_val[e] = elem_weight[e]; }
+        
+        w_val[e] = (w_val[e] >= nv[i]) ? (w_val[e] - nv[i]) : uword(0);
+        }
+      }
+    
+    // approximate external degree of each variable in L_p
+    
+    for(uword q=0; q < L_size; ++q)
+      {
+      const uword i = L[q];
+      
+      uword h = 0;
+      
+      uword deg_e = 0;
+      
+      std::vector<uword>& i_elems = elems[i];
+      
+      uword count = 0;
+      
+      for(uword qe=0; qe < i_elems.size(); ++qe)
+        {
+        const uword e = i_elems[qe];
+        
+        if(status[e] != st_elem)  { continue; }
+        
+        if(w_val[e] == 0)
+          {
+          // aggressive absorption: L_e is a subset of L_p
+          status[e] = st_absorbed;
+          
+          std::vector<uword>().swap(adj[e]);
+          
+          continue;
+          }
+        
+        i_elems[count++] = e;
+        
+        deg_e += w_val[e];
+        h     += e;
+        }
+      
+      i_elems.resize(count);
+      i_elems.push_back(p);
+      
+      h += p;
+      
+      // variables in L_p are now reached through p
+      
+      uword deg_a = 0;
+      
+      std::vector<uword>& i_adj = adj[i];
+      
+      count = 0;
+      
+      for(uword qa=0; qa < i_adj.size(); ++qa)
+        {
+        const uword j = i_adj[qa];
+        
+        if( (status[j] != st_var) || (mark[j] == tag) )  { continue; }
+        
+        i_adj[count++] = j;
+        
+        deg_a += nv[j];
+        h     += j;
+        }
+      
+      i_adj.resize(count);
+      
+      const uword ext = Lp_weight - nv[i];
+      
+      uword d = (std::min)( degree[i] + ext, deg_a + deg_e + ext );
+      
+      d = (std::min)( d, n_live - nv[i] );
+      
+      degree[i] = d;
+      hash[i]   = h;
+      }
+    
+    // supervariables: variables in L_p with identical adjacent elements and variables
+    
+    hash_list.clear();
+    
+    for(uword q=0; q < L_size; ++q)  { hash_list.push_back( std::make_pair(hash[L[q]], L[q]) ); }
+    
+    std::sort(hash_list.begin(), hash_list.end());
+    
+    for(uword a=0; a < L_size; )
+      {
+      uword b = a+1;
+      
+      while( (b < L_size) && (hash_list[b].first == hash_list[a].first) )  { ++b; }
+      
+      for(uword x=a; x+1 < b; ++x)
+        {
+        const uword i = hash_list[x].second;
+        
+        if(status[i] != st_var)  { continue; }
+        
+        ++tag;
+        
+        for(uword qa=0; qa < adj[i].size();   ++qa)  { mark[ adj[i][qa]   ] = tag; }
+        for(uword qe=0; qe < elems[i].size(); ++qe)  { mark[ elems[i][qe] ] = tag; }
+        
+        for(uword y=x+1; y < b; ++y)
+          {
+          const uword j = hash_list[y].second;
+          
+          if( (status[j] != st_var) || (adj[j].size() != adj[i].size()) || (elems[j].size() != elems[i].size()) )  { continue; }
+          
+          bool same = true;
+          
+          for(uword qa=0; (qa < adj[j].size())   && same; ++qa)  { same = (mark[ adj[j][qa]   ] == tag); }
+          for(uword qe=0; (qe < elems[j].size()) && same; ++qe)  { same = (mark[ elems[j][qe] ] == tag); }
+          
+          if(same == false)  { continue; }
+          
+          // merge j into i
+          
+          degree[i] = (degree[i] >= nv[j]) ? (degree[i] - nv[j]) : uword(0);
+          
+          nv[i] += nv[j];
+          nv[j]  = 0;
+          
+          status[j] = st_merged;
+          
+          member_next[ member_last[i] ] = j;
+          member_last[i]                = member_last[j];
+          
+          std::vector<uword>().swap(adj[j]);
+          std::vector<uword>().swap(elems[j]);
+          }
+        }
+      
+      a = b;
+      }
+    
+    for(uword q=0; q < L_size; ++q)
+      {
+      const uword i = L[q];
+      
+      if(status[i] == st_var)  { lists.insert(i, degree[i]); }
+      }
+    }
+  
+  for(uword i=0; i < n; ++i)
+    {
+    if(status[i] == st_dense)  { out[k_out++] = i; }
+    }
+  }
+
+
+
+//! @}
@@ -0,0 +1,97 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_krylov
+//! @{
+
+
+//! y = A*x for a sparse matrix held in CSC format.
+//! For large matrices a row-oriented copy is used, so that the product can be split across threads;
+//! for symmetric (hermitian) matrices the columns of A are used directly as rows.
+template<typename eT>
+class sp_krylov_matvec
+  {
+  public:
+  
+  inline sp_krylov_matvec(const SpMat<eT>& in_A, const bool is_herm);
+  
+  inline void apply(Col<eT>& y, const Col<eT>& x) const;
+  
+  const SpMat<eT>& A;
+  
+  
+  private:
+  
+  SpMat<eT> At;
+  
+  bool use_rows;
+  bool rows_from_A;
+  
+  inline void apply_cols(eT* y_mem, const eT* x_mem) const;
+  inline void apply_rows(eT* y_mem, const eT* x_mem, const SpMat<eT>& R, const uword row_start, const uword row_end_p1) const;
+  };
+
+
+
+//! identity preconditioner
+class sp_precond_none
+  {
+  public:
+  
+  template<typename eT>
+  arma_inline void apply(Col<eT>& z, const Col<eT>& r) const { z = r; }
+  
+  arma_inline uword n_rows() const { return 0; }
+  };
+
+
+
+//! native Krylov subspace solvers used by spsolve()
+class sp_krylov
+  {
+  public:
+  
+  template<typename T1, typename T2, typename precond_type>
+  inline static bool apply(Mat<typename T1::elem_type>& out, const SpBase<typename T1::elem_type, T1>& A, const Base<typename T1::elem_type, T2>& B, const char sig, const iterative_opts& opts, const precond_type& M);
+  
+  template<typename op_type, typename T2, typename precond_type>
+  inline static bool apply_linop(Mat<typename op_type::elem_type>& out, const op_type& A, const Base<typename op_type::elem_type, T2>& B, const char sig, const iterative_opts& opts, const precond_type& M);
+  
+  template<typename eT, typename precond_type>
+  inline static bool apply_mat(Mat<eT>& X, const SpMat<eT>& A, const Mat<eT>& B, const precond_type& M, const char sig, const iterative_opts& opts);
+  
+  template<typename eT, typename op_type, typename precond_type>
+  inline static bool apply_op(Mat<eT>& X, const op_type& A, const Mat<eT>& B, const precond_type& M, const char sig, const iterative_opts& opts);
+  
+  template<typename eT, typename op_type, typename precond_type>
+  inline static bool solve_col(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_resid, const op_type& A, const Col<eT>& b, const precond_type& M, const char sig, const iterative_opts& opts);
+  
+  template<typename eT, typename op_type, typename precond_type>
+  inline static uword cg(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter);
+  
+  template<typename eT, typename op_type, typename precond_type>
+  inline static uword minres(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter);
+  
+  template<typename eT, typename op_type, typename precond_type>
+  inline static uword bicgstab(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter);
+  
+  template<typename eT, typename op_type, typename precond_type>
+  inline static uword gmres(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter, const uword restart);
+  };
+
+
+
+//! @}
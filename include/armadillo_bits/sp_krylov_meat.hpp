@@ -0,0 +1,807 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_krylov
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_krylov_matvec<eT>::sp_krylov_matvec(const SpMat<eT>& in_A, const bool is_herm)
+  : A          (in_A )
+  , use_rows   (false)
+  , rows_from_A(false)
+  {
+  arma_extra_debug_sigprint();
+  
+  A.sync();
+  
+  if(is_herm)
+    {
+    // the columns of a hermitian matrix are the conjugated rows
+    use_rows    = true;
+    rows_from_A = true;
+    }
+  else
+  if( arma_config::openmp && mp_gate<eT>::eval(A.n_nonzero) && (mp_thread_limit::get() >= 2) )
+    {
+    spop_strans::apply_spmat(At, A);
+    
+    use_rows = true;
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_krylov_matvec<eT>::apply(Col<eT>& y, const Col<eT>& x) const
+  {
+  arma_extra_debug_sigprint();
+  
+  y.set_size(A.n_rows);
+  
+  eT*       y_mem = y.memptr();
+  const eT* x_mem = x.memptr();
+  
+  if(use_rows == false)  { apply_cols(y_mem, x_mem); return; }
+  
+  const SpMat<eT>& R = (rows_from_A) ? A : At;
+  
+  const uword n_rows = A.n_rows;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    if( (n_threads >= 2) && mp_gate<eT>::eval(A.n_nonzero) )
+      {
+      // split the rows so that each thread handles about the same number of non-zeros
+      
+      const uword n_chunks = uword(n_threads);
+      
+      podarray<uword> bounds(n_chunks+1);
+      
+      bounds[0]        = 0;
+      bounds[n_chunks] = n_rows;
+      
+      const uword* col_ptrs = R.col_ptrs;
+      
+      for(uword chunk=1; chunk < n_chunks; ++chunk)
+        {
+        const uword target = (R.n_nonzero / n_chunks) * chunk;
+        
+        bounds[chunk] = uword( std::lower_bound(col_ptrs, col_ptrs + n_rows, target) - col_ptrs );
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword chunk=0; chunk < n_chunks; ++chunk)
+        {
+        apply_rows(y_mem, x_mem, R, bounds[chunk], bounds[chunk+1]);
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  apply_rows(y_mem, x_mem, R, 0, n_rows);
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_krylov_matvec<eT>::apply_cols(eT* y_mem, const eT* x_mem) const
+  {
+  arrayops::fill_zeros(y_mem, A.n_rows);
+  
+  const uword* col_ptrs    = A.col_ptrs;
+  const uword* row_indices = A.row_indices;
+  const eT*    values      = A.values;
+  
+  const uword n_cols = A.n_cols;
+  
+  for(uword col=0; col < n_cols; ++col)
+    {
+    const eT x_val = x_mem[col];
+    
+    if(x_val == eT(0))  { continue; }
+    
+    const uword index_end = col_ptrs[col+1];
+    
+    for(uword i=col_ptrs[col]; i < index_end; ++i)
+      {
+      y_mem[ row_indices[i] ] += values[i] * x_val;
+      }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_krylov_matvec<eT>::apply_rows(eT* y_mem, const eT* x_mem, const SpMat<eT>& R, const uword row_start, const uword row_end_p1) const
+  {
+  const uword* col_ptrs    = R.col_ptrs;
+  const uword* row_indices = R.row_indices;
+  const eT*    values      = R.values;
+  
+  const bool do_conj = (rows_from_A && is_cx<eT>::yes);
+  
+  for(uword row=row_start; row < row_end_p1; ++row)
+    {
+    const uword index_end = col_ptrs[row+1];
+    
+    eT acc = eT(0);
+    
+    if(do_conj)
+      {
+      for(uword i=col_ptrs[row]; i < index_end; ++i)  { acc += access::alt_conj(values[i]) * x_mem[ row_indices[i] ]; }
+      }
+    else
+      {
+      for(uword i=col_ptrs[row]; i < index_end; ++i)  { acc += values[i] * x_mem[ row_indices[i] ]; }
+      }
+    
+    y_mem[row] = acc;
+    }
+  }
+
+
+
+template<typename T1, typename T2, typename precond_type>
+inline
+bool
+sp_krylov::apply(Mat<typename T1::elem_type>& out, const SpBase<typename T1::elem_type, T1>& A_expr, const Base<typename T1::elem_type, T2>& B_expr, const char sig, const iterative_opts& opts, const precond_type& M)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  opts.n_iter    = 0;
+  opts.rel_resid = 0.0;
+  opts.converged = false;
+  
+  arma_debug_check( (opts.tol < double(0)), "spsolve(): tol must be non-negative" );
+  
+  const unwrap_spmat<T1> UA(A_expr.get_ref());
+  
+  const SpMat<eT>& A = UA.M;
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "spsolve(): matrix A must be square sized" );
+  
+  const quasi_unwrap<T2> UB(B_expr.get_ref());
+  
+  const Mat<eT>& B = UB.M;
+  
+  arma_debug_check( (A.n_rows != B.n_rows), "spsolve(): number of rows in the given objects must be the same" );
+  
+  arma_debug_check( ((M.n_rows() != 0) && (M.n_rows() != A.n_rows)), "spsolve(): preconditioner has wrong size" );
+  
+  // X is separate from out, so B is still intact when out is also used for B
+  
+  Mat<eT> X;
+  
+  if( opts.warm_start && (out.n_rows == A.n_cols) && (out.n_cols == B.n_cols) )
+    {
+    X = out;
+    }
+  else
+    {
+    X.zeros(A.n_cols, B.n_cols);
+    }
+  
+  const bool status = sp_krylov::apply_mat(X, A, B, M, sig, opts);
+  
+  out.steal_mem(X);
+  
+  return status;
+  }
+
+
+
+//! as apply(), for operators which are not stored as a sparse matrix (eg. sp_kron_op and sp_blockdiag_op)
+template<typename op_type, typename T2, typename precond_type>
+inline
+bool
+sp_krylov::apply_linop(Mat<typename op_type::elem_type>& out, const op_type& A, const Base<typename op_type::elem_type, T2>& B_expr, const char sig, const iterative_opts& opts, const precond_type& M)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename op_type::elem_type eT;
+  
+  opts.n_iter    = 0;
+  opts.rel_resid = 0.0;
+  opts.converged = false;
+  
+  arma_debug_check( (opts.tol < double(0)), "spsolve(): tol must be non-negative" );
+  
+  arma_debug_check( (A.n_rows != A.n_cols), "spsolve(): operator A must be square sized" );
+  
+  const quasi_unwrap<T2> UB(B_expr.get_ref());
+  
+  const Mat<eT>& B = UB.M;
+  
+  arma_debug_check( (A.n_rows != B.n_rows), "spsolve(): number of rows in the given objects must be the same" );
+  
+  arma_debug_check( ((M.n_rows() != 0) && (M.n_rows() != A.n_rows)), "spsolve(): preconditioner has wrong size" );
+  
+  Mat<eT> X;
+  
+  if( opts.warm_start && (out.n_rows == A.n_cols) && (out.n_cols == B.n_cols) )
+    {
+    X = out;
+    }
+  else
+    {
+    X.zeros(A.n_cols, B.n_cols);
+    }
+  
+  const bool status = sp_krylov::apply_op(X, A, B, M, sig, opts);
+  
+  out.steal_mem(X);
+  
+  return status;
+  }
+
+
+
+template<typename eT, typename precond_type>
+inline
+bool
+sp_krylov::apply_mat(Mat<eT>& X, const SpMat<eT>& A, const Mat<eT>& B, const precond_type& M, const char sig, const iterative_opts& opts)
+  {
+  arma_extra_debug_sigprint();
+  
+  if(A.n_rows == 0)  { opts.converged = true; return true; }
+  
+  // CG and MINRES require a symmetric (hermitian) matrix
+  const bool is_herm = (sig == 'c') || (sig == 'm');
+  
+  const sp_krylov_matvec<eT> AA(A, is_herm);
+  
+  return sp_krylov::apply_op(X, AA, B, M, sig, opts);
+  }
+
+
+
+//! solve A*X = B column by column, where A is any object providing A.apply(y,x) for y = A*x
+template<typename eT, typename op_type, typename precond_type>
+inline
+bool
+sp_krylov::apply_op(Mat<eT>& X, const op_type& A, const Mat<eT>& B, const precond_type& M, const char sig, const iterative_opts& opts)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = B.n_rows;
+  
+  if(N == 0)  { opts.converged = true; return true; }
+  
+  Col<eT> b(N);
+  Col<eT> x(N);
+  
+  bool  status     = true;
+  uword max_n_iter = 0;
+  T     max_resid  = T(0);
+  
+  for(uword col=0; col < B.n_cols; ++col)
+    {
+    arrayops::copy(b.memptr(), B.colptr(col), N);
+    arrayops::copy(x.memptr(), X.colptr(col), N);
+    
+    uword n_iter    = 0;
+    T     rel_resid = T(0);
+    
+    const bool col_status = sp_krylov::solve_col(x, n_iter, rel_resid, A, b, M, sig, opts);
+    
+    arrayops::copy(X.colptr(col), x.memptr(), N);
+    
+    status     = status && col_status;
+    max_n_iter = (std::max)(max_n_iter, n_iter);
+    max_resid  = (arma_isnan(rel_resid) || arma_isnan(max_resid)) ? Datum<T>::nan : (std::max)(max_resid, rel_resid);
+    }
+  
+  opts.n_iter    = (unsigned int)(max_n_iter);
+  opts.rel_resid = double(max_resid);
+  opts.converged = status;
+  
+  return status;
+  }
+
+
+
+//! Solve A*x = b for one column.
+//! The Krylov methods track an updated residual which can drift from the true residual,
+//! so the result is checked against b - A*x and the method is restarted from x when needed.
+template<typename eT, typename op_type, typename precond_type>
+inline
+bool
+sp_krylov::solve_col(Col<eT>& x, uword& n_iter, typename get_pod_type<eT>::result& rel_resid, const op_type& A, const Col<eT>& b, const precond_type& M, const char sig, const iterative_opts& opts)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  n_iter    = 0;
+  rel_resid = T(0);
+  
+  const T b_norm = norm(b, 2);
+  
+  if(b_norm == T(0))  { x.zeros(); return true; }
+  
+  // tolerances tighter than the precision of the element type can't be reached
+  const T tol      = (std::max)( T(opts.tol), T(10) * std::numeric_limits<T>::epsilon() );
+  const T tol_abs  = tol * b_norm;
+  const uword max_iter = uword(opts.max_iter);
+  const uword restart  = (std::max)( uword(1), (std::min)( uword(opts.restart), uword(b.n_elem) ) );
+  
+  Col<eT> r(b.n_elem);
+  
+  while(true)
+    {
+    const uword remaining = max_iter - n_iter;
+    
+    uword n_used = 0;
+    
+    switch(sig)
+      {
+      case 'c':  n_used = sp_krylov::cg      (x, A, b, M, tol_abs, remaining);           break;
+      case 'm':  n_used = sp_krylov::minres  (x, A, b, M, tol_abs, remaining);           break;
+      case 'b':  n_used = sp_krylov::bicgstab(x, A, b, M, tol_abs, remaining);           break;
+      default:   n_used = sp_krylov::gmres   (x, A, b, M, tol_abs, remaining, restart);
+      }
+    
+    n_iter += n_used;
+    
+    A.apply(r, x);
+    
+    r = b - r;
+    
+    rel_resid = norm(r, 2) / b_norm;
+    
+    if(rel_resid <= tol)  { return true; }
+    
+    if( (n_used == 0) || (n_iter >= max_iter) || arma_isnan(rel_resid) )  { return false; }
+    }
+  }
+
+
+
+//! preconditioned conjugate gradient; A must be symmetric (hermitian) positive definite
+template<typename eT, typename op_type, typename precond_type>
+inline
+uword
+sp_krylov::cg(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = b.n_elem;
+  
+  Col<eT> r(N);
+  Col<eT> z(N);
+  Col<eT> p(N);
+  Col<eT> q(N);
+  
+  A.apply(q, x);
+  
+  r = b - q;
+  
+  if(norm(r, 2) <= tol_abs)  { return 0; }
+  
+  M.apply(z, r);
+  
+  p = z;
+  
+  eT rz = cdot(r, z);
+  
+  uword iter = 0;
+  
+  while(iter < max_iter)
+    {
+    A.apply(q, p);
+    
+    const eT pq = cdot(p, q);
+    
+    if( (pq == eT(0)) || (rz == eT(0)) )  { break; }
+    
+    const eT alpha = rz / pq;
+    
+    x += alpha * p;
+    r -= alpha * q;
+    
+    ++iter;
+    
+    if(norm(r, 2) <= tol_abs)  { break; }
+    
+    M.apply(z, r);
+    
+    const eT rz_new = cdot(r, z);
+    
+    const eT beta = rz_new / rz;
+    
+    rz = rz_new;
+    
+    p = z + beta * p;
+    }
+  
+  return iter;
+  }
+
+
+
+//! preconditioned MINRES for symmetric (hermitian) indefinite matrices;
+//! the preconditioner must be symmetric (hermitian) positive definite.
+//! Based on the algorithm by Paige and Saunders (SIAM J. Numer. Anal. 12, 1975).
+template<typename eT, typename op_type, typename precond_type>
+inline
+uword
+sp_krylov::minres(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = b.n_elem;
+  
+  Col<eT> r1(N);
+  Col<eT> r2(N);
+  Col<eT> y (N);
+  Col<eT> v (N);
+  
+  Col<eT> w (N, fill::zeros);
+  Col<eT> w1(N, fill::zeros);
+  Col<eT> w2(N, fill::zeros);
+  
+  A.apply(y, x);
+  
+  r1 = b - y;
+  
+  const T r_norm = norm(r1, 2);
+  
+  if(r_norm <= tol_abs)  { return 0; }
+  
+  M.apply(y, r1);
+  
+  const T beta1_sq = access::tmp_real( cdot(r1, y) );
+  
+  if(beta1_sq <= T(0))  { return 0; }
+  
+  const T beta1 = std::sqrt(beta1_sq);
+  
+  // the recurrence tracks the residual in the norm induced by the preconditioner
+  const T tol_phi = beta1 * (tol_abs / r_norm);
+  
+  r2 = r1;
+  
+  T oldb   = T(0);
+  T beta   = beta1;
+  T dbar   = T(0);
+  T epsln  = T(0);
+  T phibar = beta1;
+  T cs     = T(-1);
+  T sn     = T(0);
+  
+  uword iter = 0;
+  
+  while(iter < max_iter)
+    {
+    v = eT(T(1) / beta) * y;
+    
+    A.apply(y, v);
+    
+    if(iter > 0)  { y -= eT(beta / oldb) * r1; }
+    
+    const T alfa = access::tmp_real( cdot(v, y) );
+    
+    y -= eT(alfa / beta) * r2;
+    
+    r1.swap(r2);
+    r2 = y;
+    
+    M.apply(y, r2);
+    
+    oldb = beta;
+    
+    const T beta_sq = access::tmp_real( cdot(r2, y) );
+    
+    if(beta_sq < T(0))  { break; }
+    
+    beta = std::sqrt(beta_sq);
+    
+    const T oldeps = epsln;
+    const T delta  = cs*dbar + sn*alfa;
+    const T gbar   = sn*dbar - cs*alfa;
+    
+    epsln =  sn*beta;
+    dbar  = -cs*beta;
+    
+    const T gamma = (std::max)( std::sqrt(gbar*gbar + beta*beta), std::numeric_limits<T>::epsilon() );
+    
+    cs = gbar / gamma;
+    sn = beta / gamma;
+    
+    const T phi = cs * phibar;
+    
+    phibar = sn * phibar;
+    
+    w1.swap(w2);
+    w2.swap(w);
+    
+    w = (v - eT(oldeps)*w1 - eT(delta)*w2) * eT(T(1) / gamma);
+    
+    x += eT(phi) * w;
+    
+    ++iter;
+    
+    if( (phibar <= tol_phi) || (beta == T(0)) )  { break; }
+    }
+  
+  return iter;
+  }
+
+
+
+//! BiCGSTAB with right preconditioning, for general square matrices;
+//! H. A. van der Vorst, SIAM J. Sci. Stat. Comput. 13 (1992)
+template<typename eT, typename op_type, typename precond_type>
+inline
+uword
+sp_krylov::bicgstab(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = b.n_elem;
+  
+  Col<eT> r   (N);
+  Col<eT> rhat(N);
+  Col<eT> phat(N);
+  Col<eT> s   (N);
+  Col<eT> shat(N);
+  Col<eT> t   (N);
+  
+  Col<eT> p(N, fill::zeros);
+  Col<eT> v(N, fill::zeros);
+  
+  A.apply(t, x);
+  
+  r = b - t;
+  
+  if(norm(r, 2) <= tol_abs)  { return 0; }
+  
+  rhat = r;
+  
+  eT rho   = eT(1);
+  eT alpha = eT(1);
+  eT omega = eT(1);
+  
+  uword iter = 0;
+  
+  while(iter < max_iter)
+    {
+    const eT rho_new = cdot(rhat, r);
+    
+    if(rho_new == eT(0))  { break; }
+    
+    const eT beta = (rho_new / rho) * (alpha / omega);
+    
+    rho = rho_new;
+    
+    p = r + beta * (p - omega * v);
+    
+    M.apply(phat, p);
+    A.apply(v, phat);
+    
+    const eT rv = cdot(rhat, v);
+    
+    if(rv == eT(0))  { break; }
+    
+    alpha = rho / rv;
+    
+    s = r - alpha * v;
+    
+    ++iter;
+    
+    if(norm(s, 2) <= tol_abs)  { x += alpha * phat; break; }
+    
+    M.apply(shat, s);
+    A.apply(t, shat);
+    
+    const T tt = access::tmp_real( cdot(t, t) );
+    
+    if(tt == T(0))  { x += alpha * phat; break; }
+    
+    omega = cdot(t, s) / eT(tt);
+    
+    x += alpha * phat + omega * shat;
+    
+    r = s - omega * t;
+    
+    if( (norm(r, 2) <= tol_abs) || (omega == eT(0)) )  { break; }
+    }
+  
+  return iter;
+  }
+
+
+
+//! restarted GMRES with right preconditioning, for general square matrices;
+//! Y. Saad and M. H. Schultz, SIAM J. Sci. Stat. Comput. 7 (1986)
+template<typename eT, typename op_type, typename precond_type>
+inline
+uword
+sp_krylov::gmres(Col<eT>& x, const op_type& A, const Col<eT>& b, const precond_type& M, const typename get_pod_type<eT>::result tol_abs, const uword max_iter, const uword restart)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  const uword N = b.n_elem;
+  const uword m = restart;
+  
+  Mat<eT> V(N, m+1);
+  Mat<eT> H(m+1, m);
+  
+  Col<T>  cs(m);
+  Col<eT> sn(m);
+  Col<eT> g (m+1);
+  Col<eT> y (m);
+  
+  Col<eT> r(N);
+  Col<eT> w(N);
+  Col<eT> z(N);
+  
+  uword iter = 0;
+  
+  while(iter < max_iter)
+    {
+    A.apply(w, x);
+    
+    r = b - w;
+    
+    const T beta = norm(r, 2);
+    
+    if(beta <= tol_abs)  { break; }
+    
+    V.col(0) = r * eT(T(1) / beta);
+    
+    g.zeros();
+    g[0] = eT(beta);
+    
+    uword k    = 0;
+    bool  done = false;
+    
+    for(uword j=0; (j < m) && (iter < max_iter); ++j)
+      {
+      const Col<eT> vj(V.colptr(j), N, false, true);
+      
+      M.apply(z, vj);
+      A.apply(w, z);
+      
+      // classical Gram-Schmidt, reorthogonalised when cancellation is detected
+      // (Daniel, Gragg, Kaufman and Stewart, Math. Comp. 30, 1976)
+      
+      const Mat<eT> Vj(V.memptr(), N, j+1, false, true);
+      
+      const T w_norm = norm(w, 2);
+      
+      Col<eT> h = trans(Vj) * w;
+      
+      w -= Vj * h;
+      
+      T h_next = norm(w, 2);
+      
+      if(h_next < T(0.7071) * w_norm)
+        {
+        const Col<eT> h2 = trans(Vj) * w;
+        
+        w -= Vj * h2;
+        h += h2;
+        
+        h_next = norm(w, 2);
+        }
+      
+      arrayops::copy(H.colptr(j), h.memptr(), j+1);
+      
+      if(h_next > T(0))
+        {
+        Col<eT> v_next(V.colptr(j+1), N, false, true);
+        
+        v_next = w * eT(T(1) / h_next);
+        }
+      
+      // apply the previous Givens rotations to the new column of H
+      
+      for(uword i=0; i < j; ++i)
+        {
+        const eT h_i   = H.at(i,  j);
+        const eT h_ip1 = H.at(i+1,j);
+        
+        H.at(i,  j) = cs[i] * h_i + sn[i] * h_ip1;
+        H.at(i+1,j) = cs[i] * h_ip1 - access::alt_conj(sn[i]) * h_i;
+        }
+      
+      // new rotation to eliminate h_next
+      
+      const eT h_jj  = H.at(j,j);
+      const T  abs_a = std::abs(h_jj);
+      const T  rr    = std::sqrt(abs_a*abs_a + h_next*h_next);
+      
+      if(rr == T(0))  { done = true; break; }
+      
+      if(abs_a == T(0))
+        {
+        cs[j] = T(0);
+        sn[j] = eT(1);
+        
+        H.at(j,j) = eT(h_next);
+        }
+      else
+        {
+        const eT phase = h_jj / abs_a;
+        
+        cs[j] = abs_a / rr;
+        sn[j] = phase * (h_next / rr);
+        
+        H.at(j,j) = phase * rr;
+        }
+      
+      g[j+1] = -access::alt_conj(sn[j]) * g[j];
+      g[j]   = cs[j] * g[j];
+      
+      ++iter;
+      
+      k = j+1;
+      
+      if( (std::abs(g[j+1]) <= tol_abs) || (h_next == T(0)) )  { done = true; break; }
+      }
+    
+    if(k == 0)  { break; }
+    
+    // solve the upper triangular system H(0:k-1,0:k-1) * y = g(0:k-1)
+    
+    for(uword ii=k; ii-- > 0;)
+      {
+      eT acc = g[ii];
+      
+      for(uword jj=ii+1; jj < k; ++jj)  { acc -= H.at(ii,jj) * y[jj]; }
+      
+      y[ii] = acc / H.at(ii,ii);
+      }
+    
+    w = V.head_cols(k) * y.head(k);
+    
+    M.apply(z, w);
+    
+    x += z;
+    
+    if(done)  { break; }
+    }
+  
+  return iter;
+  }
+
+
+
+//! @}
@@ -0,0 +1,104 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_linop
+//! @{
+
+
+//! Kronecker product kron(A,B) of two sparse matrices, held as its factors.
+//! Products with vectors use (A kron B)*vec(X) = vec(B*X*A.st()), so the product itself is never formed.
+template<typename eT>
+class sp_kron_op
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  const uword n_rows;
+  const uword n_cols;
+  
+  template<typename T1, typename T2>
+  inline sp_kron_op(const SpBase<eT,T1>& in_A, const SpBase<eT,T2>& in_B);
+  
+  inline sp_kron_op<eT>  t() const;
+  inline sp_kron_op<eT> st() const;
+  
+  inline void apply(Col<eT>& y, const Col<eT>& x) const;
+  
+  template<typename T1>
+  inline Mat<eT> operator*(const Base<eT,T1>& X) const;
+  
+  
+  private:
+  
+  SpMat<eT> A;
+  SpMat<eT> At;         // A.st(): its columns are the rows of A
+  SpMat<eT> B;
+  
+  inline void mul_B_col (eT* Z_col, const eT* X_col) const;
+  inline void mul_At_col(eT* Y_col, const Mat<eT>& Z, const uword i) const;
+  };
+
+
+
+//! Block diagonal matrix of sparse blocks, held as the individual blocks
+template<typename eT>
+class sp_blockdiag_op
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  const uword n_rows;
+  const uword n_cols;
+  
+  inline explicit sp_blockdiag_op(const field< SpMat<eT> >& in_blocks);
+  
+  inline sp_blockdiag_op<eT>  t() const;
+  inline sp_blockdiag_op<eT> st() const;
+  
+  inline uword n_blocks() const;
+  
+  inline void apply(Col<eT>& y, const Col<eT>& x) const;
+  
+  template<typename T1>
+  inline Mat<eT> operator*(const Base<eT,T1>& X) const;
+  
+  
+  private:
+  
+  field< SpMat<eT> > blocks;
+  
+  uvec row_offsets;     // first row of each block, followed by n_rows
+  uvec col_offsets;     // first column of each block, followed by n_cols
+  
+  inline static uword total_rows(const field< SpMat<eT> >& in_blocks);
+  inline static uword total_cols(const field< SpMat<eT> >& in_blocks);
+  
+  inline void apply_block(eT* y_mem, const eT* x_mem, const uword b) const;
+  };
+
+
+
+template<typename T> struct is_sp_linop                        { static const bool value = false; };
+template<typename eT> struct is_sp_linop< sp_kron_op<eT>      > { static const bool value = true;  };
+template<typename eT> struct is_sp_linop< sp_blockdiag_op<eT> > { static const bool value = true;  };
+
+
+
+//! @}
@@ -0,0 +1,386 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_linop
+//! @{
+
+
+
+template<typename eT>
+template<typename T1, typename T2>
+inline
+sp_kron_op<eT>::sp_kron_op(const SpBase<eT,T1>& in_A, const SpBase<eT,T2>& in_B)
+  : n_rows(0)
+  , n_cols(0)
+  , A(in_A.get_ref())
+  , B(in_B.get_ref())
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  access::rw(n_rows) = A.n_rows * B.n_rows;
+  access::rw(n_cols) = A.n_cols * B.n_cols;
+  
+  spop_strans::apply_spmat(At, A);
+  }
+
+
+
+template<typename eT>
+inline
+sp_kron_op<eT>
+sp_kron_op<eT>::t() const
+  {
+  arma_extra_debug_sigprint();
+  
+  // kron(A,B)' = kron(A',B')
+  return sp_kron_op<eT>(A.t(), B.t());
+  }
+
+
+
+template<typename eT>
+inline
+sp_kron_op<eT>
+sp_kron_op<eT>::st() const
+  {
+  arma_extra_debug_sigprint();
+  
+  return sp_kron_op<eT>(At, B.st());
+  }
+
+
+
+//! y = kron(A,B)*x, computed as vec(B*X*A.st()) with X = reshape(x, B.n_cols, A.n_cols)
+template<typename eT>
+inline
+void
+sp_kron_op<eT>::apply(Col<eT>& y, const Col<eT>& x) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (x.n_elem != n_cols), "sp_kron_op::apply(): incompatible size" );
+  
+  y.zeros(n_rows);
+  
+  const uword p = B.n_rows;
+  const uword q = B.n_cols;
+  const uword m = A.n_rows;
+  const uword n = A.n_cols;
+  
+  if( (n_rows == 0) || (n_cols == 0) )  { return; }
+  
+  // Z = B*X, one column of X at a time;
+  // Y = Z*A.st(), where column i of Y combines the columns of Z selected by row i of A, ie. by column i of A.st()
+  
+  Mat<eT> Z(p, n, fill::zeros);
+  
+  const eT* x_mem = x.memptr();
+        eT* y_mem = y.memptr();
+  
+  const bool use_mp = arma_config::openmp && mp_gate<eT>::eval( (std::max)(n_rows, n_cols) );
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword j=0; j < n; ++j)  { mul_B_col(Z.colptr(j), &x_mem[j*q]); }
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword i=0; i < m; ++i)  { mul_At_col(&y_mem[i*p], Z, i); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword j=0; j < n; ++j)  { mul_B_col(Z.colptr(j), &x_mem[j*q]); }
+    for(uword i=0; i < m; ++i)  { mul_At_col(&y_mem[i*p], Z, i); }
+    }
+  }
+
+
+
+//! Z_col += B*X_col
+template<typename eT>
+inline
+void
+sp_kron_op<eT>::mul_B_col(eT* Z_col, const eT* X_col) const
+  {
+  const uword* B_col_ptrs    = B.col_ptrs;
+  const uword* B_row_indices = B.row_indices;
+  const eT*    B_values      = B.values;
+  
+  for(uword k=0; k < B.n_cols; ++k)
+    {
+    const eT val = X_col[k];
+    
+    if(val == eT(0))  { continue; }
+    
+    for(uword i = B_col_ptrs[k]; i < B_col_ptrs[k+1]; ++i)  { Z_col[ B_row_indices[i] ] += B_values[i] * val; }
+    }
+  }
+
+
+
+//! Y_col += Z * (column i of A.st())
+template<typename eT>
+inline
+void
+sp_kron_op<eT>::mul_At_col(eT* Y_col, const Mat<eT>& Z, const uword i) const
+  {
+  const uword p = Z.n_rows;
+  
+  for(uword k = At.col_ptrs[i]; k < At.col_ptrs[i+1]; ++k)
+    {
+    const eT  val   = At.values[k];
+    const eT* Z_col = Z.colptr( At.row_indices[k] );
+    
+    for(uword r=0; r < p; ++r)  { Y_col[r] += val * Z_col[r]; }
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+sp_kron_op<eT>::operator*(const Base<eT,T1>& X_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X_expr.get_ref());
+  
+  const Mat<eT>& X = U.M;
+  
+  arma_debug_assert_mul_size(n_rows, n_cols, X.n_rows, X.n_cols, "matrix multiplication");
+  
+  Mat<eT> out(n_rows, X.n_cols);
+  
+  Col<eT> y;
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    const Col<eT> x(const_cast<eT*>(X.colptr(col)), X.n_rows, false, true);
+    
+    apply(y, x);
+    
+    arrayops::copy(out.colptr(col), y.memptr(), n_rows);
+    }
+  
+  return out;
+  }
+
+
+
+//
+// sp_blockdiag_op
+
+
+
+template<typename eT>
+inline
+sp_blockdiag_op<eT>::sp_blockdiag_op(const field< SpMat<eT> >& in_blocks)
+  : n_rows(total_rows(in_blocks))
+  , n_cols(total_cols(in_blocks))
+  , blocks(in_blocks)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const uword N = blocks.n_elem;
+  
+  row_offsets.set_size(N+1);
+  col_offsets.set_size(N+1);
+  
+  row_offsets[0] = 0;
+  col_offsets[0] = 0;
+  
+  for(uword b=0; b < N; ++b)
+    {
+    row_offsets[b+1] = row_offsets[b] + blocks[b].n_rows;
+    col_offsets[b+1] = col_offsets[b] + blocks[b].n_cols;
+    
+    blocks[b].sync();
+    }
+  }
+
+
+
+template<typename eT>
+inline
+uword
+sp_blockdiag_op<eT>::total_rows(const field< SpMat<eT> >& in_blocks)
+  {
+  uword count = 0;
+  
+  for(uword b=0; b < in_blocks.n_elem; ++b)  { count += in_blocks[b].n_rows; }
+  
+  return count;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+sp_blockdiag_op<eT>::total_cols(const field< SpMat<eT> >& in_blocks)
+  {
+  uword count = 0;
+  
+  for(uword b=0; b < in_blocks.n_elem; ++b)  { count += in_blocks[b].n_cols; }
+  
+  return count;
+  }
+
+
+
+template<typename eT>
+inline
+sp_blockdiag_op<eT>
+sp_blockdiag_op<eT>::t() const
+  {
+  arma_extra_debug_sigprint();
+  
+  field< SpMat<eT> > tmp(blocks.n_elem);
+  
+  for(uword b=0; b < blocks.n_elem; ++b)  { tmp[b] = blocks[b].t(); }
+  
+  return sp_blockdiag_op<eT>(tmp);
+  }
+
+
+
+template<typename eT>
+inline
+sp_blockdiag_op<eT>
+sp_blockdiag_op<eT>::st() const
+  {
+  arma_extra_debug_sigprint();
+  
+  field< SpMat<eT> > tmp(blocks.n_elem);
+  
+  for(uword b=0; b < blocks.n_elem; ++b)  { tmp[b] = blocks[b].st(); }
+  
+  return sp_blockdiag_op<eT>(tmp);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+sp_blockdiag_op<eT>::n_blocks() const
+  {
+  return blocks.n_elem;
+  }
+
+
+
+//! y = blockdiag*x; the blocks write to separate parts of y, so they are processed in parallel
+template<typename eT>
+inline
+void
+sp_blockdiag_op<eT>::apply(Col<eT>& y, const Col<eT>& x) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( (x.n_elem != n_cols), "sp_blockdiag_op::apply(): incompatible size" );
+  
+  y.zeros(n_rows);
+  
+  const uword N = blocks.n_elem;
+  
+  const eT* x_mem = x.memptr();
+        eT* y_mem = y.memptr();
+  
+  const bool use_mp = arma_config::openmp && mp_gate<eT>::eval( (std::max)(n_rows, n_cols) ) && (N >= 2);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword b=0; b < N; ++b)  { apply_block(y_mem, x_mem, b); }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword b=0; b < N; ++b)  { apply_block(y_mem, x_mem, b); }
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_blockdiag_op<eT>::apply_block(eT* y_mem, const eT* x_mem, const uword b) const
+  {
+  const SpMat<eT>& X = blocks[b];
+  
+  const eT* x_block = &x_mem[ col_offsets[b] ];
+        eT* y_block = &y_mem[ row_offsets[b] ];
+  
+  for(uword c=0; c < X.n_cols; ++c)
+    {
+    const eT val = x_block[c];
+    
+    if(val == eT(0))  { continue; }
+    
+    for(uword i = X.col_ptrs[c]; i < X.col_ptrs[c+1]; ++i)  { y_block[ X.row_indices[i] ] += X.values[i] * val; }
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+sp_blockdiag_op<eT>::operator*(const Base<eT,T1>& X_expr) const
+  {
+  arma_extra_debug_sigprint();
+  
+  const quasi_unwrap<T1> U(X_expr.get_ref());
+  
+  const Mat<eT>& X = U.M;
+  
+  arma_debug_assert_mul_size(n_rows, n_cols, X.n_rows, X.n_cols, "matrix multiplication");
+  
+  Mat<eT> out(n_rows, X.n_cols);
+  
+  Col<eT> y;
+  
+  for(uword col=0; col < X.n_cols; ++col)
+    {
+    const Col<eT> x(const_cast<eT*>(X.colptr(col)), X.n_rows, false, true);
+    
+    apply(y, x);
+    
+    arrayops::copy(out.colptr(col), y.memptr(), n_rows);
+    }
+  
+  return out;
+  }
+
+
+
+//! @}
@@ -0,0 +1,271 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_merge_helper
+//! @{
+
+
+//! element-wise operations on two sparse matrices stored in CSC form,
+//! via a merge of each pair of columns
+namespace sp_merge_helper
+{
+
+
+
+template<typename eT>
+struct merge_plus
+  {
+  static const bool is_union = true;
+  
+  arma_inline static eT   both(const eT a, const eT b) { return a + b; }
+  arma_inline static eT only_a(const eT a)             { return a;     }
+  arma_inline static eT only_b(const eT b)             { return b;     }
+  };
+
+
+
+template<typename eT>
+struct merge_minus
+  {
+  static const bool is_union = true;
+  
+  arma_inline static eT   both(const eT a, const eT b) { return a - b; }
+  arma_inline static eT only_a(const eT a)             { return  a;    }
+  arma_inline static eT only_b(const eT b)             { return -b;    }
+  };
+
+
+
+//! only locations present in both matrices can give a non-zero product
+template<typename eT>
+struct merge_schur
+  {
+  static const bool is_union = false;
+  
+  arma_inline static eT   both(const eT a, const eT b) { return a * b; }
+  arma_inline static eT only_a(const eT)               { return eT(0); }
+  arma_inline static eT only_b(const eT)               { return eT(0); }
+  };
+
+
+
+//! merge elements [ia,ia_end) of A with elements [ib,ib_end) of B, which belong to the same column.
+//! returns the number of non-zero results; they are written to out_rows and out_vals when out_rows is not NULL.
+template<typename merge_op, typename eT>
+arma_hot
+inline
+uword
+merge_col
+  (
+  const uword* A_rows, const eT* A_vals, uword ia, const uword ia_end,
+  const uword* B_rows, const eT* B_vals, uword ib, const uword ib_end,
+  uword* out_rows, eT* out_vals
+  )
+  {
+  uword count = 0;
+  
+  while( (ia < ia_end) && (ib < ib_end) )
+    {
+    const uword row_a = A_rows[ia];
+    const uword row_b = B_rows[ib];
+    
+    uword row;
+    eT    val;
+    
+    if(row_a == row_b)
+      {
+      row = row_a;
+      val = merge_op::both(A_vals[ia], B_vals[ib]);
+      ++ia;
+      ++ib;
+      }
+    else
+    if(row_a < row_b)
+      {
+      row = row_a;
+      val = merge_op::only_a(A_vals[ia]);
+      ++ia;
+      }
+    else
+      {
+      row = row_b;
+      val = merge_op::only_b(B_vals[ib]);
+      ++ib;
+      }
+    
+    if(val != eT(0))
+      {
+      if(out_rows != NULL)  { out_rows[count] = row;  out_vals[count] = val; }
+      
+      ++count;
+      }
+    }
+  
+  if(merge_op::is_union)
+    {
+    for(; ia < ia_end; ++ia)
+      {
+      const eT val = merge_op::only_a(A_vals[ia]);
+      
+      if(val != eT(0))
+        {
+        if(out_rows != NULL)  { out_rows[count] = A_rows[ia];  out_vals[count] = val; }
+        
+        ++count;
+        }
+      }
+    
+    for(; ib < ib_end; ++ib)
+      {
+      const eT val = merge_op::only_b(B_vals[ib]);
+      
+      if(val != eT(0))
+        {
+        if(out_rows != NULL)  { out_rows[count] = B_rows[ib];  out_vals[count] = val; }
+        
+        ++count;
+        }
+      }
+    }
+  
+  return count;
+  }
+
+
+
+//! out = op(A,B), where the proxies provide direct access to the CSC arrays (ie. use_iterator is false).
+//! a symbolic pass counts the non-zero results of each column, and a numeric pass writes them.
+//! with OpenMP, both passes are split into column ranges holding roughly equal numbers of elements.
+template<typename merge_op, typename T1, typename T2>
+arma_hot
+inline
+void
+apply(SpMat<typename T1::elem_type>& out, const SpProxy<T1>& pa, const SpProxy<T2>& pb)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword n_rows = pa.get_n_rows();
+  const uword n_cols = pa.get_n_cols();
+  
+  out.zeros(n_rows, n_cols);
+  
+  const uword* A_col_ptrs = pa.get_col_ptrs();
+  const uword* A_rows     = pa.get_row_indices();
+  const eT*    A_vals     = pa.get_values();
+  
+  const uword* B_col_ptrs = pb.get_col_ptrs();
+  const uword* B_rows     = pb.get_row_indices();
+  const eT*    B_vals     = pb.get_values();
+  
+  uword* out_col_ptrs = access::rwp(out.col_ptrs);
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword N = pa.get_n_nonzero() + pb.get_n_nonzero();
+    
+    const int n_threads = mp_thread_limit::get();
+    
+    if( mp_gate<eT>::eval(N) && (n_threads >= 2) && (n_cols >= uword(n_threads)) )
+      {
+      const uword n_parts = uword(n_threads);
+      
+      // boundary t is the first column at which at least t*N/n_parts elements of A and B precede it
+      podarray<uword> bounds(n_parts + 1);
+      
+      uword* bounds_mem = bounds.memptr();
+      
+      bounds_mem[0]       = 0;
+      bounds_mem[n_parts] = n_cols;
+      
+      for(uword t=1; t < n_parts; ++t)
+        {
+        const uword target = (N / n_parts) * t;
+        
+        uword lo = bounds_mem[t-1];
+        uword hi = n_cols;
+        
+        while(lo < hi)
+          {
+          const uword mid = lo + (hi - lo) / 2;
+          
+          if( (A_col_ptrs[mid] + B_col_ptrs[mid]) < target )  { lo = mid + 1; }  else  { hi = mid; }
+          }
+        
+        bounds_mem[t] = lo;
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword t=0; t < n_parts; ++t)
+        {
+        const uword c_end = bounds_mem[t+1];
+        
+        for(uword c = bounds_mem[t]; c < c_end; ++c)
+          {
+          out_col_ptrs[c + 1] = merge_col<merge_op>( A_rows, A_vals, A_col_ptrs[c], A_col_ptrs[c+1], B_rows, B_vals, B_col_ptrs[c], B_col_ptrs[c+1], (uword*)NULL, (eT*)NULL );
+          }
+        }
+      
+      for(uword c=0; c < n_cols; ++c)  { out_col_ptrs[c + 1] += out_col_ptrs[c]; }
+      
+      out.mem_resize(out_col_ptrs[n_cols]);
+      
+      uword* out_rows = access::rwp(out.row_indices);
+      eT*    out_vals = access::rwp(out.values);
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword t=0; t < n_parts; ++t)
+        {
+        const uword c_end = bounds_mem[t+1];
+        
+        for(uword c = bounds_mem[t]; c < c_end; ++c)
+          {
+          const uword pos = out_col_ptrs[c];
+          
+          merge_col<merge_op>( A_rows, A_vals, A_col_ptrs[c], A_col_ptrs[c+1], B_rows, B_vals, B_col_ptrs[c], B_col_ptrs[c+1], &out_rows[pos], &out_vals[pos] );
+          }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword c=0; c < n_cols; ++c)
+    {
+    out_col_ptrs[c + 1] = out_col_ptrs[c] + merge_col<merge_op>( A_rows, A_vals, A_col_ptrs[c], A_col_ptrs[c+1], B_rows, B_vals, B_col_ptrs[c], B_col_ptrs[c+1], (uword*)NULL, (eT*)NULL );
+    }
+  
+  out.mem_resize(out_col_ptrs[n_cols]);
+  
+  uword* out_rows = access::rwp(out.row_indices);
+  eT*    out_vals = access::rwp(out.values);
+  
+  for(uword c=0; c < n_cols; ++c)
+    {
+    const uword pos = out_col_ptrs[c];
+    
+    merge_col<merge_op>( A_rows, A_vals, A_col_ptrs[c], A_col_ptrs[c+1], B_rows, B_vals, B_col_ptrs[c], B_col_ptrs[c+1], &out_rows[pos], &out_vals[pos] );
+    }
+  }
+
+
+
+}  // namespace sp_merge_helper
+
+
+//! @}
@@ -0,0 +1,57 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_mmap
+//! @{
+
+
+
+//! read-only access to a sparse matrix saved in csc_binary format, without copying the row indices and values;
+//! the file is memory mapped where supported, and otherwise read into memory
+template<typename eT>
+class sp_mmap
+  {
+  public:
+  
+  typedef eT                                elem_type;
+  typedef typename get_pod_type<eT>::result pod_type;
+  
+  inline ~sp_mmap();
+  inline  sp_mmap();
+  inline explicit sp_mmap(const std::string& name);
+  
+  inline bool open(const std::string& name, const bool print_status = true);
+  inline void close();
+  
+  inline bool is_open() const;
+  
+  inline const SpMat<eT>& get_ref() const;
+  
+  
+  private:
+  
+  SpMat<eT>* M;          //!< uses the mapped memory for its row indices and values
+  void*      map_ptr;
+  uword      map_size;
+  bool       valid;
+  
+  inline      sp_mmap(const sp_mmap&);   //!< not allowed
+  inline void operator=(const sp_mmap&);   //!< not allowed
+  };
+
+
+
+//! @}
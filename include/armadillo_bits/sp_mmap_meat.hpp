@@ -0,0 +1,217 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_mmap
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_mmap<eT>::~sp_mmap()
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  close();
+  
+  delete M;
+  }
+
+
+
+template<typename eT>
+inline
+sp_mmap<eT>::sp_mmap()
+  : M       (new SpMat<eT>())
+  , map_ptr (NULL)
+  , map_size(0)
+  , valid   (false)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+inline
+sp_mmap<eT>::sp_mmap(const std::string& name)
+  : M       (new SpMat<eT>())
+  , map_ptr (NULL)
+  , map_size(0)
+  , valid   (false)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = open(name, false);
+  
+  if(status == false)  { arma_stop_runtime_error("sp_mmap::sp_mmap(): couldn't map " + name); }
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_mmap<eT>::open(const std::string& name, const bool print_status)
+  {
+  arma_extra_debug_sigprint();
+  
+  close();
+  
+  bool        status = false;
+  std::string err_msg;
+  
+  #if defined(ARMA_HAVE_MMAP)
+    {
+    const int fd = ::open(name.c_str(), O_RDONLY);
+    
+    struct stat file_info;
+    
+    if( (fd >= 0) && (::fstat(fd, &file_info) == 0) && (file_info.st_size >= 128) )
+      {
+      const uword f_size = uword(file_info.st_size);
+      
+      // a private mapping, so that the SpMat constructor can be given non-const pointers
+      void* ptr = ::mmap(NULL, size_t(f_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+      
+      if(ptr != MAP_FAILED)
+        {
+        map_ptr  = ptr;
+        map_size = f_size;
+        
+        const char* mem = static_cast<const char*>(ptr);
+        
+        uword f_n_rows = 0;
+        uword f_n_cols = 0;
+        uword f_n_nz   = 0;
+        
+        if(diskio::parse_csc_header(mem, *M, f_n_rows, f_n_cols, f_n_nz))
+          {
+          // the same checks as diskio::load_csc_binary();
+          // the arrays are only accessed once the sizes in the header are known to fit within the mapping
+          
+          bool data_okay = diskio::check_csc_size(f_n_cols, f_n_nz, uword(sizeof(eT)), f_size);
+          
+          if(data_okay)
+            {
+            uword col_ptrs_offset    = 0;
+            uword row_indices_offset = 0;
+            uword values_offset      = 0;
+            uword file_size          = 0;
+            
+            diskio::csc_offsets(f_n_cols, f_n_nz, uword(sizeof(eT)), col_ptrs_offset, row_indices_offset, values_offset, file_size);
+            
+            const uword* col_ptrs    = reinterpret_cast<const uword*>(mem + col_ptrs_offset   );
+                  uword* row_indices = reinterpret_cast<      uword*>(static_cast<char*>(ptr) + row_indices_offset);
+                  eT*    values      = reinterpret_cast<      eT*   >(static_cast<char*>(ptr) + values_offset     );
+            
+            data_okay = diskio::check_csc(f_n_rows, f_n_cols, f_n_nz, col_ptrs, row_indices, values);
+            
+            if(data_okay)
+              {
+              delete M;
+              
+              M = new SpMat<eT>(row_indices, col_ptrs, values, f_n_rows, f_n_cols, false);
+              
+              status = true;
+              }
+            }
+          
+          if(data_okay == false)  { err_msg = "inconsistent data in "; }
+          }
+        else
+          {
+          err_msg = "incorrect header in ";
+          }
+        }
+      }
+    
+    if(fd >= 0)  { ::close(fd); }
+    }
+  #else
+    {
+    status = diskio::load_csc_binary(*M, name, err_msg);
+    }
+  #endif
+  
+  valid = status;
+  
+  if(status == false)
+    {
+    if(print_status)
+      {
+      if(err_msg.length() > 0)
+        {
+        arma_debug_warn("sp_mmap::open(): ", err_msg, name);
+        }
+      else
+        {
+        arma_debug_warn("sp_mmap::open(): couldn't map ", name);
+        }
+      }
+    
+    close();
+    }
+  
+  return status;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_mmap<eT>::close()
+  {
+  arma_extra_debug_sigprint();
+  
+  // the matrix must not refer to the mapped memory after it is unmapped
+  (*M).reset();
+  
+  #if defined(ARMA_HAVE_MMAP)
+    {
+    if(map_ptr != NULL)  { ::munmap(map_ptr, size_t(map_size)); }
+    }
+  #endif
+  
+  map_ptr  = NULL;
+  map_size = 0;
+  valid    = false;
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_mmap<eT>::is_open() const
+  {
+  return valid;
+  }
+
+
+
+template<typename eT>
+inline
+const SpMat<eT>&
+sp_mmap<eT>::get_ref() const
+  {
+  return (*M);
+  }
+
+
+
+//! @}
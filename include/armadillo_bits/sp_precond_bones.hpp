@@ -0,0 +1,106 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_precond
+//! @{
+
+
+template<typename eT>
+struct sp_precond_abs_greater
+  {
+  const eT* w;
+  
+  inline sp_precond_abs_greater(const eT* in_w) : w(in_w) {}
+  
+  arma_inline bool operator()(const uword a, const uword b) const { return (std::abs(w[a]) > std::abs(w[b])); }
+  };
+
+
+
+struct sp_precond_min_heap
+  {
+  arma_inline bool operator()(const uword a, const uword b) const { return (a > b); }
+  };
+
+
+
+//! Preconditioner for the iterative solvers in spsolve().
+//! The factorisation is done once and can then be applied to any number of vectors.
+//! Supported methods: "jacobi", "ilu0", "ilut" and "ic0".
+template<typename eT>
+class sp_precond
+  {
+  public:
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  inline sp_precond();
+  
+  template<typename T1>
+  inline explicit sp_precond(const SpBase<eT,T1>& A, const char* method = "ilu0", const double drop_tol = 1e-4, const uword max_fill = 10);
+  
+  template<typename T1>
+  inline bool factorise(const SpBase<eT,T1>& A, const char* method = "ilu0", const double drop_tol = 1e-4, const uword max_fill = 10);
+  
+  inline void reset();
+  
+  inline bool  is_empty()  const;
+  inline uword n_rows()    const;
+  inline uword n_nonzero() const;
+  
+  inline void apply(Col<eT>& z, const Col<eT>& r) const;
+  
+  template<typename T1>
+  inline Mat<eT> apply(const Base<eT,T1>& R) const;
+  
+  
+  private:
+  
+  enum method_type { method_none, method_jacobi, method_ilu, method_ic };
+  
+  method_type method;
+  
+  uword N;
+  
+  Col<eT> inv_diag;     // Jacobi
+  
+  // factors in compressed sparse row format;
+  // ILU: strictly lower part of unit lower triangular L, followed by the diagonal and strictly upper part of U;
+  // IC:  lower triangular L, with the diagonal at the end of each row
+  
+  uvec    row_ptrs;
+  uvec    col_indices;
+  Col<eT> values;
+  uvec    diag_pos;
+  
+  inline bool init_jacobi(const SpMat<eT>& A);
+  inline bool init_ilu0  (const SpMat<eT>& A);
+  inline bool init_ilut  (const SpMat<eT>& A, const T drop_tol, const uword max_fill);
+  inline bool init_ic0   (const SpMat<eT>& A);
+  
+  inline void keep_largest(std::vector<uword>& indices, const eT* w, const uword n_keep) const;
+  
+  inline void get_rows(SpMat<eT>& R, const SpMat<eT>& A) const;
+  
+  inline void apply_inplace(eT* z_mem) const;
+  
+  inline void solve_ilu(eT* z_mem) const;
+  inline void solve_ic (eT* z_mem) const;
+  };
+
+
+
+//! @}
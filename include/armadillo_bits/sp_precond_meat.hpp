@@ -0,0 +1,726 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_precond
+//! @{
+
+
+
+template<typename eT>
+inline
+sp_precond<eT>::sp_precond()
+  : method(method_none)
+  , N     (0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+sp_precond<eT>::sp_precond(const SpBase<eT,T1>& A, const char* in_method, const double drop_tol, const uword max_fill)
+  : method(method_none)
+  , N     (0)
+  {
+  arma_extra_debug_sigprint_this(this);
+  
+  const bool status = factorise(A, in_method, drop_tol, max_fill);
+  
+  if(status == false)
+    {
+    arma_stop_runtime_error("sp_precond(): factorisation failed");
+    }
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+bool
+sp_precond<eT>::factorise(const SpBase<eT,T1>& A, const char* in_method, const double drop_tol, const uword max_fill)
+  {
+  arma_extra_debug_sigprint();
+  
+  reset();
+  
+  const char sig1 = (in_method != NULL) ? in_method[0] : char(0);
+  const char sig2 = (sig1      != 0   ) ? in_method[1] : char(0);
+  const char sig3 = (sig2      != 0   ) ? in_method[2] : char(0);
+  const char sig4 = (sig3      != 0   ) ? in_method[3] : char(0);
+  
+  const bool is_jacobi = (sig1 == 'j');
+  const bool is_ic0    = (sig1 == 'i') && (sig2 == 'c');
+  const bool is_ilu0   = (sig1 == 'i') && (sig2 == 'l') && (sig4 == '0');
+  const bool is_ilut   = (sig1 == 'i') && (sig2 == 'l') && (sig4 == 't');
+  
+  if( (is_jacobi == false) && (is_ic0 == false) && (is_ilu0 == false) && (is_ilut == false) )
+    {
+    arma_stop_logic_error("sp_precond::factorise(): unknown method");
+    return false;
+    }
+  
+  arma_debug_check( (drop_tol < double(0)), "sp_precond::factorise(): drop_tol must be non-negative" );
+  
+  const unwrap_spmat<T1> U(A.get_ref());
+  
+  const SpMat<eT>& X = U.M;
+  
+  arma_debug_check( (X.n_rows != X.n_cols), "sp_precond::factorise(): given matrix must be square sized" );
+  
+  N = X.n_rows;
+  
+  bool status = false;
+  
+  if(is_jacobi)  { status = init_jacobi(X);                        }
+  if(is_ilu0  )  { status = init_ilu0  (X);                        }
+  if(is_ilut  )  { status = init_ilut  (X, T(drop_tol), max_fill); }
+  if(is_ic0   )  { status = init_ic0   (X);                        }
+  
+  if(status == false)  { reset(); return false; }
+  
+  method = (is_jacobi) ? method_jacobi : ( (is_ic0) ? method_ic : method_ilu );
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::reset()
+  {
+  arma_extra_debug_sigprint();
+  
+  method = method_none;
+  N      = 0;
+  
+  inv_diag.reset();
+  row_ptrs.reset();
+  col_indices.reset();
+  values.reset();
+  diag_pos.reset();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_precond<eT>::is_empty() const
+  {
+  return (method == method_none);
+  }
+
+
+
+template<typename eT>
+inline
+uword
+sp_precond<eT>::n_rows() const
+  {
+  return N;
+  }
+
+
+
+template<typename eT>
+inline
+uword
+sp_precond<eT>::n_nonzero() const
+  {
+  if(method == method_jacobi)  { return inv_diag.n_elem; }
+  
+  return values.n_elem;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::apply(Col<eT>& z, const Col<eT>& r) const
+  {
+  arma_extra_debug_sigprint();
+  
+  arma_debug_check( ((method != method_none) && (r.n_elem != N)), "sp_precond::apply(): size mismatch" );
+  
+  z = r;
+  
+  apply_inplace(z.memptr());
+  }
+
+
+
+template<typename eT>
+template<typename T1>
+inline
+Mat<eT>
+sp_precond<eT>::apply(const Base<eT,T1>& R) const
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> out(R.get_ref());
+  
+  arma_debug_check( ((method != method_none) && (out.n_rows != N)), "sp_precond::apply(): size mismatch" );
+  
+  for(uword col=0; col < out.n_cols; ++col)  { apply_inplace(out.colptr(col)); }
+  
+  return out;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::apply_inplace(eT* z_mem) const
+  {
+  switch(method)
+    {
+    case method_jacobi:
+      {
+      const eT* inv_diag_mem = inv_diag.memptr();
+      
+      for(uword i=0; i < N; ++i)  { z_mem[i] *= inv_diag_mem[i]; }
+      }
+      break;
+    
+    case method_ilu:  solve_ilu(z_mem);  break;
+    case method_ic:   solve_ic (z_mem);  break;
+    
+    default:
+      ;
+    }
+  }
+
+
+
+//! copy of A in which column i holds row i of A, ie. A in compressed sparse row format
+template<typename eT>
+inline
+void
+sp_precond<eT>::get_rows(SpMat<eT>& R, const SpMat<eT>& A) const
+  {
+  arma_extra_debug_sigprint();
+  
+  A.sync();
+  
+  spop_strans::apply_spmat(R, A);
+  
+  R.sync();
+  }
+
+
+
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init_jacobi(const SpMat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  inv_diag = A.diag();
+  
+  eT* inv_diag_mem = inv_diag.memptr();
+  
+  for(uword i=0; i < N; ++i)
+    {
+    if(inv_diag_mem[i] == eT(0))  { return false; }
+    
+    inv_diag_mem[i] = eT(1) / inv_diag_mem[i];
+    }
+  
+  return true;
+  }
+
+
+
+//! ILU(0): incomplete LU factorisation with the sparsity pattern of A (IKJ variant);
+//! Y. Saad, Iterative Methods for Sparse Linear Systems, 2nd ed., Algorithm 10.4
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init_ilu0(const SpMat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  SpMat<eT> R;
+  
+  get_rows(R, A);
+  
+  row_ptrs    = uvec(R.col_ptrs,    N+1        );
+  col_indices = uvec(R.row_indices, R.n_nonzero);
+  values      = Col<eT>(R.values,   R.n_nonzero);
+  
+  diag_pos.set_size(N);
+  
+  const uword* row_ptrs_mem    = row_ptrs.memptr();
+  const uword* col_indices_mem = col_indices.memptr();
+        eT*    values_mem      = values.memptr();
+        uword* diag_pos_mem    = diag_pos.memptr();
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword* start  = col_indices_mem + row_ptrs_mem[i  ];
+    const uword* end_p1 = col_indices_mem + row_ptrs_mem[i+1];
+    
+    const uword* loc = std::lower_bound(start, end_p1, i);
+    
+    if( (loc == end_p1) || ((*loc) != i) )  { return false; }  // structurally zero pivot
+    
+    diag_pos_mem[i] = uword(loc - col_indices_mem);
+    }
+  
+  // pos[j] is the location of element (i,j) in the current row i, or 'none' if there is no such element;
+  // locations are in [0, n_nonzero), which can exceed N, so N itself can't be used as the marker
+  
+  const uword none = uword(ARMA_MAX_UWORD);
+  
+  podarray<uword> pos(N);
+  
+  uword* pos_mem = pos.memptr();
+  
+  arrayops::inplace_set(pos_mem, none, N);
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword row_start  = row_ptrs_mem[i  ];
+    const uword row_end_p1 = row_ptrs_mem[i+1];
+    const uword row_diag   = diag_pos_mem[i];
+    
+    for(uword p=row_start; p < row_end_p1; ++p)  { pos_mem[ col_indices_mem[p] ] = p; }
+    
+    for(uword p=row_start; p < row_diag; ++p)
+      {
+      const uword k = col_indices_mem[p];
+      
+      const eT l_ik = values_mem[p] / values_mem[ diag_pos_mem[k] ];
+      
+      values_mem[p] = l_ik;
+      
+      const uword k_end_p1 = row_ptrs_mem[k+1];
+      
+      for(uword q = diag_pos_mem[k]+1; q < k_end_p1; ++q)
+        {
+        const uword loc = pos_mem[ col_indices_mem[q] ];
+        
+        if(loc != none)  { values_mem[loc] -= l_ik * values_mem[q]; }
+        }
+      }
+    
+    for(uword p=row_start; p < row_end_p1; ++p)  { pos_mem[ col_indices_mem[p] ] = none; }
+    
+    if(values_mem[row_diag] == eT(0))  { return false; }
+    }
+  
+  return true;
+  }
+
+
+
+//! ILUT: incomplete LU factorisation with dual dropping strategy;
+//! entries smaller than drop_tol * norm(row) are dropped,
+//! and each row of L and U keeps at most max_fill more entries than the corresponding row of A;
+//! Y. Saad, Numer. Linear Algebra Appl. 1 (1994)
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init_ilut(const SpMat<eT>& A, const T drop_tol, const uword max_fill)
+  {
+  arma_extra_debug_sigprint();
+  
+  SpMat<eT> R;
+  
+  get_rows(R, A);
+  
+  const uword* R_col_ptrs    = R.col_ptrs;
+  const uword* R_row_indices = R.row_indices;
+  const eT*    R_values      = R.values;
+  
+  // rows of U are stored with the diagonal first
+  
+  std::vector<uword> L_ptrs(N+1);
+  std::vector<uword> L_cols;
+  std::vector<eT>    L_vals;
+  
+  std::vector<uword> U_ptrs(N+1);
+  std::vector<uword> U_cols;
+  std::vector<eT>    U_vals;
+  
+  L_cols.reserve(R.n_nonzero);
+  L_vals.reserve(R.n_nonzero);
+  U_cols.reserve(R.n_nonzero);
+  U_vals.reserve(R.n_nonzero);
+  
+  podarray<eT>    w(N);
+  podarray<uword> marker(N);
+  
+  eT*    w_mem      = w.memptr();
+  uword* marker_mem = marker.memptr();
+  
+  arrayops::fill_zeros(w_mem, N);
+  arrayops::inplace_set(marker_mem, N, N);
+  
+  std::vector<uword> heap;
+  std::vector<uword> l_list;
+  std::vector<uword> u_list;
+  std::vector<uword> touched;
+  
+  const sp_precond_min_heap heap_cmp;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    L_ptrs[i] = uword(L_cols.size());
+    U_ptrs[i] = uword(U_cols.size());
+    
+    heap.clear();
+    l_list.clear();
+    u_list.clear();
+    touched.clear();
+    
+    uword n_lower  = 0;
+    uword n_upper  = 0;
+    T     row_norm = T(0);
+    
+    for(uword p=R_col_ptrs[i]; p < R_col_ptrs[i+1]; ++p)
+      {
+      const uword j   = R_row_indices[p];
+      const eT    val = R_values[p];
+      
+      w_mem[j]      = val;
+      marker_mem[j] = i;
+      
+      touched.push_back(j);
+      
+      const T abs_val = std::abs(val);
+      
+      row_norm += abs_val*abs_val;
+           
+           if(j < i)  { heap.push_back(j);   ++n_lower; }
+      else if(j > i)  { u_list.push_back(j); ++n_upper; }
+      }
+    
+    if(marker_mem[i] != i)
+      {
+      w_mem[i]      = eT(0);
+      marker_mem[i] = i;
+      
+      touched.push_back(i);
+      }
+    
+    const T tau = drop_tol * std::sqrt(row_norm);
+    
+    std::make_heap(heap.begin(), heap.end(), heap_cmp);
+    
+    while(heap.empty() == false)
+      {
+      std::pop_heap(heap.begin(), heap.end(), heap_cmp);
+      
+      const uword k = heap.back();
+      
+      heap.pop_back();
+      
+      const eT l_ik = w_mem[k] / U_vals[ U_ptrs[k] ];
+      
+      if(std::abs(l_ik) <= tau)  { w_mem[k] = eT(0); continue; }
+      
+      w_mem[k] = l_ik;
+      
+      l_list.push_back(k);
+      
+      const uword k_end_p1 = U_ptrs[k+1];
+      
+      for(uword q = U_ptrs[k]+1; q < k_end_p1; ++q)
+        {
+        const uword j = U_cols[q];
+        
+        if(marker_mem[j] != i)
+          {
+          w_mem[j]      = eT(0);
+          marker_mem[j] = i;
+          
+          touched.push_back(j);
+          
+          if(j < i)  { heap.push_back(j); std::push_heap(heap.begin(), heap.end(), heap_cmp); }
+          else       { u_list.push_back(j); }
+          }
+        
+        w_mem[j] -= l_ik * U_vals[q];
+        }
+      }
+    
+    // drop small entries of U, then keep the largest entries of each part
+    
+    uword n_kept = 0;
+    
+    for(uword q=0; q < u_list.size(); ++q)
+      {
+      const uword j = u_list[q];
+      
+      if(std::abs(w_mem[j]) > tau)  { u_list[n_kept] = j; ++n_kept; }
+      }
+    
+    u_list.resize(n_kept);
+    
+    keep_largest(l_list, w_mem, n_lower + max_fill);
+    keep_largest(u_list, w_mem, n_upper + max_fill);
+    
+    std::sort(l_list.begin(), l_list.end());
+    std::sort(u_list.begin(), u_list.end());
+    
+    const eT u_ii = w_mem[i];
+    
+    if(u_ii == eT(0))  { return false; }
+    
+    for(uword q=0; q < l_list.size(); ++q)  { L_cols.push_back(l_list[q]); L_vals.push_back(w_mem[ l_list[q] ]); }
+    
+    U_cols.push_back(i);
+    U_vals.push_back(u_ii);
+    
+    for(uword q=0; q < u_list.size(); ++q)  { U_cols.push_back(u_list[q]); U_vals.push_back(w_mem[ u_list[q] ]); }
+    
+    for(uword q=0; q < touched.size(); ++q)  { w_mem[ touched[q] ] = eT(0); }
+    }
+  
+  L_ptrs[N] = uword(L_cols.size());
+  U_ptrs[N] = uword(U_cols.size());
+  
+  // combine L and U into one set of rows
+  
+  const uword nnz = uword(L_cols.size() + U_cols.size());
+  
+  row_ptrs.set_size(N+1);
+  col_indices.set_size(nnz);
+  values.set_size(nnz);
+  diag_pos.set_size(N);
+  
+  uword count = 0;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    row_ptrs[i] = count;
+    
+    for(uword q=L_ptrs[i]; q < L_ptrs[i+1]; ++q)  { col_indices[count] = L_cols[q]; values[count] = L_vals[q]; ++count; }
+    
+    diag_pos[i] = count;
+    
+    for(uword q=U_ptrs[i]; q < U_ptrs[i+1]; ++q)  { col_indices[count] = U_cols[q]; values[count] = U_vals[q]; ++count; }
+    }
+  
+  row_ptrs[N] = count;
+  
+  return true;
+  }
+
+
+
+//! IC(0): incomplete Cholesky factorisation A ~ L*L' with the sparsity pattern of the lower triangle of A;
+//! A must be symmetric (hermitian) positive definite
+template<typename eT>
+inline
+bool
+sp_precond<eT>::init_ic0(const SpMat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  SpMat<eT> R;
+  
+  get_rows(R, A);
+  
+  // the lower triangle of A, by rows, with the diagonal last in each row
+  
+  uword nnz = 0;
+  
+  for(uword i=0; i < N; ++i)
+  for(uword p=R.col_ptrs[i]; p < R.col_ptrs[i+1]; ++p)
+    {
+    if(R.row_indices[p] <= i)  { ++nnz; }
+    }
+  
+  row_ptrs.set_size(N+1);
+  col_indices.set_size(nnz);
+  values.set_size(nnz);
+  diag_pos.set_size(N);
+  
+  uword* row_ptrs_mem    = row_ptrs.memptr();
+  uword* col_indices_mem = col_indices.memptr();
+  eT*    values_mem      = values.memptr();
+  uword* diag_pos_mem    = diag_pos.memptr();
+  
+  uword count = 0;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    row_ptrs_mem[i] = count;
+    
+    for(uword p=R.col_ptrs[i]; p < R.col_ptrs[i+1]; ++p)
+      {
+      const uword j = R.row_indices[p];
+      
+      if(j <= i)  { col_indices_mem[count] = j; values_mem[count] = R.values[p]; ++count; }
+      }
+    
+    if( (count == row_ptrs_mem[i]) || (col_indices_mem[count-1] != i) )  { return false; }  // structurally zero pivot
+    
+    diag_pos_mem[i] = count-1;
+    }
+  
+  row_ptrs_mem[N] = count;
+  
+  for(uword i=0; i < N; ++i)
+    {
+    const uword row_start = row_ptrs_mem[i];
+    const uword row_diag  = diag_pos_mem[i];
+    
+    for(uword p=row_start; p < row_diag; ++p)
+      {
+      const uword k = col_indices_mem[p];
+      
+      // subtract the product of the parts of rows i and k left of column k
+      
+      eT acc = values_mem[p];
+      
+      uword a = row_start;
+      uword b = row_ptrs_mem[k];
+      
+      const uword b_end = diag_pos_mem[k];
+      
+      while( (a < p) && (b < b_end) )
+        {
+        const uword col_a = col_indices_mem[a];
+        const uword col_b = col_indices_mem[b];
+             
+             if(col_a == col_b)  { acc -= values_mem[a] * access::alt_conj(values_mem[b]); ++a; ++b; }
+        else if(col_a <  col_b)  { ++a; }
+        else                     { ++b; }
+        }
+      
+      values_mem[p] = acc / values_mem[b_end];
+      }
+    
+    T d = access::tmp_real(values_mem[row_diag]);
+    
+    for(uword p=row_start; p < row_diag; ++p)
+      {
+      const T abs_val = std::abs(values_mem[p]);
+      
+      d -= abs_val*abs_val;
+      }
+    
+    if( (d > T(0)) == false )  { return false; }
+    
+    values_mem[row_diag] = eT( std::sqrt(d) );
+    }
+  
+  return true;
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::keep_largest(std::vector<uword>& indices, const eT* w, const uword n_keep) const
+  {
+  if(indices.size() <= n_keep)  { return; }
+  
+  std::nth_element(indices.begin(), indices.begin() + n_keep, indices.end(), sp_precond_abs_greater<eT>(w));
+  
+  indices.resize(n_keep);
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::solve_ilu(eT* z_mem) const
+  {
+  const uword* row_ptrs_mem    = row_ptrs.memptr();
+  const uword* col_indices_mem = col_indices.memptr();
+  const eT*    values_mem      = values.memptr();
+  const uword* diag_pos_mem    = diag_pos.memptr();
+  
+  // L has a unit diagonal
+  
+  for(uword i=0; i < N; ++i)
+    {
+    eT acc = z_mem[i];
+    
+    const uword row_diag = diag_pos_mem[i];
+    
+    for(uword p=row_ptrs_mem[i]; p < row_diag; ++p)  { acc -= values_mem[p] * z_mem[ col_indices_mem[p] ]; }
+    
+    z_mem[i] = acc;
+    }
+  
+  for(uword i=N; i-- > 0;)
+    {
+    eT acc = z_mem[i];
+    
+    const uword row_diag   = diag_pos_mem[i];
+    const uword row_end_p1 = row_ptrs_mem[i+1];
+    
+    for(uword p=row_diag+1; p < row_end_p1; ++p)  { acc -= values_mem[p] * z_mem[ col_indices_mem[p] ]; }
+    
+    z_mem[i] = acc / values_mem[row_diag];
+    }
+  }
+
+
+
+template<typename eT>
+inline
+void
+sp_precond<eT>::solve_ic(eT* z_mem) const
+  {
+  const uword* row_ptrs_mem    = row_ptrs.memptr();
+  const uword* col_indices_mem = col_indices.memptr();
+  const eT*    values_mem      = values.memptr();
+  const uword* diag_pos_mem    = diag_pos.memptr();
+  
+  // L*y = r by rows, then L'*z = y by columns of L'
+  
+  for(uword i=0; i < N; ++i)
+    {
+    eT acc = z_mem[i];
+    
+    const uword row_diag = diag_pos_mem[i];
+    
+    for(uword p=row_ptrs_mem[i]; p < row_diag; ++p)  { acc -= values_mem[p] * z_mem[ col_indices_mem[p] ]; }
+    
+    z_mem[i] = acc / values_mem[row_diag];
+    }
+  
+  for(uword i=N; i-- > 0;)
+    {
+    const uword row_diag = diag_pos_mem[i];
+    
+    const eT z_i = z_mem[i] / values_mem[row_diag];
+    
+    z_mem[i] = z_i;
+    
+    for(uword p=row_ptrs_mem[i]; p < row_diag; ++p)  { z_mem[ col_indices_mem[p] ] -= access::alt_conj(values_mem[p]) * z_i; }
+    }
+  }
+
+
+
+//! @}
@@ -0,0 +1,260 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_rand_helper
+//! @{
+
+
+//! generation of random sparse matrices directly in CSC form;
+//! each element is non-zero with probability equal to the density,
+//! so the number of non-zeros in each column has a binomial distribution
+namespace sp_rand_helper
+{
+
+
+
+struct arma_rng_uniform
+  {
+  arma_inline double operator()() const { return double( arma_rng::randu<double>() ); }
+  };
+
+
+
+#if defined(ARMA_USE_CXX11)
+
+typedef std::mt19937_64 motor_type;
+
+struct motor_uniform
+  {
+  motor_type&                            motor;
+  std::uniform_real_distribution<double> distr;
+  
+  inline motor_uniform(motor_type& in_motor) : motor(in_motor) {}
+  
+  arma_inline double operator()() { return distr(motor); }
+  };
+
+
+
+template<typename eT, typename distr_type>
+inline
+void
+fill_values(eT* mem, const uword N, distr_type& distr, motor_type& motor)
+  {
+  for(uword i=0; i < N; ++i)  { mem[i] = eT( distr(motor) ); }
+  }
+
+
+
+template<typename T, typename distr_type>
+inline
+void
+fill_values(std::complex<T>* mem, const uword N, distr_type& distr, motor_type& motor)
+  {
+  for(uword i=0; i < N; ++i)
+    {
+    const T a = T( distr(motor) );
+    const T b = T( distr(motor) );
+    
+    mem[i] = std::complex<T>(a, b);
+    }
+  }
+
+#endif
+
+
+
+//! select each of the linear indices in [lo,hi) with probability p, where log_q = log(1-p);
+//! the gaps between selected indices have a geometric distribution and are drawn directly,
+//! so the indices come out sorted and the time taken is proportional to their number
+template<typename uniform_type>
+inline
+void
+sample_locations(std::vector<uword>& locs, const uword lo, const uword hi, const double log_q, uniform_type& uniform)
+  {
+  locs.clear();
+  
+  locs.reserve( uword( (double(1) - std::exp(log_q)) * double(hi - lo) * double(1.05) ) + uword(16) );
+  
+  uword i = lo;
+  
+  while(i < hi)
+    {
+    const double u = double(1) - uniform();
+    
+    if(u <= double(0))  { continue; }
+    
+    const double gap = std::floor( std::log(u) / log_q );
+    
+    if( (gap < double(hi - i)) == false )  { break; }
+    
+    i += uword(gap);
+    
+    locs.push_back(i);
+    
+    ++i;
+    }
+  }
+
+
+
+//! write the sorted linear indices taken from [lo,hi) into the row indices, starting at 'offset',
+//! and set the pointers of the columns which start within [lo,hi)
+inline
+void
+place_locations(uword* row_indices, uword* col_ptrs, const std::vector<uword>& locs, const uword offset, const uword lo, const uword hi, const uword n_rows)
+  {
+  if(lo >= hi)  { return; }
+  
+  uword col       = lo / n_rows;
+  uword col_start = col * n_rows;
+  
+  if(col_start == lo)  { col_ptrs[col] = offset; }
+  
+  const uword N = uword(locs.size());
+  
+  for(uword k=0; k < N; ++k)
+    {
+    const uword i = locs[k];
+    
+    while(i >= (col_start + n_rows))  { ++col;  col_start += n_rows;  col_ptrs[col] = offset + k; }
+    
+    row_indices[offset + k] = i - col_start;
+    }
+  
+  while((col_start + n_rows) < hi)  { ++col;  col_start += n_rows;  col_ptrs[col] = offset + N; }
+  }
+
+
+
+//! fill 'out', which must be a matrix of zeros, with non-zero elements at random locations;
+//! the values have a uniform distribution in the [0,1] interval, or a normal distribution if use_randn is true
+template<typename eT>
+inline
+void
+generate(SpMat<eT>& out, const double density, const bool use_randn)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword n_rows = out.n_rows;
+  const uword n_cols = out.n_cols;
+  const uword N      = out.n_elem;
+  
+  if( (N == 0) || (density <= double(0)) )  { return; }
+  
+  // for density == 1 the gaps are all zero
+  const double log_q = std::log(double(1) - (std::min)(density, double(1)));
+  
+  #if defined(ARMA_USE_OPENMP) && defined(ARMA_USE_CXX11)
+    {
+    const uword n_threads = uword( mp_thread_limit::get() );
+    
+    if( mp_gate<eT>::eval( uword(density * double(N)) ) && (n_threads >= 2) )
+      {
+      typedef motor_type::result_type seed_type;
+      
+      // independent streams: each thread draws the locations and values of a contiguous range of linear indices
+      std::vector<motor_type>            motors(n_threads);
+      std::vector< std::vector<uword> >  locs  (n_threads);
+      
+      for(uword t=0; t < n_threads; ++t)  { motors[t].seed( seed_type(t) + seed_type(arma_rng::randi<seed_type>()) ); }
+      
+      const uword chunk = (N + n_threads - 1) / n_threads;
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword lo = (std::min)(N, t * chunk);
+        const uword hi = (std::min)(N, lo + chunk);
+        
+        motor_uniform uniform(motors[t]);
+        
+        sample_locations(locs[t], lo, hi, log_q, uniform);
+        }
+      
+      podarray<uword> offsets(n_threads + 1);
+      
+      offsets[0] = 0;
+      
+      for(uword t=0; t < n_threads; ++t)  { offsets[t+1] = offsets[t] + uword(locs[t].size()); }
+      
+      out.mem_resize(offsets[n_threads]);
+      
+      uword* row_indices = access::rwp(out.row_indices);
+      uword* col_ptrs    = access::rwp(out.col_ptrs);
+      eT*    values      = access::rwp(out.values);
+      
+      #pragma omp parallel for schedule(static) num_threads(int(n_threads))
+      for(uword t=0; t < n_threads; ++t)
+        {
+        const uword lo = (std::min)(N, t * chunk);
+        const uword hi = (std::min)(N, lo + chunk);
+        
+        place_locations(row_indices, col_ptrs, locs[t], offsets[t], lo, hi, n_rows);
+        
+        const uword n_t = uword(locs[t].size());
+        
+        if(use_randn)
+          {
+          std::normal_distribution<double> distr;
+          
+          fill_values(&values[offsets[t]], n_t, distr, motors[t]);
+          }
+        else
+          {
+          std::uniform_real_distribution<double> distr;
+          
+          fill_values(&values[offsets[t]], n_t, distr, motors[t]);
+          }
+        }
+      
+      col_ptrs[n_cols] = out.n_nonzero;
+      
+      return;
+      }
+    }
+  #endif
+  
+  std::vector<uword> locs;
+  
+  arma_rng_uniform uniform;
+  
+  sample_locations(locs, uword(0), N, log_q, uniform);
+  
+  out.mem_resize( uword(locs.size()) );
+  
+  uword* col_ptrs = access::rwp(out.col_ptrs);
+  
+  place_locations(access::rwp(out.row_indices), col_ptrs, locs, uword(0), uword(0), N, n_rows);
+  
+  col_ptrs[n_cols] = out.n_nonzero;
+  
+  if(use_randn)
+    {
+    arma_rng::randn<eT>::fill( access::rwp(out.values), out.n_nonzero );
+    }
+  else
+    {
+    arma_rng::randu<eT>::fill( access::rwp(out.values), out.n_nonzero );
+    }
+  }
+
+
+
+}  // namespace sp_rand_helper
+
+
+//! @}
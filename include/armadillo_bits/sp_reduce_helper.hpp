@@ -0,0 +1,376 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sp_reduce_helper
+//! @{
+
+
+//! reductions over the elements of sparse matrices stored in CSC form:
+//! per column, per row (scattered into per-thread buffers), and over all elements.
+//! each reduction is described by a functor providing acc_type, init(), update(acc,j) and merge(acc,x),
+//! where update() adds element j of the CSC arrays to acc.
+namespace sp_reduce_helper
+{
+
+
+
+template<typename T> arma_inline T abs2(const T x)                 { return x*x;          }
+template<typename T> arma_inline T abs2(const std::complex<T>& x)  { return std::norm(x); }
+
+
+
+template<typename eT>
+struct red_sum
+  {
+  typedef eT acc_type;
+  
+  const eT* values;
+  
+  inline explicit red_sum(const eT* in_values) : values(in_values) {}
+  
+  arma_inline static acc_type init()                                     { return eT(0); }
+  arma_inline        void     update(acc_type& acc, const uword j) const { acc += values[j]; }
+  arma_inline static void     merge(acc_type& acc, const acc_type x)     { acc += x;         }
+  };
+
+
+
+template<typename eT>
+struct red_abs_sum
+  {
+  typedef typename get_pod_type<eT>::result acc_type;
+  
+  const eT* values;
+  
+  inline explicit red_abs_sum(const eT* in_values) : values(in_values) {}
+  
+  arma_inline static acc_type init()                                     { return acc_type(0); }
+  arma_inline        void     update(acc_type& acc, const uword j) const { acc += std::abs(values[j]); }
+  arma_inline static void     merge(acc_type& acc, const acc_type x)     { acc += x; }
+  };
+
+
+
+template<typename eT>
+struct red_max
+  {
+  typedef eT acc_type;
+  
+  const eT* values;
+  
+  inline explicit red_max(const eT* in_values) : values(in_values) {}
+  
+  arma_inline static acc_type init()                                     { return priv::most_neg<eT>(); }
+  arma_inline        void     update(acc_type& acc, const uword j) const { if(values[j] > acc)  { acc = values[j]; } }
+  arma_inline static void     merge(acc_type& acc, const acc_type x)     { if(x > acc)          { acc = x;         } }
+  };
+
+
+
+template<typename eT>
+struct red_min
+  {
+  typedef eT acc_type;
+  
+  const eT* values;
+  
+  inline explicit red_min(const eT* in_values) : values(in_values) {}
+  
+  arma_inline static acc_type init()                                     { return priv::most_pos<eT>(); }
+  arma_inline        void     update(acc_type& acc, const uword j) const { if(values[j] < acc)  { acc = values[j]; } }
+  arma_inline static void     merge(acc_type& acc, const acc_type x)     { if(x < acc)          { acc = x;         } }
+  };
+
+
+
+//! number of stored elements
+struct red_count
+  {
+  typedef uword acc_type;
+  
+  arma_inline static acc_type init()                                   { return uword(0); }
+  arma_inline        void     update(acc_type& acc, const uword) const { ++acc; }
+  arma_inline static void     merge(acc_type& acc, const acc_type x)   { acc += x; }
+  };
+
+
+
+//! sum of squared deviations of the values from the mean of their row
+template<typename eT>
+struct red_row_sqdev
+  {
+  typedef typename get_pod_type<eT>::result acc_type;
+  
+  const eT*    values;
+  const uword* row_indices;
+  const eT*    row_means;
+  
+  inline red_row_sqdev(const eT* in_values, const uword* in_row_indices, const eT* in_row_means)
+    : values(in_values)
+    , row_indices(in_row_indices)
+    , row_means(in_row_means)
+    {
+    }
+  
+  arma_inline static acc_type init()                                     { return acc_type(0); }
+  arma_inline        void     update(acc_type& acc, const uword j) const { acc += abs2(values[j] - row_means[ row_indices[j] ]); }
+  arma_inline static void     merge(acc_type& acc, const acc_type x)     { acc += x; }
+  };
+
+
+
+//! sum of the element-wise products of column c of A and column c of B, where update() is called per column
+template<typename eT>
+struct red_dot_col
+  {
+  typedef eT acc_type;
+  
+  const uword* A_col_ptrs;
+  const uword* A_rows;
+  const eT*    A_vals;
+  
+  const uword* B_col_ptrs;
+  const uword* B_rows;
+  const eT*    B_vals;
+  
+  inline red_dot_col(const SpMat<eT>& A, const SpMat<eT>& B)
+    : A_col_ptrs(A.col_ptrs), A_rows(A.row_indices), A_vals(A.values)
+    , B_col_ptrs(B.col_ptrs), B_rows(B.row_indices), B_vals(B.values)
+    {
+    }
+  
+  arma_inline static acc_type init()                                 { return eT(0); }
+  arma_inline static void     merge(acc_type& acc, const acc_type x) { acc += x;     }
+  
+  inline
+  void
+  update(acc_type& acc, const uword c) const
+    {
+          uword ia     = A_col_ptrs[c];
+    const uword ia_end = A_col_ptrs[c+1];
+          uword ib     = B_col_ptrs[c];
+    const uword ib_end = B_col_ptrs[c+1];
+    
+    while( (ia < ia_end) && (ib < ib_end) )
+      {
+      const uword ra = A_rows[ia];
+      const uword rb = B_rows[ib];
+      
+           if(ra < rb)  { ++ia; }
+      else if(rb < ra)  { ++ib; }
+      else              { acc += A_vals[ia] * B_vals[ib];  ++ia;  ++ib; }
+      }
+    }
+  };
+
+
+
+//! out[c] = reduction of the elements in column c.
+//! with OpenMP, the columns are split into ranges holding roughly equal numbers of elements.
+template<typename red_type>
+inline
+void
+col_reduce(typename red_type::acc_type* out, const red_type& red, const uword* col_ptrs, const uword n_cols)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename red_type::acc_type acc_type;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword N = col_ptrs[n_cols];
+    
+    const int n_threads = mp_thread_limit::get();
+    
+    if( mp_gate<acc_type>::eval(N) && (n_threads >= 2) && (n_cols >= uword(n_threads)) )
+      {
+      const uword n_parts = uword(n_threads);
+      
+      // boundary t is the first column at which at least t*N/n_parts elements precede it
+      podarray<uword> bounds(n_parts + 1);
+      
+      uword* bounds_mem = bounds.memptr();
+      
+      bounds_mem[0]       = 0;
+      bounds_mem[n_parts] = n_cols;
+      
+      for(uword t=1; t < n_parts; ++t)
+        {
+        const uword target = (N / n_parts) * t;
+        
+        const uword* pos = std::lower_bound(col_ptrs + bounds_mem[t-1], col_ptrs + n_cols, target);
+        
+        bounds_mem[t] = uword(pos - col_ptrs);
+        }
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword t=0; t < n_parts; ++t)
+        {
+        const uword c_end = bounds_mem[t+1];
+        
+        for(uword c = bounds_mem[t]; c < c_end; ++c)
+          {
+          acc_type acc = red_type::init();
+          
+          for(uword j = col_ptrs[c]; j < col_ptrs[c+1]; ++j)  { red.update(acc, j); }
+          
+          out[c] = acc;
+          }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword c=0; c < n_cols; ++c)
+    {
+    acc_type acc = red_type::init();
+    
+    for(uword j = col_ptrs[c]; j < col_ptrs[c+1]; ++j)  { red.update(acc, j); }
+    
+    out[c] = acc;
+    }
+  }
+
+
+
+//! out[r] = reduction of the N elements whose row index is r.
+//! with OpenMP, each thread reduces a contiguous chunk of the elements into its own buffer,
+//! and the buffers are then merged in thread order.
+template<typename red_type>
+inline
+void
+row_reduce(typename red_type::acc_type* out, const red_type& red, const uword* row_indices, const uword n_rows, const uword N)
+  {
+  arma_extra_debug_sigprint();
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    typedef typename red_type::acc_type acc_type;
+    
+    const int n_threads = mp_thread_limit::get();
+    
+    // the per-thread buffers must not take more memory than the elements themselves
+    if( mp_gate<acc_type>::eval(N) && (n_threads >= 2) && (n_rows <= N / uword(n_threads)) )
+      {
+      podarray<acc_type> buf( uword(n_threads) * n_rows );
+      
+      acc_type* buf_mem = buf.memptr();
+      
+      #pragma omp parallel num_threads(n_threads)
+        {
+        const uword t       = uword(omp_get_thread_num());
+        const uword t_count = uword(omp_get_num_threads());
+        const uword chunk   = (N + t_count - 1) / t_count;
+        const uword j_start = (std::min)(N, t * chunk);
+        const uword j_end   = (std::min)(N, j_start + chunk);
+        
+        acc_type* b = &buf_mem[t * n_rows];
+        
+        for(uword r=0; r < n_rows; ++r)  { b[r] = red_type::init(); }
+        
+        for(uword j=j_start; j < j_end; ++j)  { red.update(b[ row_indices[j] ], j); }
+        
+        #pragma omp barrier
+        
+        #pragma omp for schedule(static)
+        for(uword r=0; r < n_rows; ++r)
+          {
+          acc_type acc = buf_mem[r];
+          
+          for(uword tt=1; tt < t_count; ++tt)  { red_type::merge(acc, buf_mem[tt * n_rows + r]); }
+          
+          out[r] = acc;
+          }
+        }
+      
+      return;
+      }
+    }
+  #endif
+  
+  for(uword r=0; r < n_rows; ++r)  { out[r] = red_type::init(); }
+  
+  for(uword j=0; j < N; ++j)  { red.update(out[ row_indices[j] ], j); }
+  }
+
+
+
+//! reduction of the items [0,N), where n_work is the total amount of work used to decide on OpenMP;
+//! each thread reduces a contiguous chunk, and the partial results are merged in thread order
+template<typename red_type>
+inline
+typename red_type::acc_type
+all_reduce(const red_type& red, const uword N, const uword n_work)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename red_type::acc_type acc_type;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const int n_threads = mp_thread_limit::get();
+    
+    if( mp_gate<acc_type>::eval(n_work) && (n_threads >= 2) && (N >= uword(n_threads)) )
+      {
+      podarray<acc_type> partial( static_cast<uword>(n_threads) );
+      
+      acc_type* partial_mem = partial.memptr();
+      
+      for(uword t=0; t < uword(n_threads); ++t)  { partial_mem[t] = red_type::init(); }
+      
+      #pragma omp parallel num_threads(n_threads)
+        {
+        const uword t       = uword(omp_get_thread_num());
+        const uword t_count = uword(omp_get_num_threads());
+        const uword chunk   = (N + t_count - 1) / t_count;
+        const uword j_start = (std::min)(N, t * chunk);
+        const uword j_end   = (std::min)(N, j_start + chunk);
+        
+        acc_type acc = red_type::init();
+        
+        for(uword j=j_start; j < j_end; ++j)  { red.update(acc, j); }
+        
+        partial_mem[t] = acc;
+        }
+      
+      acc_type acc = partial_mem[0];
+      
+      for(uword t=1; t < uword(n_threads); ++t)  { red_type::merge(acc, partial_mem[t]); }
+      
+      return acc;
+      }
+    }
+  #else
+    {
+    arma_ignore(n_work);
+    }
+  #endif
+  
+  acc_type acc = red_type::init();
+  
+  for(uword j=0; j < N; ++j)  { red.update(acc, j); }
+  
+  return acc;
+  }
+
+
+
+}  // namespace sp_reduce_helper
+
+
+//! @}
@@ -61,6 +61,12 @@ spglue_plus::apply_noalias(SpMat<eT>& out, const SpProxy<T1>& pa, const SpProxy<
   
   if( (pa.get_n_nonzero() != 0) && (pb.get_n_nonzero() != 0) )
     {
+    if( (SpProxy<T1>::use_iterator == false) && (SpProxy<T2>::use_iterator == false) )
+      {
+      sp_merge_helper::apply< sp_merge_helper::merge_plus<eT> >(out, pa, pb);
+      return;
+      }
+    
     out.zeros(pa.get_n_rows(), pa.get_n_cols());
     
     // Resize memory to correct size.
@@ -0,0 +1,52 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup spglue_times_masked
+//! @{
+
+
+
+//! evaluation of (A*B) % S, where S is a sparse matrix;
+//! the product A*B is only evaluated at the locations of the non-zero elements of S
+class spglue_times_masked
+  {
+  public:
+  
+  template<typename T1, typename T2, typename T3>
+  inline static void apply(SpMat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>& X, const SpBase<typename T1::elem_type,T3>& S_expr);
+  
+  template<typename T1, typename T2, typename T3>
+  inline static void apply(SpMat<typename T1::elem_type>& out, const SpGlue<T1,T2,spglue_times>& X, const SpBase<typename T1::elem_type,T3>& S_expr);
+  
+  template<typename eT>
+  inline static void apply_dense_noalias(SpMat<eT>& out, const Mat<eT>& A, const bool do_trans_A, const Mat<eT>& B, const bool do_trans_B, const eT alpha, const SpMat<eT>& S);
+  
+  template<typename eT>
+  inline static void apply_sparse_noalias(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B, const SpMat<eT>& S);
+  
+  
+  private:
+  
+  template<typename eT>
+  inline static uword partition(podarray<uword>& bounds, const SpMat<eT>& S, const uword work);
+  
+  template<typename eT>
+  inline static void compact(SpMat<eT>& out, const SpMat<eT>& S, const eT* vals);
+  };
+
+
+
+//! @}
@@ -0,0 +1,367 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup spglue_times_masked
+//! @{
+
+
+
+template<typename T1, typename T2, typename T3>
+inline
+void
+spglue_times_masked::apply(SpMat<typename T1::elem_type>& out, const Glue<T1,T2,glue_times>& X, const SpBase<typename T1::elem_type,T3>& S_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const partial_unwrap<T1> tmp1(X.A);
+  const partial_unwrap<T2> tmp2(X.B);
+  
+  const Mat<eT>& A = tmp1.M;
+  const Mat<eT>& B = tmp2.M;
+  
+  const bool do_trans_A = partial_unwrap<T1>::do_trans;
+  const bool do_trans_B = partial_unwrap<T2>::do_trans;
+  
+  const bool use_alpha = partial_unwrap<T1>::do_times || partial_unwrap<T2>::do_times;
+  const eT       alpha = use_alpha ? (tmp1.get_val() * tmp2.get_val()) : eT(1);
+  
+  const unwrap_spmat<T3> tmp3(S_expr.get_ref());
+  
+  const SpMat<eT>& S = tmp3.M;
+  
+  arma_debug_assert_trans_mul_size<partial_unwrap<T1>::do_trans, partial_unwrap<T2>::do_trans>(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "matrix multiplication");
+  
+  const uword AB_n_rows = (do_trans_A) ? A.n_cols : A.n_rows;
+  const uword AB_n_cols = (do_trans_B) ? B.n_rows : B.n_cols;
+  
+  arma_debug_assert_same_size(AB_n_rows, AB_n_cols, S.n_rows, S.n_cols, "element-wise multiplication");
+  
+  // each element is evaluated as a separate dot product, which is limited by memory bandwidth;
+  // when S is not very sparse, the full product via gemm is quicker
+  if( double(S.n_nonzero) > double(0.1) * double(AB_n_rows) * double(AB_n_cols) )
+    {
+    arma_extra_debug_print("spglue_times_masked::apply(): S is not sparse enough; using full product");
+    
+    Mat<eT> AB;
+    
+    glue_times::apply
+      <
+      eT,
+      partial_unwrap<T1>::do_trans,
+      partial_unwrap<T2>::do_trans,
+      (partial_unwrap<T1>::do_times || partial_unwrap<T2>::do_times)
+      >
+      (AB, A, B, alpha);
+    
+    SpMat<eT> tmp = AB % S;
+    
+    out.steal_mem(tmp);
+    
+    return;
+    }
+  
+  if(void_ptr(&out) == void_ptr(&S))
+    {
+    SpMat<eT> tmp;
+    
+    spglue_times_masked::apply_dense_noalias(tmp, A, do_trans_A, B, do_trans_B, alpha, S);
+    
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    spglue_times_masked::apply_dense_noalias(out, A, do_trans_A, B, do_trans_B, alpha, S);
+    }
+  }
+
+
+
+template<typename T1, typename T2, typename T3>
+inline
+void
+spglue_times_masked::apply(SpMat<typename T1::elem_type>& out, const SpGlue<T1,T2,spglue_times>& X, const SpBase<typename T1::elem_type,T3>& S_expr)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const unwrap_spmat<T1> tmp1(X.A);
+  const unwrap_spmat<T2> tmp2(X.B);
+  const unwrap_spmat<T3> tmp3(S_expr.get_ref());
+  
+  const SpMat<eT>& A = tmp1.M;
+  const SpMat<eT>& B = tmp2.M;
+  const SpMat<eT>& S = tmp3.M;
+  
+  arma_debug_assert_mul_size(A.n_rows, A.n_cols, B.n_rows, B.n_cols, "matrix multiplication");
+  
+  arma_debug_assert_same_size(A.n_rows, B.n_cols, S.n_rows, S.n_cols, "element-wise multiplication");
+  
+  const bool is_alias = (void_ptr(&out) == void_ptr(&A)) || (void_ptr(&out) == void_ptr(&B)) || (void_ptr(&out) == void_ptr(&S));
+  
+  if(is_alias)
+    {
+    SpMat<eT> tmp;
+    
+    spglue_times_masked::apply_sparse_noalias(tmp, A, B, S);
+    
+    out.steal_mem(tmp);
+    }
+  else
+    {
+    spglue_times_masked::apply_sparse_noalias(out, A, B, S);
+    }
+  }
+
+
+
+//! the rows of op(A) and the columns of op(B) are stored as columns,
+//! so that each element of the product is the dot product of two contiguous vectors
+template<typename eT>
+inline
+void
+spglue_times_masked::apply_dense_noalias(SpMat<eT>& out, const Mat<eT>& A, const bool do_trans_A, const Mat<eT>& B, const bool do_trans_B, const eT alpha, const SpMat<eT>& S)
+  {
+  arma_extra_debug_sigprint();
+  
+  Mat<eT> L_tmp;
+  Mat<eT> R_tmp;
+  
+  if(do_trans_A == false)  { op_strans::apply_mat_noalias(L_tmp, A); }  else if(is_cx<eT>::yes)  { L_tmp = conj(A); }
+  if(do_trans_B == true )  { op_htrans::apply_mat_noalias(R_tmp, B); }
+  
+  const Mat<eT>& L = ( (do_trans_A == false) || is_cx<eT>::yes ) ? L_tmp : A;
+  const Mat<eT>& R = (do_trans_B == true) ? R_tmp : B;
+  
+  const uword K = L.n_rows;
+  
+  podarray<eT> vals(S.n_nonzero);
+  
+  eT* vals_mem = vals.memptr();
+  
+  const uword*   S_col_ptrs    = S.col_ptrs;
+  const uword*   S_row_indices = S.row_indices;
+  const eT*      S_values      = S.values;
+  
+  podarray<uword> bounds;
+  
+  const uword n_parts = spglue_times_masked::partition(bounds, S, S.n_nonzero * K);
+  
+  const uword* bounds_mem = bounds.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_parts))
+  #endif
+  for(uword t=0; t < n_parts; ++t)
+    {
+    const uword c_end = bounds_mem[t+1];
+    
+    for(uword c = bounds_mem[t]; c < c_end; ++c)
+      {
+      const eT* R_col = R.colptr(c);
+      
+      for(uword p = S_col_ptrs[c]; p < S_col_ptrs[c+1]; ++p)
+        {
+        vals_mem[p] = alpha * S_values[p] * op_dot::direct_dot(K, L.colptr(S_row_indices[p]), R_col);
+        }
+      }
+    }
+  
+  spglue_times_masked::compact(out, S, vals_mem);
+  }
+
+
+
+//! masked form of Gustavson's algorithm:
+//! the columns of A selected by each column of B are scattered only into the rows present in the corresponding column of S,
+//! so no work or memory is spent on elements of A*B outside the sparsity pattern of S
+template<typename eT>
+inline
+void
+spglue_times_masked::apply_sparse_noalias(SpMat<eT>& out, const SpMat<eT>& A, const SpMat<eT>& B, const SpMat<eT>& S)
+  {
+  arma_extra_debug_sigprint();
+  
+  podarray<eT> vals(S.n_nonzero);
+  
+  eT* vals_mem = vals.memptr();
+  
+  arrayops::fill_zeros(vals_mem, S.n_nonzero);
+  
+  const uword* A_col_ptrs    = A.col_ptrs;
+  const uword* A_row_indices = A.row_indices;
+  const eT*    A_values      = A.values;
+  
+  const uword* B_col_ptrs    = B.col_ptrs;
+  const uword* B_row_indices = B.row_indices;
+  const eT*    B_values      = B.values;
+  
+  const uword* S_col_ptrs    = S.col_ptrs;
+  const uword* S_row_indices = S.row_indices;
+  const eT*    S_values      = S.values;
+  
+  const uword A_n_rows = A.n_rows;
+  
+  podarray<uword> bounds;
+  
+  const uword n_parts = spglue_times_masked::partition(bounds, S, S.n_nonzero + B.n_nonzero);
+  
+  const uword* bounds_mem = bounds.memptr();
+  
+  #if defined(ARMA_USE_OPENMP)
+    #pragma omp parallel for schedule(static) num_threads(int(n_parts))
+  #endif
+  for(uword t=0; t < n_parts; ++t)
+    {
+    // slot[i] is one more than the location of row i within the current column of S, or zero if row i is not present
+    podarray<uword> slot(A_n_rows);
+    
+    uword* slot_mem = slot.memptr();
+    
+    arrayops::fill_zeros(slot_mem, A_n_rows);
+    
+    const uword c_end = bounds_mem[t+1];
+    
+    for(uword c = bounds_mem[t]; c < c_end; ++c)
+      {
+      const uword S_start = S_col_ptrs[c  ];
+      const uword S_end   = S_col_ptrs[c+1];
+      
+      if(S_start == S_end)  { continue; }
+      
+      for(uword p = S_start; p < S_end; ++p)  { slot_mem[ S_row_indices[p] ] = p + 1; }
+      
+      for(uword q = B_col_ptrs[c]; q < B_col_ptrs[c+1]; ++q)
+        {
+        const uword k     = B_row_indices[q];
+        const eT    B_val = B_values[q];
+        
+        for(uword r = A_col_ptrs[k]; r < A_col_ptrs[k+1]; ++r)
+          {
+          const uword s = slot_mem[ A_row_indices[r] ];
+          
+          if(s != 0)  { vals_mem[s-1] += A_values[r] * B_val; }
+          }
+        }
+      
+      for(uword p = S_start; p < S_end; ++p)
+        {
+        vals_mem[p] *= S_values[p];
+        
+        slot_mem[ S_row_indices[p] ] = 0;
+        }
+      }
+    }
+  
+  spglue_times_masked::compact(out, S, vals_mem);
+  }
+
+
+
+//! boundaries of column ranges with roughly equal numbers of non-zero elements of S;
+//! returns the number of ranges, which is 1 when the work is too small to be worth parallelising
+template<typename eT>
+inline
+uword
+spglue_times_masked::partition(podarray<uword>& bounds, const SpMat<eT>& S, const uword work)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword  n_cols   = S.n_cols;
+  const uword  N        = S.n_nonzero;
+  const uword* col_ptrs = S.col_ptrs;
+  
+  uword n_parts = 1;
+  
+  #if defined(ARMA_USE_OPENMP)
+    {
+    const uword n_threads = uword( mp_thread_limit::get() );
+    
+    if( mp_gate<eT>::eval(work) && (n_threads >= 2) && (n_cols >= n_threads) )  { n_parts = n_threads; }
+    }
+  #else
+    {
+    arma_ignore(work);
+    }
+  #endif
+  
+  bounds.set_size(n_parts + 1);
+  
+  uword* bounds_mem = bounds.memptr();
+  
+  bounds_mem[0]       = 0;
+  bounds_mem[n_parts] = n_cols;
+  
+  // boundary t is the first column at which at least t*N/n_parts elements precede it
+  for(uword t=1; t < n_parts; ++t)
+    {
+    const uword target = (N / n_parts) * t;
+    
+    const uword* pos = std::lower_bound(col_ptrs + bounds_mem[t-1], col_ptrs + n_cols, target);
+    
+    bounds_mem[t] = uword(pos - col_ptrs);
+    }
+  
+  return n_parts;
+  }
+
+
+
+//! the result has the sparsity pattern of S, without the locations where the product is zero
+template<typename eT>
+inline
+void
+spglue_times_masked::compact(SpMat<eT>& out, const SpMat<eT>& S, const eT* vals)
+  {
+  arma_extra_debug_sigprint();
+  
+  const uword N = S.n_nonzero;
+  
+  uword count = 0;
+  
+  for(uword i=0; i < N; ++i)  { count += (vals[i] != eT(0)) ? uword(1) : uword(0); }
+  
+  out.zeros(S.n_rows, S.n_cols);
+  
+  out.mem_resize(count);
+  
+  uword* out_row_indices = access::rwp(out.row_indices);
+  uword* out_col_ptrs    = access::rwp(out.col_ptrs);
+  eT*    out_values      = access::rwp(out.values);
+  
+  uword k = 0;
+  
+  for(uword c=0; c < S.n_cols; ++c)
+    {
+    for(uword p = S.col_ptrs[c]; p < S.col_ptrs[c+1]; ++p)
+      {
+      if(vals[p] != eT(0))
+        {
+        out_values[k]      = vals[p];
+        out_row_indices[k] = S.row_indices[p];
+        ++k;
+        }
+      }
+    
+    out_col_ptrs[c+1] = k;
+    }
+  }
+
+
+
+//! @}
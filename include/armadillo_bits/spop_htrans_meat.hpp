@@ -44,6 +44,21 @@ spop_htrans::apply(SpMat<typename T1::elem_type>& out, const SpOp<T1,spop_htrans
   
   typedef typename T1::elem_type  eT;
   
+  if(is_SpMat<T1>::value)
+    {
+    const unwrap_spmat<T1> tmp(in.m);
+    
+    spop_strans::apply_spmat(out, tmp.M);
+    
+    eT* out_values = access::rwp(out.values);
+    
+    const uword N = out.n_nonzero;
+    
+    for(uword i=0; i < N; ++i)  { out_values[i] = std::conj(out_values[i]); }
+    
+    return;
+    }
+  
   const SpProxy<T1> p(in.m);
   
   const uword N = p.get_n_nonzero();
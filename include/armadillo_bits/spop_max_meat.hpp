@@ -47,6 +47,57 @@ spop_max::apply(SpMat<typename T1::elem_type>& out, const SpOp<T1,spop_max>& in)
 
 
 
+//! maximum of each column or row of a real matrix, via direct access to the CSC arrays
+template<typename T1>
+inline
+void
+spop_max::apply_direct(SpMat<typename T1::elem_type>& out, const SpProxy<T1>& p, const uword dim)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type eT;
+  
+  const uword p_n_cols = p.get_n_cols();
+  const uword p_n_rows = p.get_n_rows();
+  
+  if(dim == 0)
+    {
+    Row<eT> value(p_n_cols);
+    
+    const uword* col_ptrs = p.get_col_ptrs();
+    
+    sp_reduce_helper::col_reduce(value.memptr(), sp_reduce_helper::red_max<eT>(p.get_values()), col_ptrs, p_n_cols);
+    
+    for(uword col=0; col < p_n_cols; ++col)
+      {
+      if( (col_ptrs[col+1] - col_ptrs[col]) < p_n_rows )  { value[col] = (std::max)(value[col], eT(0)); }
+      }
+    
+    out = value;
+    }
+  else
+  if(dim == 1)
+    {
+    Col<eT> value(p_n_rows);
+    ucolvec count(p_n_rows);
+    
+    const uword* row_indices = p.get_row_indices();
+    const uword  N           = p.get_n_nonzero();
+    
+    sp_reduce_helper::row_reduce(value.memptr(), sp_reduce_helper::red_max<eT>(p.get_values()), row_indices, p_n_rows, N);
+    sp_reduce_helper::row_reduce(count.memptr(), sp_reduce_helper::red_count(),              row_indices, p_n_rows, N);
+    
+    for(uword row=0; row < p_n_rows; ++row)
+      {
+      if(count[row] < p_n_cols)  { value[row] = (std::max)(value[row], eT(0)); }
+      }
+    
+    out = value;
+    }
+  }
+
+
+
 template<typename T1>
 inline
 void
@@ -63,12 +114,18 @@ spop_max::apply_proxy
   
   typedef typename T1::elem_type eT;
   
-  typename SpProxy<T1>::const_iterator_type it     = p.begin();
-  typename SpProxy<T1>::const_iterator_type it_end = p.end();
-  
   const uword p_n_cols = p.get_n_cols();
   const uword p_n_rows = p.get_n_rows();
   
+  if(SpProxy<T1>::use_iterator == false)
+    {
+    spop_max::apply_direct(out, p, dim);
+    return;
+    }
+  
+  typename SpProxy<T1>::const_iterator_type it     = p.begin();
+  typename SpProxy<T1>::const_iterator_type it_end = p.end();
+  
   if(dim == 0) // find the maximum in each column
     {
     Row<eT> value(p_n_cols, fill::zeros);
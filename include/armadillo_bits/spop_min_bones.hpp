@@ -30,6 +30,9 @@ class spop_min
   template<typename T1>
   inline static void apply_proxy(SpMat<typename T1::elem_type>& out, const SpProxy<T1>& p, const uword dim, const typename arma_not_cx<typename T1::elem_type>::result* junk = 0);
   
+  template<typename T1>
+  inline static void apply_direct(SpMat<typename T1::elem_type>& out, const SpProxy<T1>& p, const uword dim);
+  
   template<typename T1>
   inline static typename T1::elem_type vector_min(const T1& X, const typename arma_not_cx<typename T1::elem_type>::result* junk = 0);
   
@@ -35,26 +35,40 @@ spop_strans::apply_spmat(SpMat<eT>& out, const SpMat<eT>& X)
     return;
     }
   
-  umat locs(2, N);
+  // the CSR mirror of X is the CSC representation of the transpose,
+  // so the transpose is formed without sorting the locations
   
-  uword* locs_mem = locs.memptr();
+  X.sync_csr();
   
-  typename SpMat<eT>::const_iterator it = X.begin();
+  SpMat<eT> tmp(X.n_cols, X.n_rows);
   
-  for(uword i=0; i < N; ++i)
+  tmp.mem_resize(N);
+  
+  arrayops::copy( access::rwp(tmp.col_ptrs),    X.csr_row_ptrs.memptr(),    X.n_rows + 1 );
+  arrayops::copy( access::rwp(tmp.row_indices), X.csr_col_indices.memptr(), N            );
+  
+  const uword* locs_mem = X.csr_locs.memptr();
+  
+        eT* tmp_values = access::rwp(tmp.values);
+  const eT*   X_values = X.values;
+  
+  #if defined(ARMA_USE_OPENMP)
     {
-    const uword row = it.col();
-    const uword col = it.row();
-    
-    (*locs_mem) = row;  locs_mem++;
-    (*locs_mem) = col;  locs_mem++;
+    const int n_threads = mp_thread_limit::get();
     
-    ++it;
+    if( mp_gate<eT>::eval(N) && (n_threads >= 2) )
+      {
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword i=0; i < N; ++i)  { tmp_values[i] = X_values[ locs_mem[i] ]; }
+      
+      out.steal_mem(tmp);
+      
+      return;
+      }
     }
+  #endif
   
-  const Col<eT> vals(const_cast<eT*>(X.values), N, false);
-  
-  SpMat<eT> tmp(locs, vals, X.n_cols, X.n_rows, true, false);
+  for(uword i=0; i < N; ++i)  { tmp_values[i] = X_values[ locs_mem[i] ]; }
   
   out.steal_mem(tmp);
   }
@@ -65,14 +65,7 @@ spop_sum::apply(SpMat<typename T1::elem_type>& out, const SpOp<T1,spop_sum>& in)
       }
     else
       {
-      for(uword col = 0; col < p_n_cols; ++col)
-        {
-        acc_mem[col] = arrayops::accumulate
-          (
-          &p.get_values()[p.get_col_ptrs()[col]],
-          p.get_col_ptrs()[col + 1] - p.get_col_ptrs()[col]
-          );
-        }
+      sp_reduce_helper::col_reduce(acc_mem, sp_reduce_helper::red_sum<eT>(p.get_values()), p.get_col_ptrs(), p_n_cols);
       }
     
     out = acc;
@@ -84,14 +77,21 @@ spop_sum::apply(SpMat<typename T1::elem_type>& out, const SpOp<T1,spop_sum>& in)
     
     eT* acc_mem = acc.memptr();
     
-    typename SpProxy<T1>::const_iterator_type it = p.begin();
-    
-    const uword N = p.get_n_nonzero();
-    
-    for(uword i=0; i < N; ++i)
+    if(SpProxy<T1>::use_iterator)
+      {
+      typename SpProxy<T1>::const_iterator_type it = p.begin();
+      
+      const uword N = p.get_n_nonzero();
+      
+      for(uword i=0; i < N; ++i)
+        {
+        acc_mem[it.row()] += (*it);
+        ++it;
+        }
+      }
+    else
       {
-      acc_mem[it.row()] += (*it);
-      ++it;
+      sp_reduce_helper::row_reduce(acc_mem, sp_reduce_helper::red_sum<eT>(p.get_values()), p.get_row_indices(), p_n_rows, p.get_n_nonzero());
       }
     
     out = acc;
@@ -30,6 +30,12 @@ class spop_var
   template<typename T1>
   inline static void apply_noalias(SpMat<typename T1::pod_type>& out, const SpProxy<T1>& p, const uword norm_type, const uword dim);
   
+  template<typename T1>
+  inline static void direct_var_cols(SpMat<typename T1::pod_type>& out, const SpProxy<T1>& p, const uword norm_type);
+  
+  template<typename T1>
+  inline static bool direct_var_rows(SpMat<typename T1::pod_type>& out, const SpProxy<T1>& p, const uword norm_type);
+  
   // Calculate variance of a sparse vector, where we can directly use the memory.
   template<typename T1>
   inline static typename T1::pod_type var_vec(const T1& X, const uword norm_type = 0);
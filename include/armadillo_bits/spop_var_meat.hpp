@@ -72,8 +72,6 @@ spop_var::apply_noalias
   const uword p_n_rows = p.get_n_rows();
   const uword p_n_cols = p.get_n_cols();
   
-  // TODO: this is slow; rewrite based on the approach used by sparse mean()
-  
   if(dim == 0)  // find variance in each column
     {
     arma_extra_debug_print("spop_var::apply_noalias(): dim = 0");
@@ -82,6 +80,8 @@ spop_var::apply_noalias
     
     if( (p_n_rows == 0) || (p.get_n_nonzero() == 0) )  { return; }
     
+    if(SpProxy<T1>::use_iterator == false)  { spop_var::direct_var_cols(out, p, norm_type);  return; }
+    
     for(uword col = 0; col < p_n_cols; ++col)
       {
       if(SpProxy<T1>::use_iterator)
@@ -117,10 +117,15 @@ spop_var::apply_noalias
     
     if( (p_n_cols == 0) || (p.get_n_nonzero() == 0) )  { return; }
     
+    if(SpProxy<T1>::use_iterator == false)
+      {
+      if(spop_var::direct_var_rows(out, p, norm_type))  { return; }
+      }
+    
     for(uword row = 0; row < p_n_rows; ++row)
       {
-      // We have to use an iterator here regardless of whether or not we can
-      // directly access memory.
+      // row iterators are used when the CSC arrays can't be accessed directly,
+      // or when the sums of the rows overflow
       typename SpProxy<T1>::const_row_iterator_type it  = p.begin_row(row);
       typename SpProxy<T1>::const_row_iterator_type end = p.end_row(row);
       
@@ -133,6 +138,111 @@ spop_var::apply_noalias
 
 
 
+//! variance of each column, via direct access to the CSC arrays
+template<typename T1>
+inline
+void
+spop_var::direct_var_cols(SpMat<typename T1::pod_type>& out, const SpProxy<T1>& p, const uword norm_type)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type in_eT;
+  typedef typename T1::pod_type  out_eT;
+  
+  const uword p_n_rows = p.get_n_rows();
+  const uword p_n_cols = p.get_n_cols();
+  
+  const in_eT* values   = p.get_values();
+  const uword* col_ptrs = p.get_col_ptrs();
+  
+  Row<out_eT> result(p_n_cols);
+  
+  out_eT* result_mem = result.memptr();
+  
+  const bool use_mp = arma_config::openmp && mp_gate<in_eT>::eval(p.get_n_nonzero()) && (p_n_cols >= 2);
+  
+  if(use_mp)
+    {
+    #if defined(ARMA_USE_OPENMP)
+      {
+      const int n_threads = mp_thread_limit::get();
+      
+      #pragma omp parallel for schedule(static) num_threads(n_threads)
+      for(uword col=0; col < p_n_cols; ++col)
+        {
+        result_mem[col] = spop_var::direct_var(&values[col_ptrs[col]], col_ptrs[col + 1] - col_ptrs[col], p_n_rows, norm_type);
+        }
+      }
+    #endif
+    }
+  else
+    {
+    for(uword col=0; col < p_n_cols; ++col)
+      {
+      result_mem[col] = spop_var::direct_var(&values[col_ptrs[col]], col_ptrs[col + 1] - col_ptrs[col], p_n_rows, norm_type);
+      }
+    }
+  
+  out = result;
+  }
+
+
+
+//! variance of each row, via direct access to the CSC arrays:
+//! the row means are found first, followed by the squared deviations from them.
+//! returns false if the means are not finite, in which case the robust row-by-row method must be used.
+template<typename T1>
+inline
+bool
+spop_var::direct_var_rows(SpMat<typename T1::pod_type>& out, const SpProxy<T1>& p, const uword norm_type)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename T1::elem_type in_eT;
+  typedef typename T1::pod_type  out_eT;
+  
+  const uword p_n_rows = p.get_n_rows();
+  const uword p_n_cols = p.get_n_cols();
+  const uword N        = p.get_n_nonzero();
+  
+  const in_eT* values      = p.get_values();
+  const uword* row_indices = p.get_row_indices();
+  
+  Col<in_eT> row_means(p_n_rows);
+  
+  sp_reduce_helper::row_reduce(row_means.memptr(), sp_reduce_helper::red_sum<in_eT>(values), row_indices, p_n_rows, N);
+  
+  row_means /= out_eT(p_n_cols);
+  
+  if(row_means.is_finite() == false)  { return false; }
+  
+  podarray<uword>  row_counts(p_n_rows);
+  podarray<out_eT> row_sqdev (p_n_rows);
+  
+  sp_reduce_helper::row_reduce(row_counts.memptr(), sp_reduce_helper::red_count(), row_indices, p_n_rows, N);
+  
+  sp_reduce_helper::row_reduce(row_sqdev.memptr(), sp_reduce_helper::red_row_sqdev<in_eT>(values, row_indices, row_means.memptr()), row_indices, p_n_rows, N);
+  
+  const out_eT norm_val = (norm_type == 0) ? out_eT(p_n_cols - 1) : out_eT(p_n_cols);
+  
+  Col<out_eT> result(p_n_rows);
+  
+  for(uword row=0; row < p_n_rows; ++row)
+    {
+    const uword n_zero = p_n_cols - row_counts[row];
+    
+    const bool trivial = (row_counts[row] == 0) || (p_n_cols == 1);
+    
+    result[row] = (trivial) ? out_eT(0) : (row_sqdev[row] + out_eT(n_zero) * sp_reduce_helper::abs2(row_means[row])) / norm_val;
+    }
+  
+  out = result;
+  
+  return true;
+  }
+
+
+
 template<typename T1>
 inline
 typename T1::pod_type
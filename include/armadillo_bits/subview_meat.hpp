@@ -661,6 +661,14 @@ subview<eT>::operator%=(const SpBase<eT, T1>& x)
     ++cit;
     r++;  if(r >= s_n_rows)  { r = 0; c++; }
     }
+  
+  // zero the elements after the last non-zero value
+  while(c < s_n_cols)
+    {
+    at(r,c) = eT(0);
+    
+    r++;  if(r >= s_n_rows)  { r = 0; c++; }
+    }
   }
 
 
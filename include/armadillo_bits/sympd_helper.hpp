@@ -0,0 +1,109 @@
+// Copyright 2008-2016 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2008-2016 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+//! \addtogroup sympd_helper
+//! @{
+
+
+namespace sympd_helper
+{
+
+
+
+// guess whether a matrix is symmetric (hermitian) positive definite;
+// all the tests below are necessary conditions, so a false result is exact, while a true result is only a guess.
+// the cheapest tests are done first, so that most other matrices are rejected after looking at a few elements.
+
+template<typename eT>
+inline
+bool
+guess_sympd(const Mat<eT>& A)
+  {
+  arma_extra_debug_sigprint();
+  
+  typedef typename get_pod_type<eT>::result T;
+  
+  // NOTE: assuming that A has a square size
+  
+  const uword N = A.n_rows;
+  
+  if(N == 0)  { return false; }
+  
+  const T tol = T(100) * std::numeric_limits<T>::epsilon();  // allow for rounding errors in the computation of A
+  
+  const eT* A_mem = A.memptr();
+  
+  // the diagonal must be real and positive
+  
+  T max_diag = T(0);
+  
+  for(uword j=0; j < N; ++j)
+    {
+    const eT A_jj      = A_mem[j + j*N];
+    const T  A_jj_real = access::tmp_real(A_jj);
+    
+    if( (A_jj_real <= T(0)) || (std::abs(A_jj - eT(A_jj_real)) > tol*A_jj_real) )  { return false; }
+    
+    max_diag = (A_jj_real > max_diag) ? A_jj_real : max_diag;
+    }
+  
+  // quick check of the corners, which reject most non-symmetric matrices
+  
+  if(N >= 2)
+    {
+    const eT A_10 = A_mem[1        ];
+    const eT A_01 = A_mem[    N    ];
+    const eT A_n0 = A_mem[N-1      ];
+    const eT A_0n = A_mem[(N-1)*N  ];
+    
+    if( std::abs(A_10 - access::alt_conj(A_01)) > tol*max_diag )  { return false; }
+    if( std::abs(A_n0 - access::alt_conj(A_0n)) > tol*max_diag )  { return false; }
+    }
+  
+  // A(i,j) = conj(A(j,i)), and every 2x2 principal submatrix must be positive definite,
+  // which implies |A(i,j)| < max(A(i,i), A(j,j)) and 2*|A(i,j)| < A(i,i) + A(j,j)
+  
+  for(uword j=0; j < N; ++j)
+    {
+    const T   A_jj  = access::tmp_real(A_mem[j + j*N]);
+    const eT* A_col = &A_mem[j*N];
+    
+    for(uword i=(j+1); i < N; ++i)
+      {
+      const eT A_ij = A_col[i];
+      const eT A_ji = A_mem[j + i*N];
+      
+      const T A_ij_abs = std::abs(A_ij);
+      
+      if(A_ij_abs >= max_diag)  { return false; }
+      
+      const T A_ii = access::tmp_real(A_mem[i + i*N]);
+      
+      if( (A_ij_abs + A_ij_abs) >= (A_ii + A_jj) )  { return false; }
+      
+      if( std::abs(A_ij - access::alt_conj(A_ji)) > tol*max_diag )  { return false; }
+      }
+    }
+  
+  return true;
+  }
+
+
+
+}  // end of namespace sympd_helper
+
+
+//! @}
@@ -941,6 +941,266 @@ extern "C"
       arma_fortran_noprefix(arma_dlarnv)(idist, iseed, n, x);
       }
     
+    
+    
+    void arma_fortran_prefix(arma_spotrs)(char* uplo, blas_int* n, blas_int* nrhs,  float* a, blas_int* lda,  float* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_spotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_dpotrs)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dpotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_cpotrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cpotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zpotrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zpotrs)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_spocon)(char* uplo, blas_int* n,  float* a, blas_int* lda,  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_spocon)(uplo, n, a, lda, anorm, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dpocon)(char* uplo, blas_int* n, double* a, blas_int* lda, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dpocon)(uplo, n, a, lda, anorm, rcond, work, iwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_cpocon)(char* uplo, blas_int* n,   void* a, blas_int* lda,  float* anorm,  float* rcond,   void* work,  float* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cpocon)(uplo, n, a, lda, anorm, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_zpocon)(char* uplo, blas_int* n,   void* a, blas_int* lda, double* anorm, double* rcond,   void* work, double* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zpocon)(uplo, n, a, lda, anorm, rcond, work, rwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_ssycon)(char* uplo, blas_int* n,  float* a, blas_int* lda, blas_int* ipiv,  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_ssycon)(uplo, n, a, lda, ipiv, anorm, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dsycon)(char* uplo, blas_int* n, double* a, blas_int* lda, blas_int* ipiv, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dsycon)(uplo, n, a, lda, ipiv, anorm, rcond, work, iwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_chetrf)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv,   void* work, blas_int* lwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_chetrf)(uplo, n, a, lda, ipiv, work, lwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_zhetrf)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv,   void* work, blas_int* lwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zhetrf)(uplo, n, a, lda, ipiv, work, lwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_chetrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_chetrs)(uplo, n, nrhs, a, lda, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zhetrs)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zhetrs)(uplo, n, nrhs, a, lda, ipiv, b, ldb, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_checon)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv,  float* anorm,  float* rcond,   void* work, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_checon)(uplo, n, a, lda, ipiv, anorm, rcond, work, info);
+      }
+    
+    void arma_fortran_prefix(arma_zhecon)(char* uplo, blas_int* n,   void* a, blas_int* lda, blas_int* ipiv, double* anorm, double* rcond,   void* work, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zhecon)(uplo, n, a, lda, ipiv, anorm, rcond, work, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_strcon)(char* norm, char* uplo, char* diag, blas_int* n,  float* a, blas_int* lda,  float* rcond,  float* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_strcon)(norm, uplo, diag, n, a, lda, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dtrcon)(char* norm, char* uplo, char* diag, blas_int* n, double* a, blas_int* lda, double* rcond, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dtrcon)(norm, uplo, diag, n, a, lda, rcond, work, iwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_ctrcon)(char* norm, char* uplo, char* diag, blas_int* n,   void* a, blas_int* lda,  float* rcond,   void* work,  float* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_ctrcon)(norm, uplo, diag, n, a, lda, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_ztrcon)(char* norm, char* uplo, char* diag, blas_int* n,   void* a, blas_int* lda, double* rcond,   void* work, double* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_ztrcon)(norm, uplo, diag, n, a, lda, rcond, work, rwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_sgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku,  float* ab, blas_int* ldab, blas_int* ipiv, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sgbtrf)(m, n, kl, ku, ab, ldab, ipiv, info);
+      }
+    
+    void arma_fortran_prefix(arma_dgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku, double* ab, blas_int* ldab, blas_int* ipiv, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dgbtrf)(m, n, kl, ku, ab, ldab, ipiv, info);
+      }
+    
+    void arma_fortran_prefix(arma_cgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cgbtrf)(m, n, kl, ku, ab, ldab, ipiv, info);
+      }
+    
+    void arma_fortran_prefix(arma_zgbtrf)(blas_int* m, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zgbtrf)(m, n, kl, ku, ab, ldab, ipiv, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_sgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs,  float* ab, blas_int* ldab, blas_int* ipiv,  float* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sgbtrs)(trans, n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_dgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs, double* ab, blas_int* ldab, blas_int* ipiv, double* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dgbtrs)(trans, n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_cgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs,   void* ab, blas_int* ldab, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cgbtrs)(trans, n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zgbtrs)(char* trans, blas_int* n, blas_int* kl, blas_int* ku, blas_int* nrhs,   void* ab, blas_int* ldab, blas_int* ipiv,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zgbtrs)(trans, n, kl, ku, nrhs, ab, ldab, ipiv, b, ldb, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_sgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku,  float* ab, blas_int* ldab, blas_int* ipiv,  float* anorm,  float* rcond,  float* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku, double* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, iwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_cgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv,  float* anorm,  float* rcond,   void* work,  float* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_zgbcon)(char* norm, blas_int* n, blas_int* kl, blas_int* ku,   void* ab, blas_int* ldab, blas_int* ipiv, double* anorm, double* rcond,   void* work, double* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zgbcon)(norm, n, kl, ku, ab, ldab, ipiv, anorm, rcond, work, rwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_sposv)(char* uplo, blas_int* n, blas_int* nrhs,  float* a, blas_int* lda,  float* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_dposv)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_cposv)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    void arma_fortran_prefix(arma_zposv)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zposv)(uplo, n, nrhs, a, lda, b, ldb, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_sposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs,  float* a, blas_int* lda,  float* af, blas_int* ldaf, char* equed,  float* s,  float* b, blas_int* ldb,  float* x, blas_int* ldx,  float* rcond,  float* ferr,  float* berr,  float* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_sposvx)(fact, uplo, n, nrhs, a, lda, af, ldaf, equed, s, b, ldb, x, ldx, rcond, ferr, berr, work, iwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_dposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* af, blas_int* ldaf, char* equed, double* s, double* b, blas_int* ldb, double* x, blas_int* ldx, double* rcond, double* ferr, double* berr, double* work, blas_int* iwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dposvx)(fact, uplo, n, nrhs, a, lda, af, ldaf, equed, s, b, ldb, x, ldx, rcond, ferr, berr, work, iwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_cposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* af, blas_int* ldaf, char* equed,  float* s,   void* b, blas_int* ldb,   void* x, blas_int* ldx,  float* rcond,  float* ferr,  float* berr,   void* work,  float* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_cposvx)(fact, uplo, n, nrhs, a, lda, af, ldaf, equed, s, b, ldb, x, ldx, rcond, ferr, berr, work, rwork, info);
+      }
+    
+    void arma_fortran_prefix(arma_zposvx)(char* fact, char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* af, blas_int* ldaf, char* equed, double* s,   void* b, blas_int* ldb,   void* x, blas_int* ldx, double* rcond, double* ferr, double* berr,   void* work, double* rwork, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zposvx)(fact, uplo, n, nrhs, a, lda, af, ldaf, equed, s, b, ldb, x, ldx, rcond, ferr, berr, work, rwork, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_dsgesv)(blas_int* n, blas_int* nrhs, double* a, blas_int* lda, blas_int* ipiv, double* b, blas_int* ldb, double* x, blas_int* ldx, double* work,  float* swork, blas_int* iter, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dsgesv)(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, work, swork, iter, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_zcgesv)(blas_int* n, blas_int* nrhs,   void* a, blas_int* lda, blas_int* ipiv,   void* b, blas_int* ldb,   void* x, blas_int* ldx,   void* work,   void* swork, double* rwork, blas_int* iter, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zcgesv)(n, nrhs, a, lda, ipiv, b, ldb, x, ldx, work, swork, rwork, iter, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_dsposv)(char* uplo, blas_int* n, blas_int* nrhs, double* a, blas_int* lda, double* b, blas_int* ldb, double* x, blas_int* ldx, double* work,  float* swork, blas_int* iter, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_dsposv)(uplo, n, nrhs, a, lda, b, ldb, x, ldx, work, swork, iter, info);
+      }
+    
+    
+    
+    void arma_fortran_prefix(arma_zcposv)(char* uplo, blas_int* n, blas_int* nrhs,   void* a, blas_int* lda,   void* b, blas_int* ldb,   void* x, blas_int* ldx,   void* work,   void* swork, double* rwork, blas_int* iter, blas_int* info)
+      {
+      arma_fortran_noprefix(arma_zcposv)(uplo, n, nrhs, a, lda, b, ldb, x, ldx, work, swork, rwork, iter, info);
+      }
+    
   #endif
   
   
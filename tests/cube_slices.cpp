@@ -0,0 +1,161 @@
+// Copyright 2017 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2017 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("cube_slices_inv_det")
+  {
+  arma_rng::set_seed(123);
+  
+  for(uword N=1; N <= 7; ++N)
+    {
+    cube X(N, N, 60, fill::randu);
+    
+    for(uword s=0; s < X.n_slices; ++s)  { X.slice(s).diag() += double(N); }
+    
+    const cube Y = inv(X);
+    const  vec d = det(X);
+    
+    REQUIRE( Y.n_rows   == N  );
+    REQUIRE( Y.n_cols   == N  );
+    REQUIRE( Y.n_slices == 60 );
+    REQUIRE( d.n_elem   == 60 );
+    
+    for(uword s=0; s < X.n_slices; ++s)
+      {
+      REQUIRE( approx_equal(Y.slice(s), inv(X.slice(s)), "absdiff", 1e-10) );
+      
+      REQUIRE( std::abs(d(s) - det(X.slice(s))) <= 1e-10 * std::abs(d(s)) );
+      }
+    }
+  
+  cube X(3, 3, 20, fill::randu);
+  
+  X.slice(7).zeros();
+  
+  cube Y;
+  
+  REQUIRE_THROWS( Y = inv(X) );
+  
+  REQUIRE( inv(Y, X) == false );
+  REQUIRE( Y.is_empty() );
+  }
+
+
+
+TEST_CASE("cube_slices_chol")
+  {
+  arma_rng::set_seed(123);
+  
+  for(uword N=1; N <= 6; ++N)
+    {
+    cube X(N, N, 40);
+    
+    for(uword s=0; s < X.n_slices; ++s)
+      {
+      const mat T(N, N, fill::randu);
+      
+      X.slice(s) = T.t()*T + 0.5*eye(N,N);
+      }
+    
+    const cube R = chol(X);
+    const cube L = chol(X, "lower");
+    
+    for(uword s=0; s < X.n_slices; ++s)
+      {
+      REQUIRE( approx_equal(R.slice(s), chol(X.slice(s)),          "absdiff", 1e-10) );
+      REQUIRE( approx_equal(L.slice(s), chol(X.slice(s), "lower"), "absdiff", 1e-10) );
+      }
+    }
+  
+  cx_cube Z(3, 3, 30);
+  
+  for(uword s=0; s < Z.n_slices; ++s)
+    {
+    const cx_mat T(3, 3, fill::randu);
+    
+    Z.slice(s) = T.t()*T + 0.5*eye(3,3);
+    }
+  
+  cx_cube RZ;
+  
+  REQUIRE( chol(RZ, Z) );
+  
+  for(uword s=0; s < Z.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(RZ.slice(s), chol(Z.slice(s)), "absdiff", 1e-10) );
+    }
+  
+  Z.slice(4) = -eye<cx_mat>(3,3);
+  
+  REQUIRE_THROWS( RZ = chol(Z) );
+  }
+
+
+
+TEST_CASE("cube_slices_solve_mul")
+  {
+  arma_rng::set_seed(123);
+  
+  for(uword N=1; N <= 6; ++N)
+    {
+    cube A(N, N, 50, fill::randu);
+    cube B(N, 3, 50, fill::randu);
+    
+    for(uword s=0; s < A.n_slices; ++s)  { A.slice(s).diag() += double(N); }
+    
+    const cube X = solve(A, B);
+    const cube C = mul_slices(A, X);
+    
+    REQUIRE( X.n_rows   == N  );
+    REQUIRE( X.n_cols   == 3  );
+    REQUIRE( X.n_slices == 50 );
+    
+    for(uword s=0; s < A.n_slices; ++s)
+      {
+      REQUIRE( approx_equal(X.slice(s), solve(A.slice(s), B.slice(s)), "absdiff", 1e-10) );
+      }
+    
+    REQUIRE( approx_equal(C, B, "absdiff", 1e-10) );
+    }
+  
+  cube A(4, 2, 30, fill::randu);
+  cube B(2, 5, 30, fill::randu);
+  
+  cube C = mul_slices(A, B);
+  
+  for(uword s=0; s < A.n_slices; ++s)
+    {
+    REQUIRE( approx_equal(C.slice(s), A.slice(s)*B.slice(s), "absdiff", 1e-12) );
+    }
+  
+  // aliasing
+  
+  cube D = B;
+  
+  D = mul_slices(A, D);
+  
+  REQUIRE( approx_equal(C, D, "absdiff", 1e-12) );
+  
+  cube E(4, 4, 30, fill::randu);
+  
+  REQUIRE_THROWS( C = mul_slices(A, E) );
+  }
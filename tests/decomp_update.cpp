@@ -0,0 +1,193 @@
+// Copyright 2015 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2015 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+// largest magnitude of the elements below the main diagonal
+template<typename eT>
+static
+double
+below_diag_max(const Mat<eT>& R)
+  {
+  double val = 0.0;
+  
+  for(uword col=0; col < R.n_cols; ++col)
+  for(uword row=col+1; row < R.n_rows; ++row)
+    {
+    val = (std::max)(val, double(std::abs(R.at(row,col))));
+    }
+  
+  return val;
+  }
+
+
+TEST_CASE("decomp_chol_update")
+  {
+  mat X = randu<mat>(20, 8);
+  mat A = X.t() * X + 0.1 * eye<mat>(8, 8);
+  vec x = randu<vec>(8);
+  
+  mat R = chol(A);
+  
+  REQUIRE( chol_update(R, x) );
+  
+  REQUIRE( below_diag_max(R) == 0.0 );
+  REQUIRE( approx_equal(R.t()*R, mat(A + x*x.t()), "reldiff", 1e-10) );
+  
+  REQUIRE( chol_update(R, x, "-") );
+  
+  REQUIRE( approx_equal(R, mat(chol(A)), "reldiff", 1e-10) );
+  
+  // lower layout
+  
+  mat L = chol(A, "lower");
+  
+  REQUIRE( chol_update(L, x, "+", "lower") );
+  
+  REQUIRE( approx_equal(L*L.t(), mat(A + x*x.t()), "reldiff", 1e-10) );
+  
+  // complex
+  
+  cx_mat Y = randu<cx_mat>(20, 6);
+  cx_mat B = Y.t() * Y;
+  cx_vec y = randu<cx_vec>(6);
+  
+  cx_mat S = chol(B);
+  
+  REQUIRE( chol_update(S, y) );
+  
+  REQUIRE( approx_equal(S.t()*S, cx_mat(B + y*y.t()), "reldiff", 1e-10) );
+  
+  REQUIRE( chol_update(S, y, "-") );
+  
+  REQUIRE( approx_equal(S.t()*S, B, "reldiff", 1e-10) );
+  
+  // failed downdate leaves the factor unchanged
+  
+  mat R2 = chol(A);
+  mat R3 = R2;
+  
+  vec z = 10.0 * ones<vec>(8);
+  
+  REQUIRE( chol_update(R3, z, "-") == false );
+  
+  REQUIRE( approx_equal(R3, R2, "absdiff", 0.0) );
+  
+  REQUIRE_THROWS( chol_update(R3, ones<vec>(5)) );
+  REQUIRE_THROWS( chol_update(R3, x, "*") );
+  }
+
+
+
+TEST_CASE("decomp_qr_insert_delete")
+  {
+  mat X = randu<mat>(10, 6);
+  
+  mat Q;
+  mat R;
+  
+  REQUIRE( qr(Q, R, X) );
+  
+  // columns
+  
+  vec x = randu<vec>(10);
+  
+  mat X2 = X;
+  X2.insert_cols(2, x);
+  
+  qr_insert(Q, R, 2, x);
+  
+  REQUIRE( Q.n_rows == 10 );
+  REQUIRE( Q.n_cols == 10 );
+  REQUIRE( R.n_rows == 10 );
+  REQUIRE( R.n_cols == 7  );
+  
+  REQUIRE( approx_equal(Q*R, X2, "absdiff", 1e-10) );
+  REQUIRE( approx_equal(Q.t()*Q, eye<mat>(10,10), "absdiff", 1e-10) );
+  REQUIRE( below_diag_max(R) == 0.0 );
+  
+  qr_insert(Q, R, 7, x);
+  X2.insert_cols(7, x);
+  
+  REQUIRE( approx_equal(Q*R, X2, "absdiff", 1e-10) );
+  
+  qr_delete(Q, R, 0);
+  X2.shed_col(0);
+  
+  REQUIRE( approx_equal(Q*R, X2, "absdiff", 1e-10) );
+  REQUIRE( below_diag_max(R) == 0.0 );
+  
+  // rows
+  
+  rowvec r = randu<rowvec>(X2.n_cols);
+  
+  qr_insert(Q, R, 4, r, "row");
+  X2.insert_rows(4, r);
+  
+  REQUIRE( Q.n_rows == 11 );
+  REQUIRE( R.n_rows == 11 );
+  
+  REQUIRE( approx_equal(Q*R, X2, "absdiff", 1e-10) );
+  REQUIRE( approx_equal(Q.t()*Q, eye<mat>(11,11), "absdiff", 1e-10) );
+  REQUIRE( below_diag_max(R) == 0.0 );
+  
+  qr_insert(Q, R, 11, r, "row");
+  X2.insert_rows(11, r);
+  
+  REQUIRE( approx_equal(Q*R, X2, "absdiff", 1e-10) );
+  
+  qr_delete(Q, R, 3, "row");
+  X2.shed_row(3);
+  
+  qr_delete(Q, R, 0, "row");
+  X2.shed_row(0);
+  
+  REQUIRE( Q.n_rows == 10 );
+  REQUIRE( R.n_rows == 10 );
+  
+  REQUIRE( approx_equal(Q*R, X2, "absdiff", 1e-10) );
+  REQUIRE( approx_equal(Q.t()*Q, eye<mat>(10,10), "absdiff", 1e-10) );
+  REQUIRE( below_diag_max(R) == 0.0 );
+  
+  // complex
+  
+  cx_mat Y = randu<cx_mat>(8, 5);
+  
+  cx_mat P;
+  cx_mat S;
+  
+  REQUIRE( qr(P, S, Y) );
+  
+  cx_vec y = randu<cx_vec>(8);
+  
+  qr_insert(P, S, 1, y);
+  Y.insert_cols(1, y);
+  
+  REQUIRE( approx_equal(P*S, Y, "absdiff", 1e-10) );
+  
+  qr_delete(P, S, 5, "row");
+  Y.shed_row(5);
+  
+  REQUIRE( approx_equal(P*S, Y, "absdiff", 1e-10) );
+  REQUIRE( approx_equal(P.t()*P, eye<cx_mat>(7,7), "absdiff", 1e-10) );
+  
+  REQUIRE_THROWS( qr_delete(P, S, 10) );
+  REQUIRE_THROWS( qr_insert(P, S, 0, y) );
+  }
@@ -73,3 +73,22 @@ TEST_CASE("fn_cov_2")
   REQUIRE( accu(abs(cov(A,B) - AB)) == Approx(0.0) );
   REQUIRE( accu(abs(cov(A,C) - AC)) == Approx(0.0) );
   }
+
+
+
+TEST_CASE("fn_cov_3")
+  {
+  mat A = randu<mat>(500, 6);
+  mat B = A + 1e7;
+  
+  mat AA = cov(A);
+  mat BB = cov(B);
+  
+  REQUIRE( accu(abs(AA - trans(AA))) == Approx(0.0) );
+  REQUIRE( accu(abs(BB - AA)) == Approx(0.0) );
+  
+  mat C = cor(B);
+  
+  REQUIRE( accu(abs(C - cor(A))) == Approx(0.0) );
+  REQUIRE( accu(abs(C.diag() - ones<vec>(6))) == Approx(0.0) );
+  }
@@ -451,3 +451,78 @@ TEST_CASE("fn_eigs_gen_even_complex_test")
       }
     }
   }
+
+
+
+TEST_CASE("fn_eigs_gen_shift_test")
+  {
+  const uword n_rows = 100;
+  
+  sp_mat m(n_rows, n_rows);
+  for (uword i = 0; i < n_rows; ++i)
+    {
+    m(i, i) = double(i + 1);
+    if (i + 1 < n_rows) { m(i, i + 1) = 0.5; m(i + 1, i) = -0.3; }
+    if (i + 3 < n_rows) { m(i, i + 3) = 0.2; }
+    }
+  
+  const cx_vec eigval = eig_gen(mat(m));
+  
+  const double sigma = 20.3;
+  
+  cx_vec sp_eigval;
+  cx_mat sp_eigvec;
+  REQUIRE( eigs_gen(sp_eigval, sp_eigvec, m, 4, sigma) );
+  REQUIRE( sp_eigval.n_elem == 4 );
+  
+  // each eigenvalue found must be among the 4 dense eigenvalues closest to sigma
+  const uvec indices = sort_index(abs(eigval - sigma));
+  
+  for (uword i = 0; i < 4; ++i)
+    {
+    double min_dist = datum::inf;
+    for (uword k = 0; k < 4; ++k)
+      {
+      min_dist = (std::min)(min_dist, std::abs(sp_eigval[i] - eigval[indices[k]]));
+      }
+    REQUIRE( min_dist < 1e-8 );
+    }
+  
+  const cx_mat md = conv_to<cx_mat>::from(mat(m));
+  
+  REQUIRE( norm(md * sp_eigvec - sp_eigvec * diagmat(sp_eigval)) < 1e-8 );
+  }
+
+
+
+TEST_CASE("fn_eigs_gen_pair_test")
+  {
+  const uword n_rows = 60;
+  
+  sp_mat A(n_rows, n_rows);
+  sp_mat B(n_rows, n_rows);
+  for (uword i = 0; i < n_rows; ++i)
+    {
+    A(i, i) = 2.0 + 0.1 * i;
+    B(i, i) = 3.0;
+    if (i + 1 < n_rows) { A(i, i + 1) = -1.0; B(i + 1, i) = 0.5; }
+    }
+  
+  const cx_mat Ad = conv_to<cx_mat>::from(mat(A));
+  const cx_mat Bd = conv_to<cx_mat>::from(mat(B));
+  
+  cx_vec sp_eigval;
+  cx_mat sp_eigvec;
+  
+  REQUIRE( eigs_gen(sp_eigval, sp_eigvec, A, B, 4, "lm") );
+  REQUIRE( sp_eigval.n_elem == 4 );
+  REQUIRE( norm(Ad * sp_eigvec - Bd * sp_eigvec * diagmat(sp_eigval)) < 1e-8 );
+  
+  REQUIRE( eigs_gen(sp_eigval, sp_eigvec, A, B, 4, 1.0) );
+  REQUIRE( sp_eigval.n_elem == 4 );
+  REQUIRE( norm(Ad * sp_eigvec - Bd * sp_eigvec * diagmat(sp_eigval)) < 1e-8 );
+  
+  const cx_vec eigval = eig_pair(mat(A), mat(B));
+  
+  REQUIRE( min(abs(eigval - 1.0)) == Approx(min(abs(sp_eigval - 1.0))) );
+  }
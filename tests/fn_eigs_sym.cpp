@@ -137,3 +137,97 @@ TEST_CASE("fn_eigs_sm_test")
       }
     }
   }
+
+
+
+TEST_CASE("fn_eigs_sym_shift_test")
+  {
+  // 2D Laplacian on a 20x20 grid; its smallest eigenvalues are clustered near zero
+  const uword m = 20;
+  
+  sp_mat T(m, m);
+  for (uword i = 0; i < m; ++i)
+    {
+    T(i, i) = 2.0;
+    if (i + 1 < m) { T(i, i + 1) = -1.0; T(i + 1, i) = -1.0; }
+    }
+  
+  const sp_mat I = speye<sp_mat>(m, m);
+  const sp_mat A = kron(T, I) + kron(I, T);
+  
+  const vec eigval = eig_sym(mat(A));
+  
+  const double sigmas[] = { 0.0, 3.9 };
+  
+  for (uword s = 0; s < 2; ++s)
+    {
+    const double sigma = sigmas[s];
+    
+    vec sp_eigval;
+    mat sp_eigvec;
+    REQUIRE( eigs_sym(sp_eigval, sp_eigvec, A, 5, sigma) );
+    REQUIRE( sp_eigval.n_elem == 5 );
+    
+    // the 5 eigenvalues closest to sigma, in ascending order
+    const uvec indices = sort_index(abs(eigval - sigma));
+    const vec  closest = sort( vec(eigval.elem(indices.head(5))) );
+    
+    for (uword i = 0; i < 5; ++i)
+      {
+      REQUIRE( sp_eigval[i] == Approx(closest[i]) );
+      }
+    
+    REQUIRE( norm(A * sp_eigvec - sp_eigvec * diagmat(sp_eigval)) < 1e-8 );
+    }
+  
+  const vec sp_eigval = eigs_sym(A, 3, 0.0);
+  
+  REQUIRE( sp_eigval.n_elem == 3 );
+  REQUIRE( sp_eigval[0] == Approx(eigval[0]) );
+  }
+
+
+
+TEST_CASE("fn_eigs_sym_pair_test")
+  {
+  const uword n = 100;
+  
+  sp_mat A(n, n);
+  sp_mat B(n, n);
+  for (uword i = 0; i < n; ++i)
+    {
+    A(i, i) = 2.0;
+    B(i, i) = 4.0;
+    if (i + 1 < n) { A(i, i + 1) = -1.0; A(i + 1, i) = -1.0; B(i, i + 1) = 1.0; B(i + 1, i) = 1.0; }
+    }
+  
+  const vec eigval = sort( real(eig_pair(mat(A), mat(B))) );
+  
+  vec sp_eigval;
+  mat sp_eigvec;
+  
+  // shift-invert mode: eigenvalues closest to zero
+  REQUIRE( eigs_sym(sp_eigval, sp_eigvec, A, B, 4, 0.0) );
+  REQUIRE( sp_eigval.n_elem == 4 );
+  
+  for (uword i = 0; i < 4; ++i)
+    {
+    REQUIRE( sp_eigval[i] == Approx(eigval[i]) );
+    }
+  
+  REQUIRE( norm(A * sp_eigvec - B * sp_eigvec * diagmat(sp_eigval)) < 1e-8 );
+  
+  // eigenvectors are B-orthonormal
+  REQUIRE( norm(sp_eigvec.t() * B * sp_eigvec - eye(4, 4)) < 1e-8 );
+  
+  // regular mode
+  REQUIRE( eigs_sym(sp_eigval, sp_eigvec, A, B, 4, "la") );
+  REQUIRE( sp_eigval.n_elem == 4 );
+  
+  for (uword i = 0; i < 4; ++i)
+    {
+    REQUIRE( sp_eigval[i] == Approx(eigval[n - 4 + i]) );
+    }
+  
+  REQUIRE( norm(A * sp_eigvec - B * sp_eigvec * diagmat(sp_eigval)) < 1e-8 );
+  }
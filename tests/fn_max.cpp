@@ -734,3 +734,86 @@ TEST_CASE("fn_max_cx_spincompletesubview_row_test")
       }
     }
   }
+
+
+
+TEST_CASE("fn_max_dim_test")
+  {
+  mat A(301, 257, fill::randn);
+  
+  A(17, 3) = A(19, 3) = 100.0;  // ties within a column
+  A(40, 9) = A(40, 2) = 100.0;  // ties within a row
+  
+  const mat  M0 = max(A, 0);
+  const mat  M1 = max(A, 1);
+  const umat I0 = index_max(A, 0);
+  const umat I1 = index_max(A, 1);
+  
+  REQUIRE( M0.n_cols == A.n_cols );
+  REQUIRE( M1.n_rows == A.n_rows );
+  
+  for(uword c=0; c < A.n_cols; ++c)
+    {
+    uword best = 0;
+    for(uword r=1; r < A.n_rows; ++r)  { if(A(r,c) > A(best,c))  { best = r; } }
+    
+    REQUIRE( I0(c) == best );
+    REQUIRE( M0(c) == A(best,c) );
+    }
+  
+  for(uword r=0; r < A.n_rows; ++r)
+    {
+    uword best = 0;
+    for(uword c=1; c < A.n_cols; ++c)  { if(A(r,c) > A(r,best))  { best = c; } }
+    
+    REQUIRE( I1(r) == best );
+    REQUIRE( M1(r) == A(r,best) );
+    }
+  
+  REQUIRE( I0(3)  == 17 );
+  REQUIRE( I1(40) == 2  );
+  
+  // subviews
+  
+  const mat B = A.submat(5, 7, 250, 200);
+  
+  REQUIRE( accu(abs(max(A.submat(5, 7, 250, 200), 0) - max(B, 0))) == 0.0 );
+  REQUIRE( accu(abs(max(A.submat(5, 7, 250, 200), 1) - max(B, 1))) == 0.0 );
+  
+  REQUIRE( accu(index_max(A.submat(5, 7, 250, 200), 0) != index_max(B, 0)) == 0 );
+  REQUIRE( accu(index_max(A.submat(5, 7, 250, 200), 1) != index_max(B, 1)) == 0 );
+  
+  // whole-object reductions
+  
+  vec v(100000, fill::randu);
+  
+  v(777) = 2.0;  v(55555) = 2.0;
+  
+  uword index;
+  
+  REQUIRE( v.max(index) == 2.0 );
+  REQUIRE( index == 777 );
+  REQUIRE( v.index_max() == 777 );
+  REQUIRE( max(v) == 2.0 );
+  }
+
+
+
+TEST_CASE("fn_max_cube_dim_test")
+  {
+  cube C(67, 45, 23, fill::randn);
+  
+  const cube  M0 = max(C, 0);
+  const cube  M1 = max(C, 1);
+  const ucube I0 = index_max(C, 0);
+  const ucube I1 = index_max(C, 1);
+  
+  for(uword s=0; s < C.n_slices; ++s)
+    {
+    REQUIRE( accu(abs(M0.slice(s) - max(C.slice(s), 0))) == 0.0 );
+    REQUIRE( accu(abs(M1.slice(s) - max(C.slice(s), 1))) == 0.0 );
+    
+    REQUIRE( accu(I0.slice(s) != index_max(C.slice(s), 0)) == 0 );
+    REQUIRE( accu(I1.slice(s) != index_max(C.slice(s), 1)) == 0 );
+    }
+  }
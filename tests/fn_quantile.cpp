@@ -0,0 +1,129 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+namespace
+  {
+  // reference implementation, using a fully sorted copy
+  double
+  ref_quantile(const vec& X, const double p)
+    {
+    const vec Y = sort(X);
+    
+    const double N = double(Y.n_elem);
+    
+    if(p < (0.5 / N))        { return Y(0);            }
+    if(p > ((N - 0.5) / N))  { return Y(Y.n_elem - 1); }
+    
+    const uword  k = uword(std::floor(N*p + 0.5));
+    const double w = (p - (double(k) - 0.5)/N) * N;
+    
+    const double Y_k = (k < Y.n_elem) ? Y(k) : Y(k-1);
+    
+    return (1.0 - w) * Y(k-1) + w * Y_k;
+    }
+  }
+
+
+
+TEST_CASE("fn_quantile_1")
+  {
+  vec a = linspace<vec>(1,10,10);
+  vec P = { 0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0 };
+  
+  vec b = { 1.0, 1.5, 3.0, 5.5, 8.0, 9.5, 10.0 };
+  
+  vec q = quantile(a, P);
+  
+  REQUIRE( q.n_elem == P.n_elem );
+  REQUIRE( accu(abs(q - b)) < 1e-10 );
+  
+  // the median is a special case
+  
+  vec c = randn<vec>(101);
+  
+  REQUIRE( as_scalar(quantile(c, vec{0.5})) == Approx(median(c)) );
+  }
+
+
+
+TEST_CASE("fn_quantile_2")
+  {
+  mat A = randn<mat>(537, 23);
+  vec P = { 0.9, 0.01, 0.5, 0.5, 0.333, 0.99 };  // unsorted, with a repeat
+  
+  mat Q0 = quantile(A, P, 0);
+  mat Q1 = quantile(A, P, 1);
+  
+  REQUIRE( Q0.n_rows == P.n_elem );
+  REQUIRE( Q0.n_cols == A.n_cols );
+  REQUIRE( Q1.n_rows == A.n_rows );
+  REQUIRE( Q1.n_cols == P.n_elem );
+  
+  for(uword col=0; col < A.n_cols; ++col)
+  for(uword i=0;   i   < P.n_elem; ++i  )
+    {
+    REQUIRE( Q0(i,col) == Approx(ref_quantile(A.col(col), P(i))) );
+    }
+  
+  for(uword row=0; row < A.n_rows; row += 37)
+  for(uword i=0;   i   < P.n_elem; ++i      )
+    {
+    REQUIRE( Q1(row,i) == Approx(ref_quantile(A.row(row).t(), P(i))) );
+    }
+  
+  rowvec r = A.row(3);
+  
+  rowvec qr = quantile(r, P.t());
+  
+  REQUIRE( qr.n_elem == P.n_elem );
+  REQUIRE( qr(2) == Approx(ref_quantile(r.t(), 0.5)) );
+  }
+
+
+
+TEST_CASE("fn_quantile_long_vector")
+  {
+  // long enough to use parallel selection when OpenMP is enabled
+  
+  vec a = randn<vec>(300000);
+  vec P = { 0.0, 0.001, 0.25, 0.5, 0.75, 0.999, 1.0 };
+  
+  a(123) = 1e6;  // outlier
+  
+  vec q = quantile(a, P);
+  
+  for(uword i=0; i < P.n_elem; ++i)
+    {
+    REQUIRE( q(i) == Approx(ref_quantile(a, P(i))) );
+    }
+  
+  // data with many repeated values
+  
+  vec b = floor(4 * randu<vec>(300000));
+  
+  vec qb = quantile(b, P);
+  
+  for(uword i=0; i < P.n_elem; ++i)
+    {
+    REQUIRE( qb(i) == Approx(ref_quantile(b, P(i))) );
+    }
+  }
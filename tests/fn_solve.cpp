@@ -0,0 +1,234 @@
+// Copyright 2017 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2017 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("fn_solve_sympd_1")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword N = 40;
+  
+  mat X(N, N, fill::randu);
+  mat A = X.t()*X + 0.1*eye(N,N);  // symmetric positive definite
+  mat B(N, 3, fill::randn);
+  
+  const mat X_ref = solve(A, B, solve_opts::no_sympd);
+  
+  mat X1 = solve(A, B);
+  mat X2 = solve(A, B, solve_opts::fast);
+  mat X3 = solve(A, B, solve_opts::likely_sympd);
+  mat X4 = solve(A, B, solve_opts::likely_sympd + solve_opts::fast);
+  mat X5 = solve(A, B, solve_opts::equilibrate);
+  
+  REQUIRE( norm(X1 - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  REQUIRE( norm(X2 - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  REQUIRE( norm(X3 - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  REQUIRE( norm(X4 - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  REQUIRE( norm(X5 - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  
+  // aliasing of the output with the inputs
+  
+  mat C = B;
+  
+  solve(C, A, C);
+  
+  REQUIRE( norm(C - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  
+  mat D = A;
+  
+  solve(D, D, B, solve_opts::fast);
+  
+  REQUIRE( norm(D - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  }
+
+
+
+TEST_CASE("fn_solve_sympd_2")
+  {
+  arma_rng::set_seed(456);
+  
+  const uword N = 30;
+  
+  // symmetric, passes the cheap checks, but is indefinite: the Cholesky decomposition fails and LU decomposition is used instead
+  
+  mat A(N, N);
+  
+  A.fill(-0.2);
+  A.diag().fill(1.0);
+  
+  vec b(N, fill::randn);
+  
+  vec x1 = solve(A, b);
+  vec x2 = solve(A, b, solve_opts::fast);
+  vec x3 = solve(A, b, solve_opts::likely_sympd + solve_opts::equilibrate);
+  
+  REQUIRE( norm(A*x1 - b) < 1e-10 * norm(b) );
+  REQUIRE( norm(A*x2 - b) < 1e-10 * norm(b) );
+  REQUIRE( norm(A*x3 - b) < 1e-10 * norm(b) );
+  
+  // not symmetric
+  
+  mat C(N, N, fill::randu);  C.diag() += double(N);
+  
+  vec x4 = solve(C, b);
+  
+  REQUIRE( norm(C*x4 - b) < 1e-10 * norm(b) );
+  }
+
+
+
+TEST_CASE("fn_solve_sympd_3")
+  {
+  arma_rng::set_seed(789);
+  
+  const uword N = 25;
+  
+  cx_mat X(N, N, fill::randu);
+  cx_mat A = X.t()*X + 0.1*eye<cx_mat>(N,N);  // hermitian positive definite
+  cx_mat B(N, 2, fill::randn);
+  
+  const cx_mat X_ref = solve(A, B, solve_opts::no_sympd);
+  
+  cx_mat X1 = solve(A, B);
+  cx_mat X2 = solve(A, B, solve_opts::fast);
+  
+  REQUIRE( norm(X1 - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  REQUIRE( norm(X2 - X_ref, "inf") < 1e-8 * norm(X_ref, "inf") );
+  
+  cx_mat H = A;  H.diag() -= cx_double(50.0, 0.0);  // hermitian indefinite
+  
+  cx_mat X3 = solve(H, B, solve_opts::likely_sympd + solve_opts::fast);
+  
+  REQUIRE( norm(H*X3 - B, "inf") < 1e-10 * norm(B, "inf") * norm(H, "inf") );
+  }
+
+
+
+TEST_CASE("fn_solve_sympd_4")
+  {
+  arma_rng::set_seed(246);
+  
+  const uword N = 40;
+  
+  // likely_sympd is only a hint: a non-symmetric A must fall back to LU decomposition on the original A
+  
+  mat A(N, N, fill::randn);  A.diag() += 0.5;
+  vec b(N,    fill::randn);
+  
+  const mat A_orig = A;
+  
+  vec x1 = solve(A, b, solve_opts::likely_sympd + solve_opts::fast);
+  
+  REQUIRE( norm(A*x1 - b, "inf") < 1e-10 * norm(b, "inf") * norm(A, "inf") );
+  REQUIRE( norm(A - A_orig, "inf") == 0.0 );
+  
+  cx_mat C(N, N, fill::randn);  C.diag() += cx_double(0.5, 0.0);
+  cx_vec d(N,    fill::randn);
+  
+  cx_vec z1 = solve(C, d, solve_opts::likely_sympd + solve_opts::fast);
+  
+  REQUIRE( norm(C*z1 - d, "inf") < 1e-10 * norm(d, "inf") * norm(C, "inf") );
+  }
+
+
+
+TEST_CASE("fn_solve_mixed_1")
+  {
+  arma_rng::set_seed(321);
+  
+  const uword N = 150;
+  
+  mat A(N, N, fill::randu);  A.diag() += 2.0;
+  mat S = A.t()*A;
+  mat B(N, 4, fill::randn);
+  
+  const mat X_ref = solve(A, B);
+  const mat Y_ref = solve(S, B);
+  
+  mat X = solve(A, B, solve_opts::mixed_precision);
+  mat Y = solve(S, B, solve_opts::mixed_precision);
+  
+  REQUIRE( norm(X - X_ref, "inf") < 1e-10 * norm(X_ref, "inf") );
+  REQUIRE( norm(Y - Y_ref, "inf") < 1e-10 * norm(Y_ref, "inf") );
+  
+  // badly conditioned: the refinement does not converge and the decomposition is redone in double precision
+  
+  mat H(12, 12);
+  
+  for(uword c=0; c < 12; ++c)
+  for(uword r=0; r < 12; ++r)
+    {
+    H(r,c) = 1.0 / double(r + c + 1);
+    }
+  
+  vec b = H * ones<vec>(12);
+  
+  vec h1 = solve(H, b, solve_opts::mixed_precision + solve_opts::no_sympd);
+  vec h2 = solve(H, b, solve_opts::fast            + solve_opts::no_sympd);
+  
+  REQUIRE( norm(h1 - h2) < 1e-6 * norm(h2) );
+  
+  // complex and single precision
+  
+  cx_mat C(N, N, fill::randu);  C.diag() += cx_double(2.0, 1.0);
+  cx_mat D(N, 2, fill::randn);
+  
+  const cx_mat Z_ref = solve(C, D);
+  
+  cx_mat Z = solve(C, D, solve_opts::mixed_precision);
+  
+  REQUIRE( norm(Z - Z_ref, "inf") < 1e-10 * norm(Z_ref, "inf") );
+  
+  fmat F = conv_to<fmat>::from(A);
+  fmat G = conv_to<fmat>::from(B);
+  
+  fmat W = solve(F, G, solve_opts::mixed_precision);
+  
+  REQUIRE( norm(F*W - G, "inf") < 1e-3f * norm(G, "inf") );
+  }
+
+
+
+TEST_CASE("fn_solve_mixed_2")
+  {
+  arma_rng::set_seed(468);
+  
+  const uword N = 40;
+  
+  // a non-symmetric A with likely_sympd must fall back to LU decomposition on the original A
+  
+  mat A(N, N, fill::randn);  A.diag() += 0.5;
+  vec b(N,    fill::randn);
+  
+  const mat A_orig = A;
+  
+  vec x1 = solve(A, b, solve_opts::likely_sympd + solve_opts::mixed_precision);
+  
+  REQUIRE( norm(A*x1 - b, "inf") < 1e-10 * norm(b, "inf") * norm(A, "inf") );
+  REQUIRE( norm(A - A_orig, "inf") == 0.0 );
+  
+  cx_mat C(N, N, fill::randn);  C.diag() += cx_double(0.5, 0.0);
+  cx_vec d(N,    fill::randn);
+  
+  cx_vec z1 = solve(C, d, solve_opts::likely_sympd + solve_opts::mixed_precision);
+  
+  REQUIRE( norm(C*z1 - d, "inf") < 1e-10 * norm(d, "inf") * norm(C, "inf") );
+  }
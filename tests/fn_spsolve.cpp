@@ -898,3 +898,321 @@ TEST_CASE("fn_spsolve_cx_float_function_test")
   }
 
 #endif
+
+
+
+// iterative solvers don't require SuperLU
+
+sp_mat
+fn_spsolve_laplacian_2d(const uword n)
+  {
+  const uword N = n*n;
+  
+  sp_mat A(N, N);
+  
+  for(uword i=0; i < n; ++i)
+  for(uword j=0; j < n; ++j)
+    {
+    const uword k = i*n + j;
+    
+    A(k,k) = 4.0;
+    
+    if(i > 0)    { A(k, k-n) = -1.0; }
+    if(i < n-1)  { A(k, k+n) = -1.0; }
+    if(j > 0)    { A(k, k-1) = -1.0; }
+    if(j < n-1)  { A(k, k+1) = -1.0; }
+    }
+  
+  return A;
+  }
+
+
+
+TEST_CASE("fn_spsolve_iterative_sym")
+  {
+  const sp_mat A = fn_spsolve_laplacian_2d(20);
+  
+  const vec b = randu<vec>(A.n_rows);
+  
+  iterative_opts opts;
+  
+  opts.tol = 1e-10;
+  
+  vec x;
+  
+  REQUIRE( spsolve(x, A, b, "cg", opts) );
+  
+  REQUIRE( opts.converged );
+  REQUIRE( opts.n_iter > 0 );
+  REQUIRE( opts.rel_resid <= 1e-10 );
+  REQUIRE( norm(b - A*x) <= 1e-10 * norm(b) );
+  
+  REQUIRE( spsolve(x, A, b, "minres", opts) );
+  REQUIRE( norm(b - A*x) <= 1e-10 * norm(b) );
+  
+  // symmetric indefinite
+  
+  const sp_mat C = A - 2.5 * speye<sp_mat>(A.n_rows, A.n_cols);
+  
+  REQUIRE( spsolve(x, C, b, "minres", opts) );
+  REQUIRE( norm(b - C*x) <= 1e-10 * norm(b) );
+  
+  // warm start from a converged solution
+  
+  opts.warm_start = true;
+  
+  REQUIRE( spsolve(x, C, b, "minres", opts) );
+  REQUIRE( opts.n_iter == 0 );
+  }
+
+
+
+TEST_CASE("fn_spsolve_iterative_gen")
+  {
+  sp_mat A = sprandu<sp_mat>(300, 300, 0.02);
+  
+  A.diag() += 10.0;
+  
+  const mat B = randu<mat>(A.n_rows, 3);
+  
+  iterative_opts opts;
+  
+  opts.tol = 1e-10;
+  
+  mat X;
+  
+  REQUIRE( spsolve(X, A, B, "bicgstab", opts) );
+  REQUIRE( X.n_rows == 300 );
+  REQUIRE( X.n_cols == 3   );
+  REQUIRE( norm(B - A*X, "fro") <= 1e-9 * norm(B, "fro") );
+  
+  opts.restart = 10;
+  
+  X = spsolve(A, B, "gmres", opts);
+  
+  REQUIRE( opts.converged );
+  REQUIRE( norm(B - A*X, "fro") <= 1e-9 * norm(B, "fro") );
+  
+  // iteration limit
+  
+  opts.max_iter = 2;
+  
+  REQUIRE( spsolve(X, A, B, "gmres", opts) == false );
+  REQUIRE( opts.converged == false );
+  REQUIRE( X.n_elem == 0 );
+  }
+
+
+
+TEST_CASE("fn_spsolve_iterative_cx")
+  {
+  const sp_mat L = fn_spsolve_laplacian_2d(10);
+  
+  // hermitian positive definite
+  
+  sp_cx_mat A(L, L * 0.0);
+  
+  for(uword k=0; k+1 < A.n_rows; ++k)
+    {
+    A(k,   k+1) = cx_double(-1.0, 0.5);
+    A(k+1, k  ) = cx_double(-1.0,-0.5);
+    }
+  
+  A.diag() += cx_double(3.0, 0.0);
+  
+  const cx_vec b = randu<cx_vec>(A.n_rows);
+  
+  iterative_opts opts;
+  
+  opts.tol = 1e-10;
+  
+  cx_vec x;
+  
+  REQUIRE( spsolve(x, A, b, "cg", opts) );
+  REQUIRE( norm(b - A*x) <= 1e-10 * norm(b) );
+  
+  // general complex
+  
+  A(0, 5) = cx_double(0.5, 2.0);
+  
+  REQUIRE( spsolve(x, A, b, "gmres", opts) );
+  REQUIRE( norm(b - A*x) <= 1e-10 * norm(b) );
+  
+  REQUIRE( spsolve(x, A, b, "bicgstab", opts) );
+  REQUIRE( norm(b - A*x) <= 1e-10 * norm(b) );
+  }
+
+
+
+TEST_CASE("fn_spsolve_precond_exact")
+  {
+  // tridiagonal matrices have no fill-in, so the incomplete factorisations are exact
+  
+  const uword N = 50;
+  
+  sp_mat A(N, N);
+  
+  for(uword i=0; i < N; ++i)
+    {
+    A(i,i) = 4.0;
+    
+    if(i > 0)    { A(i, i-1) = -1.0; }
+    if(i < N-1)  { A(i, i+1) = -1.5; }
+    }
+  
+  const vec r = randu<vec>(N);
+  
+  const vec x = solve(mat(A), r);
+  
+  sp_precond<double> P_ilu0(A, "ilu0");
+  sp_precond<double> P_ilut(A, "ilut", 0.0, N);
+  
+  vec z;
+  
+  P_ilu0.apply(z, r);
+  
+  REQUIRE( norm(z - x) < 1e-12 * norm(x) );
+  REQUIRE( norm(P_ilut.apply(r) - x) < 1e-12 * norm(x) );
+  
+  const sp_mat S = symmatu(A);
+  
+  sp_precond<double> P_ic0(S, "ic0");
+  
+  REQUIRE( norm(P_ic0.apply(r) - solve(mat(S), r)) < 1e-12 * norm(x) );
+  
+  sp_precond<double> P_jacobi(A, "jacobi");
+  
+  REQUIRE( norm(P_jacobi.apply(r) - r / 4.0) < 1e-14 );
+  
+  REQUIRE( P_jacobi.n_nonzero() == N );
+  REQUIRE( P_ilu0.n_nonzero() == A.n_nonzero );
+  
+  // singular
+  
+  sp_mat C = A;
+  
+  C(0,0) = 0.0;
+  
+  sp_precond<double> P;
+  
+  REQUIRE( P.factorise(C, "ilu0") == false );
+  REQUIRE( P.is_empty() );
+  }
+
+
+
+TEST_CASE("fn_spsolve_precond_ilu0_banded")
+  {
+  // ILU(0) of a banded matrix with a full band is the exact LU factorisation,
+  // so applying the preconditioner to A gives the identity;
+  // the sizes are chosen so that the number of non-zeros exceeds the number of rows
+  
+  for(uword bw=1; bw <= 2; ++bw)
+  for(uword N=5; N <= 20; ++N)
+    {
+    sp_mat A(N, N);
+    
+    for(uword i=0; i < N; ++i)
+    for(uword j=0; j < N; ++j)
+      {
+      if( (i == j) || ((i > j) && (i-j <= bw)) || ((j > i) && (j-i <= bw)) )
+        {
+        A(i,j) = (i == j) ? 6.0 : -1.0 - 0.1*double(i) + 0.05*double(j);
+        }
+      }
+    
+    sp_precond<double> P(A, "ilu0");
+    
+    REQUIRE( P.is_empty() == false );
+    
+    const mat Z = P.apply(mat(A));
+    
+    REQUIRE( norm(Z - eye<mat>(N,N), "fro") < 1e-12 );
+    }
+  }
+
+
+
+TEST_CASE("fn_spsolve_precond_iterative")
+  {
+  const sp_mat A = fn_spsolve_laplacian_2d(30);
+  
+  const mat B = randu<mat>(A.n_rows, 2);
+  
+  iterative_opts opts;
+  
+  opts.tol = 1e-10;
+  
+  mat X;
+  
+  REQUIRE( spsolve(X, A, B, "cg", opts) );
+  
+  const unsigned int n_iter_plain = opts.n_iter;
+  
+  // factorise once, use many times
+  
+  const sp_precond<double> P_ic0(A, "ic0");
+  
+  REQUIRE( spsolve(X, A, B, "cg", opts, P_ic0) );
+  REQUIRE( opts.n_iter < n_iter_plain );
+  REQUIRE( norm(B - A*X, "fro") <= 1e-10 * norm(B, "fro") );
+  
+  REQUIRE( spsolve(X, A, B, "minres", opts, P_ic0) );
+  REQUIRE( norm(B - A*X, "fro") <= 1e-10 * norm(B, "fro") );
+  
+  // non-symmetric
+  
+  sp_mat C = A;
+  
+  C.diag( 1) *= 1.5;
+  C.diag(-1) *= 0.5;
+  
+  REQUIRE( spsolve(X, C, B, "gmres", opts) );
+  
+  const unsigned int n_iter_gmres = opts.n_iter;
+  
+  const sp_precond<double> P_ilu0(C, "ilu0");
+  const sp_precond<double> P_ilut(C, "ilut", 1e-3, 5);
+  
+  X = spsolve(C, B, "gmres", opts, P_ilu0);
+  
+  REQUIRE( opts.n_iter < n_iter_gmres );
+  REQUIRE( norm(B - C*X, "fro") <= 1e-10 * norm(B, "fro") );
+  
+  REQUIRE( spsolve(X, C, B, "bicgstab", opts, P_ilut) );
+  REQUIRE( norm(B - C*X, "fro") <= 1e-10 * norm(B, "fro") );
+  
+  REQUIRE( spsolve(X, C, B, "gmres", opts, sp_precond<double>(C, "jacobi")) );
+  REQUIRE( norm(B - C*X, "fro") <= 1e-10 * norm(B, "fro") );
+  }
+
+
+
+TEST_CASE("fn_spsolve_precond_cx")
+  {
+  const sp_mat L = fn_spsolve_laplacian_2d(10);
+  
+  sp_cx_mat A(L, L * 0.0);
+  
+  for(uword k=0; k+1 < A.n_rows; ++k)
+    {
+    A(k,   k+1) = cx_double(-0.5, 0.5);
+    A(k+1, k  ) = cx_double(-0.5,-0.5);
+    }
+  
+  A.diag() += cx_double(2.0, 0.0);
+  
+  const cx_vec b = randu<cx_vec>(A.n_rows);
+  
+  iterative_opts opts;
+  
+  opts.tol = 1e-10;
+  
+  cx_vec x;
+  
+  REQUIRE( spsolve(x, A, b, "cg", opts, sp_precond<cx_double>(A, "ic0")) );
+  REQUIRE( norm(b - A*x) <= 1e-10 * norm(b) );
+  
+  REQUIRE( spsolve(x, A, b, "gmres", opts, sp_precond<cx_double>(A, "ilut", 1e-4, 10)) );
+  REQUIRE( norm(b - A*x) <= 1e-10 * norm(b) );
+  }
@@ -547,3 +547,38 @@ TEST_CASE("fn_var_sparse_alias_test")
     REQUIRE( d[i] == Approx((double) s[i]) );
     }
   }
+
+
+
+TEST_CASE("fn_var_dense_offset_test")
+  {
+  // a large common offset must not affect the variance
+  mat A = randu<mat>(1000, 20);
+  mat B = A + 1e8;
+
+  rowvec a0 = var(A);
+  rowvec b0 = var(B);
+
+  vec a1 = var(A, 0, 1);
+  vec b1 = var(B, 0, 1);
+  vec c1 = trans(var(trans(A)));
+
+  REQUIRE( b0.n_elem == 20   );
+  REQUIRE( b1.n_elem == 1000 );
+
+  for (uword i = 0; i < a0.n_elem; ++i)
+    {
+    REQUIRE( b0[i] == Approx(a0[i]).epsilon(1e-4) );
+    }
+
+  for (uword i = 0; i < a1.n_elem; ++i)
+    {
+    REQUIRE( a1[i] == Approx(c1[i]) );
+    REQUIRE( b1[i] == Approx(a1[i]).epsilon(1e-4) );
+    }
+
+  vec x = linspace<vec>(1, 100000, 100000) + 1e9;
+
+  REQUIRE( var(x)    == Approx(833341666.6666666) );
+  REQUIRE( var(x, 1) == Approx(833333333.25) );
+  }
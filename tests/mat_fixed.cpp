@@ -0,0 +1,125 @@
+// Copyright 2017 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2017 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+TEST_CASE("mat_fixed_mul")
+  {
+  arma_rng::set_seed(123);
+  
+  mat::fixed<5,7> A(fill::randu);
+  mat::fixed<7,3> B(fill::randu);
+  mat::fixed<5,3> E(fill::randu);
+  
+  mat::fixed<5,3> C = A*B;
+  
+  REQUIRE( approx_equal(C, mat(A)*mat(B), "absdiff", 1e-12) );
+  
+  mat::fixed<3,5> D = B.t()*A.t();
+  
+  REQUIRE( approx_equal(D, mat(B).t()*mat(A).t(), "absdiff", 1e-12) );
+  
+  mat::fixed<7,7> F = A.t()*A;
+  mat::fixed<5,5> G = E*E.t();
+  
+  REQUIRE( approx_equal(F, mat(A).t()*mat(A), "absdiff", 1e-12) );
+  REQUIRE( approx_equal(G, mat(E)*mat(E).t(), "absdiff", 1e-12) );
+  
+  mat88 H(fill::randu);
+  vec::fixed<8> x(fill::randu);
+  
+  vec::fixed<8> y = H*x;
+  
+  REQUIRE( approx_equal(y, mat(H)*vec(x), "absdiff", 1e-12) );
+  
+  // aliasing
+  
+  mat88 K = H;
+  
+  K = K*H;
+  
+  REQUIRE( approx_equal(K, mat(H)*mat(H), "absdiff", 1e-12) );
+  
+  cx_mat::fixed<6,4> P(fill::randu);
+  cx_mat::fixed<6,2> Q(fill::randu);
+  
+  cx_mat::fixed<4,2> R = P.t()*Q;
+  
+  REQUIRE( approx_equal(R, cx_mat(P).t()*cx_mat(Q), "absdiff", 1e-12) );
+  
+  imat::fixed<2,3> S;  S.fill(2);
+  imat::fixed<3,2> T;  T.fill(3);
+  
+  imat::fixed<2,2> U = S*T;
+  
+  REQUIRE( accu(U == 18) == 4 );
+  }
+
+
+
+TEST_CASE("mat_fixed_inv_det")
+  {
+  arma_rng::set_seed(123);
+  
+  for(uword trial=0; trial < 4; ++trial)
+    {
+    mat::fixed<5,5> M5(fill::randu);
+    mat::fixed<8,8> M8(fill::randu);
+    mat             M7(7, 7, fill::randu);
+    
+    cx_mat::fixed<6,6> Z6(fill::randu);
+    
+    REQUIRE( approx_equal(mat(M5*inv(M5)), eye<mat>(5,5), "absdiff", 1e-8) );
+    REQUIRE( approx_equal(mat(M8*inv(M8)), eye<mat>(8,8), "absdiff", 1e-8) );
+    REQUIRE( approx_equal(mat(M7*inv(M7)), eye<mat>(7,7), "absdiff", 1e-8) );
+    
+    REQUIRE( approx_equal(cx_mat(Z6*inv(Z6)), eye<cx_mat>(6,6), "absdiff", 1e-8) );
+    
+    double val;
+    double sign;
+    
+    log_det(val, sign, M8);
+    
+    REQUIRE( std::abs(det(M8) - sign*std::exp(val)) <= 1e-10 * std::exp(val) );
+    
+    log_det(val, sign, M7);
+    
+    REQUIRE( std::abs(det(M7) - sign*std::exp(val)) <= 1e-10 * std::exp(val) );
+    
+    cx_double cx_val;
+    
+    log_det(cx_val, sign, Z6);
+    
+    REQUIRE( std::abs(det(Z6) - sign*std::exp(cx_val)) <= 1e-10 * std::abs(std::exp(cx_val)) );
+    }
+  
+  mat::fixed<6,6> S(fill::randu);
+  
+  S.col(2).zeros();
+  
+  mat::fixed<6,6> T;
+  
+  REQUIRE( det(S) == 0.0 );
+  
+  REQUIRE_THROWS( T = inv(S) );
+  
+  REQUIRE( inv(T, S) == false );
+  }
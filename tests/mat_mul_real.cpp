@@ -925,3 +925,176 @@ TEST_CASE("mat_mul_real_6")
 
 
 
+
+
+
+TEST_CASE("mat_mul_real_7")
+  {
+  // weighted cross products, which use only one triangle of the symmetric result
+  
+  mat A = randu<mat>(40, 7);
+  vec w = randu<vec>(40);
+  vec v = randu<vec>(7);
+  
+  mat AtWA = trans(A) * diagmat(w) * A;
+  mat AVAt = A * diagmat(v) * trans(A);
+  
+  mat AtWA_ref = trans(A) * (A.each_col() % w);
+  mat AVAt_ref = (A.each_row() % v.t()) * trans(A);
+  
+  REQUIRE( AtWA.n_rows == 7  );
+  REQUIRE( AtWA.n_cols == 7  );
+  REQUIRE( AVAt.n_rows == 40 );
+  REQUIRE( AVAt.n_cols == 40 );
+  
+  REQUIRE( accu(abs(AtWA - AtWA_ref)) < 1e-10 );
+  REQUIRE( accu(abs(AVAt - AVAt_ref)) < 1e-10 );
+  
+  REQUIRE( accu(abs(AtWA - AtWA.t())) == 0.0 );
+  
+  // negative weights use the general path
+  
+  w(3) = -2.0;
+  
+  mat AtWA2     = trans(A) * diagmat(w) * A;
+  mat AtWA2_ref = trans(A) * (A.each_col() % w);
+  
+  REQUIRE( accu(abs(AtWA2 - AtWA2_ref)) < 1e-10 );
+  
+  // aliasing
+  
+  mat B = randu<mat>(6, 6);
+  vec u = randu<vec>(6);
+  
+  mat B_ref = trans(B) * (B.each_col() % u);
+  
+  B = trans(B) * diagmat(u) * B;
+  
+  REQUIRE( accu(abs(B - B_ref)) < 1e-10 );
+  
+  // different matrices
+  
+  mat C = randu<mat>(40, 7);
+  
+  mat AtWC     = trans(A) * diagmat(w) * C;
+  mat AtWC_ref = trans(A) * (C.each_col() % w);
+  
+  REQUIRE( accu(abs(AtWC - AtWC_ref)) < 1e-10 );
+  
+  // integer elements use the general path, as sqrt(w) is not exact
+  
+  imat I = { {1, 2}, {3, -1}, {0, 4} };
+  ivec iw = { 2, 3, 5 };
+  
+  imat ItWI     = trans(I) * diagmat(iw) * I;
+  imat ItWI_ref = { {29, -5}, {-5, 91} };
+  
+  REQUIRE( accu(ItWI != ItWI_ref) == 0 );
+  
+  umat U = { {1, 2}, {3, 1}, {0, 4} };
+  uvec uw = { 2, 3, 5 };
+  
+  umat UtWU     = trans(U) * diagmat(uw) * U;
+  umat UtWU_ref = { {29, 13}, {13, 91} };
+  
+  REQUIRE( accu(UtWU != UtWU_ref) == 0 );
+  
+  imat IVIt     = I * diagmat(ivec{2, 3}) * trans(I);
+  imat IVIt_ref = I * (I.each_row() % irowvec{2, 3}).t();
+  
+  REQUIRE( accu(IVIt != IVIt_ref) == 0 );
+  }
+
+
+
+TEST_CASE("mat_mul_real_8")
+  {
+  // long chains, where the order of the multiplications is chosen at run time
+  
+  mat A = randu<mat>(20, 30);
+  mat B = randu<mat>(30, 5);
+  mat C = randu<mat>(5, 40);
+  mat D = randu<mat>(40, 40);
+  mat E = randu<mat>(40, 10);
+  vec x = randu<vec>(10);
+  vec d = randu<vec>(40);
+  
+  mat AB   = A*B;
+  mat ABC  = AB*C;
+  mat ABCD = ABC*D;
+  
+  mat ABCDE  = ABCD*E;
+  vec ABCDEx = ABCDE*x;
+  
+  mat X1 = A*B*C*D;
+  mat X2 = A*B*C*D*E;
+  vec X3 = A*B*C*D*E*x;
+  
+  REQUIRE( X1.n_rows == 20 );
+  REQUIRE( X1.n_cols == 40 );
+  REQUIRE( X3.n_elem == 20 );
+  
+  REQUIRE( approx_equal(X1, ABCD,   "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X2, ABCDE,  "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X3, ABCDEx, "reldiff", 1e-10) );
+  
+  // transposes and scalars
+  
+  mat X4 = 2.0 * E.t() * D.t() * C.t() * B.t() * A.t();
+  
+  REQUIRE( approx_equal(X4, mat(2.0*ABCDE.t()), "reldiff", 1e-10) );
+  
+  rowvec X5 = x.t() * E.t() * D.t() * C.t() * B.t();
+  
+  vec BCDEx = B*(C*(D*(E*x)));
+  
+  REQUIRE( approx_equal(X5, rowvec(BCDEx.t()), "reldiff", 1e-10) );
+  
+  // diagonal matrices within the chain
+  
+  mat Dd = diagmat(d);
+  
+  mat X6 = A*B*C*diagmat(d)*E*x;
+  mat X7 = C*diagmat(d)*D*diagmat(d)*E;
+  mat X8 = A*B*C*diagmat(d);
+  mat X9 = diagmat(d)*D*E*x;
+  
+  REQUIRE( approx_equal(X6, mat(ABC*Dd*E*x),      "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X7, mat(C*(Dd*D)*(Dd*E)), "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X8, mat(ABC*Dd),          "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X9, mat(Dd*(D*(E*x))),    "reldiff", 1e-10) );
+  
+  mat X10 = E.t()*diagmat(d)*diagmat(d)*E*x;
+  
+  REQUIRE( approx_equal(X10, mat(E.t()*(Dd*Dd)*E*x), "reldiff", 1e-10) );
+  
+  // aliasing
+  
+  mat F = D;
+  
+  F = F*D*diagmat(d)*F*E;
+  
+  REQUIRE( approx_equal(F, mat(D*D*Dd*D*E), "reldiff", 1e-10) );
+  
+  // fixed size matrices
+  
+  mat::fixed<4,4> P(fill::randu);
+  vec::fixed<4>   y(fill::randu);
+  
+  mat PPPP = mat(P)*mat(P)*mat(P)*mat(P);
+  
+  vec X12 = P*P*P*P*y;
+  mat X13 = P*P*P*P*P;
+  vec X14 = P.t()*P*mat(P)*P*y;
+  
+  REQUIRE( approx_equal(X12, vec(PPPP*y),          "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X13, mat(PPPP*P),          "reldiff", 1e-10) );
+  REQUIRE( approx_equal(X14, vec(P.t()*P*P*P*y),   "reldiff", 1e-10) );
+  
+  // incompatible sizes
+  
+  mat X11;
+  
+  REQUIRE_THROWS( X11 = A*B*D*E*x );
+  REQUIRE_THROWS( X11 = A*B*diagmat(d)*D );
+  }
@@ -0,0 +1,176 @@
+// Copyright 2018 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2018 Data61, CSIRO
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <sstream>
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("running_stat_merge")
+  {
+  vec x = 2.0 * randn<vec>(5000) + 10.0;
+  
+  running_stat<double> stats1;
+  running_stat<double> stats2;
+  running_stat<double> stats3;
+  
+  for(uword i=0; i < x.n_elem; ++i)  { stats1(x[i]); }
+  
+  for(uword i=0; i < 1000; ++i)  { stats2(x[i]); }
+  
+  stats3( x.subvec(1000, x.n_elem-1) );
+  
+  stats2.merge(stats3);
+  
+  REQUIRE( stats2.count() == Approx(double(x.n_elem)) );
+  REQUIRE( stats2.mean()  == Approx(stats1.mean())    );
+  REQUIRE( stats2.var()   == Approx(stats1.var())     );
+  REQUIRE( stats2.var(1)  == Approx(stats1.var(1))    );
+  REQUIRE( stats2.min()   == Approx(x.min())          );
+  REQUIRE( stats2.max()   == Approx(x.max())          );
+  
+  std::stringstream ss;
+  
+  REQUIRE( stats2.save(ss) );
+  
+  running_stat<double> stats4;
+  
+  REQUIRE( stats4.load(ss) );
+  
+  REQUIRE( stats4.count() == Approx(stats2.count()) );
+  REQUIRE( stats4.mean()  == Approx(stats2.mean())  );
+  REQUIRE( stats4.var()   == Approx(stats2.var())   );
+  }
+
+
+
+TEST_CASE("running_stat_vec_merge")
+  {
+  mat X = randn<mat>(4, 600) + 100.0;
+  
+  running_stat_vec<vec> stats1(true);
+  running_stat_vec<vec> stats2(true);
+  running_stat_vec<vec> stats3(true);
+  
+  for(uword i=0; i < X.n_cols; ++i)
+    {
+    stats1(X.col(i));
+    
+    if(i < 200)  { stats2(X.col(i)); }
+    }
+  
+  // block of samples: each column is one sample
+  stats3( X.cols(200, X.n_cols-1) );
+  
+  stats2.merge(stats3);
+  
+  REQUIRE( stats2.count() == Approx(double(X.n_cols)) );
+  
+  REQUIRE( accu(abs(stats2.mean() - stats1.mean())) == Approx(0.0) );
+  REQUIRE( accu(abs(stats2.var()  - stats1.var() )) == Approx(0.0) );
+  REQUIRE( accu(abs(stats2.cov()  - stats1.cov() )) == Approx(0.0) );
+  REQUIRE( accu(abs(stats2.min()  - min(X,1)     )) == Approx(0.0) );
+  REQUIRE( accu(abs(stats2.max()  - max(X,1)     )) == Approx(0.0) );
+  
+  REQUIRE( accu(abs(stats2.cov() - cov(X.t()))) == Approx(0.0) );
+  
+  running_stat_vec<rowvec> stats4(true);
+  
+  // block of samples: each row is one sample
+  stats4( X.t() );
+  
+  REQUIRE( accu(abs(stats4.cov() - cov(X.t()))) == Approx(0.0) );
+  REQUIRE( accu(abs(stats4.var() - var(X.t()))) == Approx(0.0) );
+  
+  std::stringstream ss;
+  
+  REQUIRE( stats2.save(ss) );
+  
+  running_stat_vec<vec> stats5;
+  
+  REQUIRE( stats5.load(ss) );
+  
+  REQUIRE( stats5.count() == Approx(stats2.count()) );
+  REQUIRE( accu(abs(stats5.cov() - stats2.cov())) == Approx(0.0) );
+  }
+
+
+
+TEST_CASE("running_quantile_1")
+  {
+  running_quantile<double> rq;
+  
+  vec a = randn<vec>(150);
+  
+  for(uword i=0; i < a.n_elem; ++i)  { rq(a(i)); }
+  
+  // few samples: quantiles are exact
+  
+  REQUIRE( rq.is_exact() );
+  REQUIRE( rq.count() == a.n_elem );
+  REQUIRE( rq.min()   == Approx(a.min()) );
+  REQUIRE( rq.max()   == Approx(a.max()) );
+  
+  vec P = { 0.1, 0.5, 0.9 };
+  
+  vec q_exact = quantile(a, P);
+  vec q_rq    = rq.quantile(P);
+  
+  REQUIRE( accu(abs(q_exact - q_rq)) < 1e-10 );
+  REQUIRE( rq.quantile(0.5) == Approx(median(a)) );
+  }
+
+
+
+TEST_CASE("running_quantile_2")
+  {
+  const uword N = 200000;
+  
+  vec a = randu<vec>(N);
+  
+  running_quantile<double> rq1;
+  running_quantile<double> rq2;
+  running_quantile<double> rq3;
+  
+  rq1(a.head(N/2));
+  rq2(a.tail(N/2));
+  
+  rq1.merge(rq2);
+  
+  for(uword i=0; i < N; ++i)  { rq3(a(i)); }
+  
+  REQUIRE( rq1.count() == N );
+  REQUIRE( rq1.is_exact() == false );
+  
+  vec P = { 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99 };
+  
+  vec q  = quantile(a, P);
+  vec q1 = rq1.quantile(P);
+  vec q3 = rq3.quantile(P);
+  
+  // uniform data: the rank error equals the value error
+  
+  for(uword i=0; i < P.n_elem; ++i)
+    {
+    REQUIRE( std::abs(q1(i) - q(i)) < 0.02 );
+    REQUIRE( std::abs(q3(i) - q(i)) < 0.02 );
+    }
+  
+  REQUIRE( rq1.quantile(0.0) == a.min() );
+  REQUIRE( rq1.quantile(1.0) == a.max() );
+  }
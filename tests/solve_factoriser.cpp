@@ -0,0 +1,171 @@
+// Copyright 2017 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2017 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+TEST_CASE("solve_factoriser_1")
+  {
+  arma_rng::set_seed(123);
+  
+  const uword N = 20;
+  
+  mat A(N, N, fill::randu);  A.diag() += 2.0;
+  mat S = A.t()*A + eye(N,N);
+  mat H = S;  H.diag() *= -1.0;  H = symmatu(H);  // symmetric indefinite
+  
+  mat B(N, 3, fill::randn);
+  
+  solve_factoriser<double> F_lu  (A, "lu"  );
+  solve_factoriser<double> F_chol(S, "chol");
+  solve_factoriser<double> F_ldl (H, "ldl" );
+  solve_factoriser<double> F_qr  (A, "qr"  );
+  
+  REQUIRE( norm(F_lu.solve(B)   - solve(A,B), "inf") < 1e-10 );
+  REQUIRE( norm(F_chol.solve(B) - solve(S,B), "inf") < 1e-10 );
+  REQUIRE( norm(F_ldl.solve(B)  - solve(H,B), "inf") < 1e-10 );
+  REQUIRE( norm(F_qr.solve(B)   - solve(A,B), "inf") < 1e-10 );
+  
+  REQUIRE( F_lu.rcond()   == Approx(rcond(A)) );
+  REQUIRE( F_chol.rcond() == Approx(rcond(S)) );
+  REQUIRE( F_ldl.rcond()  == Approx(rcond(H)).epsilon(0.5) );
+  REQUIRE( F_qr.rcond()    > 0.0              );
+  
+  double val_ref, sign_ref, val, sign;
+  
+  log_det(val_ref, sign_ref, A);
+  
+  F_lu.log_det(val, sign);  REQUIRE( val == Approx(val_ref) );  REQUIRE( sign == sign_ref );
+  F_qr.log_det(val, sign);  REQUIRE( val == Approx(val_ref) );  REQUIRE( sign == sign_ref );
+  
+  log_det(val_ref, sign_ref, S);
+  
+  F_chol.log_det(val, sign);  REQUIRE( val == Approx(val_ref) );  REQUIRE( sign == sign_ref );
+  
+  log_det(val_ref, sign_ref, H);
+  
+  F_ldl.log_det(val, sign);  REQUIRE( val == Approx(val_ref) );  REQUIRE( sign == sign_ref );
+  
+  // re-use the existing storage for a new matrix of the same size
+  
+  mat A2 = A + 0.5*eye(N,N);
+  
+  REQUIRE( F_lu.update(A2) );
+  REQUIRE( norm(F_lu.solve(B) - solve(A2,B), "inf") < 1e-10 );
+  
+  mat S2(N, N, fill::zeros);  S2.diag().fill(-1.0);
+  
+  REQUIRE( F_chol.factorise(S2, "chol") == false );
+  REQUIRE( F_chol.is_empty() );
+  
+  REQUIRE_THROWS( F_chol.solve(B) );
+  REQUIRE_THROWS( F_lu.solve(B.rows(0,N-2)) );
+  }
+
+
+
+TEST_CASE("solve_factoriser_2")
+  {
+  arma_rng::set_seed(456);
+  
+  // least squares via QR
+  
+  mat A(30, 8, fill::randu);
+  mat B(30, 2, fill::randn);
+  
+  solve_factoriser<double> F(A, "qr");
+  
+  REQUIRE( F.n_rows() == 30 );
+  REQUIRE( F.n_cols() ==  8 );
+  
+  REQUIRE( norm(F.solve(B) - solve(A,B), "inf") < 1e-10 );
+  
+  // band matrix
+  
+  const uword N = 50;
+  
+  mat C(N, N, fill::zeros);
+  
+  C.diag(-2).randu();
+  C.diag(-1).randu();
+  C.diag( 0).fill(4.0);
+  C.diag(+1).randu();
+  
+  solve_factoriser<double> G;
+  
+  REQUIRE( G.factorise_band(C, 2, 1) );
+  
+  mat D(N, 4, fill::randn);
+  
+  REQUIRE( norm(G.solve(D) - solve(C,D), "inf") < 1e-10 );
+  
+  REQUIRE( G.rcond() == Approx(rcond(C)) );
+  
+  double val_ref, sign_ref, val, sign;
+  
+  log_det(val_ref, sign_ref, C);
+  
+  G.log_det(val, sign);
+  
+  REQUIRE( val  == Approx(val_ref) );
+  REQUIRE( sign == sign_ref        );
+  }
+
+
+
+TEST_CASE("solve_factoriser_3")
+  {
+  arma_rng::set_seed(789);
+  
+  const uword N = 15;
+  
+  cx_mat A(N, N, fill::randu);  A.diag() += cx_double(2.0, 1.0);
+  cx_mat S = A.t()*A;
+  cx_mat H = S - 3.0*eye<cx_mat>(N,N);  // hermitian indefinite
+  
+  cx_mat B(N, 2, fill::randn);
+  
+  solve_factoriser<cx_double> F_lu  (A, "lu"  );
+  solve_factoriser<cx_double> F_chol(S, "chol");
+  solve_factoriser<cx_double> F_ldl (H, "ldl" );
+  solve_factoriser<cx_double> F_qr  (A, "qr"  );
+  
+  REQUIRE( norm(F_lu.solve(B)   - solve(A,B), "inf") < 1e-10 );
+  REQUIRE( norm(F_chol.solve(B) - solve(S,B), "inf") < 1e-10 );
+  REQUIRE( norm(F_ldl.solve(B)  - solve(H,B), "inf") < 1e-10 );
+  REQUIRE( norm(F_qr.solve(B)   - solve(A,B), "inf") < 1e-10 );
+  
+  REQUIRE( F_lu.rcond() == Approx(rcond(A)) );
+  
+  cx_double val_ref, val;
+  double    sign_ref, sign;
+  
+  log_det(val_ref, sign_ref, A);
+  
+  const cx_double det_ref = sign_ref * std::exp(val_ref);
+  
+  F_lu.log_det(val, sign);  REQUIRE( std::abs(sign*std::exp(val) - det_ref) < 1e-8 * std::abs(det_ref) );
+  F_qr.log_det(val, sign);  REQUIRE( std::abs(sign*std::exp(val) - det_ref) < 1e-8 * std::abs(det_ref) );
+  
+  log_det(val_ref, sign_ref, H);
+  
+  const cx_double det_H = sign_ref * std::exp(val_ref);
+  
+  F_ldl.log_det(val, sign);  REQUIRE( std::abs(sign*std::exp(val) - det_H) < 1e-8 * std::abs(det_H) );
+  }
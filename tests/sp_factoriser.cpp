@@ -0,0 +1,166 @@
+// Copyright 2017 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2017 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+// 5-point Laplacian on an n x n grid
+static
+sp_mat
+sp_factoriser_laplacian(const uword n)
+  {
+  const uword N = n*n;
+  
+  umat locs(2, 5*N);
+  vec  vals(   5*N);
+  
+  uword count = 0;
+  
+  for(uword j=0; j < n; ++j)
+  for(uword i=0; i < n; ++i)
+    {
+    const uword k = i + j*n;
+    
+    locs(0,count) = k;  locs(1,count) = k;  vals(count) = 4.0;  ++count;
+    
+    if(i > 0    )  { locs(0,count) = k;  locs(1,count) = k-1;  vals(count) = -1.0;  ++count; }
+    if(i < n-1  )  { locs(0,count) = k;  locs(1,count) = k+1;  vals(count) = -1.0;  ++count; }
+    if(j > 0    )  { locs(0,count) = k;  locs(1,count) = k-n;  vals(count) = -1.0;  ++count; }
+    if(j < n-1  )  { locs(0,count) = k;  locs(1,count) = k+n;  vals(count) = -1.0;  ++count; }
+    }
+  
+  return sp_mat(locs.cols(0,count-1), vals.subvec(0,count-1), N, N);
+  }
+
+
+
+TEST_CASE("sp_factoriser_1")
+  {
+  arma_rng::set_seed(123);
+  
+  const sp_mat A = sp_factoriser_laplacian(30);
+  const mat    B(A.n_rows, 3, fill::randn);
+  
+  const mat X_ref = solve(mat(A), B);
+  
+  sp_factoriser<double> F_amd (A, "chol", "amd" );
+  sp_factoriser<double> F_none(A, "chol", "none");
+  
+  REQUIRE( norm(F_amd.solve(B)  - X_ref, "inf") < 1e-10 );
+  REQUIRE( norm(F_none.solve(B) - X_ref, "inf") < 1e-10 );
+  
+  // the fill-reducing ordering gives a sparser factor than the natural (banded) ordering
+  REQUIRE( F_amd.n_nonzero() < F_none.n_nonzero() );
+  
+  double val_ref, sign_ref, val, sign;
+  
+  log_det(val_ref, sign_ref, mat(A));
+  
+  F_amd.log_det(val, sign);
+  
+  REQUIRE( val  == Approx(val_ref) );
+  REQUIRE( sign == sign_ref        );
+  
+  mat X;
+  
+  REQUIRE( spsolve(X, A, B, "chol") );
+  
+  REQUIRE( norm(X - X_ref, "inf") < 1e-10 );
+  }
+
+
+
+TEST_CASE("sp_factoriser_2")
+  {
+  arma_rng::set_seed(123);
+  
+  // symmetric indefinite, with a dense row and column
+  sp_mat A = sprandu<sp_mat>(200, 200, 0.02);
+  
+  A = A + A.t();
+  A.diag() = linspace<vec>(-5.0, 5.5, 200);
+  A.col(7).ones();
+  A.row(7).ones();
+  
+  const vec b(200, fill::randn);
+  
+  const vec x_ref = solve(mat(A), b);
+  
+  sp_factoriser<double> F;
+  
+  REQUIRE( F.factorise(A, "chol") == false );
+  REQUIRE( F.is_empty() );
+  
+  REQUIRE( F.factorise(A, "ldl") );
+  REQUIRE( norm(F.solve(b) - x_ref, "inf") < 1e-8 );
+  
+  double val_ref, sign_ref, val, sign;
+  
+  log_det(val_ref, sign_ref, mat(A));
+  
+  F.log_det(val, sign);
+  
+  REQUIRE( val  == Approx(val_ref) );
+  REQUIRE( sign == sign_ref        );
+  
+  // same sparsity pattern, different values: the symbolic analysis is reused
+  sp_mat A2 = A;
+  A2.diag() += 0.25;
+  
+  REQUIRE( F.factorise(A2, "ldl") );
+  REQUIRE( norm(F.solve(b) - solve(mat(A2), b), "inf") < 1e-8 );
+  
+  vec x;
+  
+  REQUIRE( spsolve(x, A, b, "ldl") );
+  
+  REQUIRE( norm(x - x_ref, "inf") < 1e-8 );
+  }
+
+
+
+TEST_CASE("sp_factoriser_3")
+  {
+  arma_rng::set_seed(123);
+  
+  // hermitian positive definite
+  sp_cx_mat R = sprandu<sp_cx_mat>(100, 100, 0.03);
+  
+  sp_cx_mat A = R.t() * R;
+  A.diag() += cx_double(1.0, 0.0);
+  
+  const cx_mat B(100, 2, fill::randn);
+  
+  sp_factoriser<cx_double> F(A);
+  
+  REQUIRE( norm(F.solve(B) - solve(cx_mat(A), B), "inf") < 1e-10 );
+  
+  cx_double val_ref, val;
+  double    sign_ref, sign;
+  
+  log_det(val_ref, sign_ref, cx_mat(A));
+  
+  F.log_det(val, sign);
+  
+  REQUIRE( std::real(val) == Approx(std::real(val_ref)) );
+  
+  REQUIRE( sign_ref == Approx(1.0) );
+  REQUIRE( sign     == Approx(1.0) );
+  }
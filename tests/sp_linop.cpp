@@ -0,0 +1,230 @@
+// Copyright 2017 Conrad Sanderson (http://conradsanderson.id.au)
+// Copyright 2017 National ICT Australia (NICTA)
+// 
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+// http://www.apache.org/licenses/LICENSE-2.0
+// 
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+// ------------------------------------------------------------------------
+
+
+
+#include <armadillo>
+#include "catch.hpp"
+
+using namespace arma;
+
+
+
+// 1D Laplacian of size n
+static
+sp_mat
+sp_linop_laplacian_1d(const uword n)
+  {
+  sp_mat A(n, n);
+  
+  for(uword i=0; i < n; ++i)
+    {
+    A(i,i) = 2.0;
+    
+    if(i > 0  )  { A(i,i-1) = -1.0; }
+    if(i < n-1)  { A(i,i+1) = -1.0; }
+    }
+  
+  return A;
+  }
+
+
+
+TEST_CASE("sp_kron_op_1")
+  {
+  arma_rng::set_seed(123);
+  
+  const sp_mat A = sprandu<sp_mat>(7, 5, 0.4);
+  const sp_mat B = sprandu<sp_mat>(6, 9, 0.3);
+  
+  const sp_kron_op<double> K(A, B);
+  
+  const mat KK(kron(A, B));
+  
+  REQUIRE( K.n_rows == 42 );
+  REQUIRE( K.n_cols == 45 );
+  
+  const vec x(K.n_cols, fill::randu);
+  const mat X(K.n_cols, 3, fill::randu);
+  
+  vec y;
+  
+  K.apply(y, x);
+  
+  REQUIRE( norm(y - KK*x, "inf") == Approx(0.0).epsilon(0.0).margin(1e-12) );
+  
+  const mat Y = K * X;
+  
+  REQUIRE( Y.n_rows == K.n_rows );
+  REQUIRE( Y.n_cols == X.n_cols );
+  REQUIRE( norm(Y - KK*X, "inf") == Approx(0.0).epsilon(0.0).margin(1e-12) );
+  
+  const vec z(K.n_rows, fill::randu);
+  
+  const sp_kron_op<double> Kt = K.t();
+  
+  REQUIRE( Kt.n_rows == K.n_cols );
+  REQUIRE( Kt.n_cols == K.n_rows );
+  REQUIRE( norm(Kt*z - KK.t()*z, "inf") == Approx(0.0).epsilon(0.0).margin(1e-12) );
+  
+  REQUIRE_THROWS( K.apply(y, z) );
+  }
+
+
+
+TEST_CASE("sp_kron_op_cx")
+  {
+  arma_rng::set_seed(123);
+  
+  sp_cx_mat A = sprandu<sp_cx_mat>(4, 4, 0.5);
+  sp_cx_mat B = sprandu<sp_cx_mat>(5, 3, 0.5);
+  
+  A(1,2) = cx_double(1.0, -2.0);
+  B(4,0) = cx_double(0.5,  3.0);
+  
+  const sp_kron_op<cx_double> K(A, B);
+  
+  const cx_mat KK(kron(A, B));
+  
+  const cx_vec x(K.n_rows, fill::randu);
+  
+  REQUIRE( norm(K.t() * x - KK.t() * x, "inf") == Approx(0.0).epsilon(0.0).margin(1e-12) );
+  REQUIRE( norm(K.st()* x - KK.st()* x, "inf") == Approx(0.0).epsilon(0.0).margin(1e-12) );
+  }
+
+
+
+TEST_CASE("sp_blockdiag_op_1")
+  {
+  arma_rng::set_seed(123);
+  
+  field<sp_mat> blocks(3);
+  
+  blocks(0) = sprandu<sp_mat>(4, 3, 0.5);
+  blocks(1) = sprandu<sp_mat>(6, 6, 0.5);
+  blocks(2) = sprandu<sp_mat>(2, 5, 0.5);
+  
+  const sp_blockdiag_op<double> D(blocks);
+  
+  REQUIRE( D.n_blocks() == 3  );
+  REQUIRE( D.n_rows     == 12 );
+  REQUIRE( D.n_cols     == 14 );
+  
+  mat DD(12, 14, fill::zeros);
+  
+  DD.submat(0,  0, 3,  2) = mat(blocks(0));
+  DD.submat(4,  3, 9,  8) = mat(blocks(1));
+  DD.submat(10, 9, 11, 13) = mat(blocks(2));
+  
+  const mat X(D.n_cols, 2, fill::randu);
+  const vec z(D.n_rows,    fill::randu);
+  
+  REQUIRE( norm(D*X - DD*X, "inf") == Approx(0.0).epsilon(0.0).margin(1e-12) );
+  
+  REQUIRE( norm(D.t()*z - DD.t()*z, "inf") == Approx(0.0).epsilon(0.0).margin(1e-12) );
+  }
+
+
+
+TEST_CASE("sp_linop_spsolve")
+  {
+  arma_rng::set_seed(123);
+  
+  const sp_mat T = sp_linop_laplacian_1d(12);
+  const sp_mat I = speye<sp_mat>(12, 12);
+  
+  // 2D Laplacian on a 12 x 12 grid: kron(I,T) + kron(T,I) is not itself a Kronecker product,
+  // so use the shifted operator kron(T + 2I, T + 2I), which is symmetric positive definite
+  const sp_mat S = T + 2.0*I;
+  
+  const sp_kron_op<double> K(S, S);
+  
+  const mat KK(kron(S, S));
+  
+  const vec b(K.n_rows, fill::randu);
+  
+  iterative_opts opts;
+  opts.tol = 1e-10;
+  
+  vec x1;
+  vec x2;
+  
+  REQUIRE( spsolve(x1, K, b, "cg",    opts) );
+  REQUIRE( spsolve(x2, K, b, "gmres", opts) );
+  
+  REQUIRE( opts.converged );
+  
+  REQUIRE( norm(KK*x1 - b) / norm(b) < 1e-8 );
+  REQUIRE( norm(KK*x2 - b) / norm(b) < 1e-8 );
+  
+  field<sp_mat> blocks(2);
+  
+  blocks(0) = S;
+  blocks(1) = 2.0 * S;
+  
+  const sp_blockdiag_op<double> D(blocks);
+  
+  const mat  B(D.n_rows, 2, fill::randu);
+  const mat  X = spsolve(D, B, "minres", opts);
+  
+  REQUIRE( norm(D*X - B, "inf") < 1e-8 );
+  
+  REQUIRE_THROWS( spsolve(D, B, "superlu") );
+  }
+
+
+
+TEST_CASE("sp_linop_eigs")
+  {
+  const sp_mat T = sp_linop_laplacian_1d(20);
+  
+  const sp_kron_op<double> K(T, T);
+  
+  const mat KK(kron(T, T));
+  
+  vec eigval;
+  mat eigvec;
+  
+  REQUIRE( eigs_sym(eigval, eigvec, K, 4, "la") );
+  
+  const vec eigval_full = eig_sym(KK);
+  
+  REQUIRE( eigval.n_elem == 4 );
+  
+  for(uword i=0; i < 4; ++i)
+    {
+    REQUIRE( eigval(i) == Approx(eigval_full(eigval_full.n_elem - 4 + i)) );
+    
+    REQUIRE( norm(KK*eigvec.col(i) - eigval(i)*eigvec.col(i)) < 1e-8 );
+    }
+  
+  field<sp_mat> blocks(2);
+  
+  blocks(0) = T;
+  blocks(1) = sprandu<sp_mat>(15, 15, 0.3) + speye<sp_mat>(15, 15);
+  
+  const sp_blockdiag_op<double> D(blocks);
+  
+  const cx_vec eigval_gen = eigs_gen(D, 3);
+  
+  REQUIRE( eigval_gen.n_elem == 3 );
+  
+  const mat      DD = join_cols( join_rows(mat(blocks(0)), zeros<mat>(20, 15)), join_rows(zeros<mat>(15, 20), mat(blocks(1))) );
+  const cx_vec full = eig_gen(DD);
+  
+  const double largest = max(abs(full));
+  
+  REQUIRE( max(abs(eigval_gen)) == Approx(largest) );
+  }
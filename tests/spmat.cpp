@@ -2741,3 +2741,770 @@ TEST_CASE("spmat_sprow_col_iterator_test")
 
   REQUIRE( count == 1 );
   }
+
+
+
+TEST_CASE("spmat_row_access_test")
+  {
+  sp_mat X = sprandu<sp_mat>(60, 40, 0.1);
+  
+  X.row(7).zeros();
+  X.row(59).zeros();
+  
+  mat D(X);
+  
+  // full row-wise traversal
+  uword count = 0;
+  uword last_row = 0;
+  uword last_col = 0;
+  for(sp_mat::const_row_iterator it = X.begin_row(); it != X.end_row(); ++it)
+    {
+    REQUIRE( (*it) == D(it.row(), it.col()) );
+    REQUIRE( ((count == 0) || (it.row() > last_row) || ((it.row() == last_row) && (it.col() > last_col))) );
+    
+    last_row = it.row();
+    last_col = it.col();
+    ++count;
+    }
+  REQUIRE( count == X.n_nonzero );
+  
+  // backwards traversal from the end
+  sp_mat::const_row_iterator it = X.end_row();
+  for(uword i=0; i < X.n_nonzero; ++i)
+    {
+    --it;
+    REQUIRE( it.pos() == X.n_nonzero - 1 - i );
+    REQUIRE( (*it) == D(it.row(), it.col()) );
+    }
+  REQUIRE( it == X.begin_row() );
+  
+  // traversal of individual rows
+  for(uword r=0; r < X.n_rows; ++r)
+    {
+    uword row_count = 0;
+    for(sp_mat::const_row_iterator jt = X.begin_row(r); jt != X.end_row(r); ++jt)
+      {
+      REQUIRE( jt.row() == r );
+      REQUIRE( (*jt) == D(r, jt.col()) );
+      ++row_count;
+      }
+    REQUIRE( row_count == uword(accu(D.row(r) != 0)) );
+    }
+  
+  // row subviews
+  for(uword r=0; r < X.n_rows; ++r)
+    {
+    sp_mat Y = X.row(r);
+    sp_mat Z = X(r, span(5, 30));
+    
+    REQUIRE( Y.n_nonzero == uword(accu(D.row(r) != 0)) );
+    REQUIRE( accu(abs(mat(Y) - D.row(r))) == Approx(0.0) );
+    REQUIRE( accu(abs(mat(Z) - D(r, span(5, 30)))) == Approx(0.0) );
+    REQUIRE( X.row(r).n_nonzero == Y.n_nonzero );
+    }
+  
+  // modifications invalidate the mirror
+  X(7, 3) = 2.5;
+  X(20, 0) = 0.0;
+  X.shed_col(1);
+  D(7, 3) = 2.5;
+  D(20, 0) = 0.0;
+  D.shed_col(1);
+  
+  count = 0;
+  for(sp_mat::const_row_iterator jt = X.begin_row(); jt != X.end_row(); ++jt)
+    {
+    REQUIRE( (*jt) == D(jt.row(), jt.col()) );
+    ++count;
+    }
+  REQUIRE( count == X.n_nonzero );
+  
+  sp_mat Y = X.row(7);
+  REQUIRE( accu(abs(mat(Y) - D.row(7))) == Approx(0.0) );
+  
+  // row-wise reductions
+  REQUIRE( accu(abs(mat(mean(X, 1)) - mean(D, 1))) == Approx(0.0).margin(1e-12) );
+  REQUIRE( accu(abs(mat(var(X, 0, 1)) - var(D, 0, 1))) == Approx(0.0).margin(1e-12) );
+  
+  // transposes and multiplication with a transposed matrix
+  REQUIRE( accu(abs(mat(X.t()) - D.t())) == Approx(0.0) );
+  
+  vec y = randu<vec>(X.n_rows);
+  mat B = randu<mat>(X.n_rows, 3);
+  
+  vec x = X.t() * y;
+  mat C = X.t() * B;
+  
+  REQUIRE( x.n_elem == X.n_cols );
+  REQUIRE( accu(abs(x - D.t() * y)) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(C - D.t() * B)) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs((2.0 * X).t() * y - 2.0 * D.t() * y)) == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("spmat_cx_trans_test")
+  {
+  sp_cx_mat X = sprandu<sp_cx_mat>(30, 20, 0.2);
+  
+  cx_mat D(X);
+  
+  REQUIRE( accu(abs(cx_mat(X.t())  - D.t()))  == Approx(0.0) );
+  REQUIRE( accu(abs(cx_mat(X.st()) - D.st())) == Approx(0.0) );
+  
+  cx_vec y = randu<cx_vec>(X.n_rows);
+  
+  REQUIRE( accu(abs(cx_vec(X.t()  * y) - D.t()  * y)) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(cx_vec(X.st() * y) - D.st() * y)) == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("spmat_batch_insert_counting_sort_test")
+  {
+  // sizes chosen so that both the row-then-column counting sort (many elements per row)
+  // and the column sort with per-column sorting (more rows than elements) are used
+  const uword sizes[2][3] = { {300, 200, 8000}, {100000, 30, 2000} };
+  
+  for(uword s=0; s < 2; ++s)
+    {
+    const uword n_rows = sizes[s][0];
+    const uword n_cols = sizes[s][1];
+    const uword N      = sizes[s][2];
+    
+    // unique locations in random order
+    const uvec linear = shuffle( regspace<uvec>(0, 7, 7*(N-1)) );
+    
+    umat locs(2, N);
+    locs.row(0) = trans(linear - n_rows * (linear / n_rows));
+    locs.row(1) = trans(linear / n_rows);
+    
+    const vec vals = randu<vec>(N) + 1.0;
+    
+    sp_mat A(locs, vals, n_rows, n_cols, true);
+    
+    REQUIRE( A.n_nonzero == N );
+    
+    mat D(n_rows, n_cols, fill::zeros);
+    for(uword i=0; i < N; ++i)  { D(locs(0,i), locs(1,i)) = vals(i); }
+    
+    REQUIRE( accu(abs(mat(A) - D)) == Approx(0.0) );
+    
+    // rows must be strictly increasing within each column
+    for(uword c=0; c < n_cols; ++c)
+      {
+      for(uword k = A.col_ptrs[c] + 1; k < A.col_ptrs[c+1]; ++k)  { REQUIRE( A.row_indices[k] > A.row_indices[k-1] ); }
+      }
+    
+    // repeated locations are summed by the add_values constructor
+    umat locs2 = join_rows(locs, locs.cols(0, N/2));
+    vec  vals2 = join_cols(vals, vals.subvec(0, N/2));
+    
+    const uvec perm = shuffle( regspace<uvec>(0, locs2.n_cols-1) );
+    
+    locs2 = locs2.cols(perm);
+    vals2 = vals2.elem(perm);
+    
+    sp_mat B(true, locs2, vals2, n_rows, n_cols, true);
+    
+    D.zeros();
+    for(uword i=0; i < locs2.n_cols; ++i)  { D(locs2(0,i), locs2(1,i)) += vals2(i); }
+    
+    REQUIRE( B.n_nonzero == N );
+    REQUIRE( accu(abs(mat(B) - D)) == Approx(0.0).margin(1e-10) );
+    
+    for(uword c=0; c < n_cols; ++c)
+      {
+      for(uword k = B.col_ptrs[c] + 1; k < B.col_ptrs[c+1]; ++k)  { REQUIRE( B.row_indices[k] > B.row_indices[k-1] ); }
+      }
+    }
+  }
+
+
+
+TEST_CASE("spmat_elementwise_merge_test")
+  {
+  // large enough for the column-partitioned merge to run in parallel when OpenMP is enabled
+  sp_mat A = sprandu<sp_mat>(600, 400, 0.05);
+  sp_mat B = sprandu<sp_mat>(600, 400, 0.05);
+  
+  // some columns share locations with A, and some are empty
+  B.cols(0, 49) = A.cols(0, 49);
+  B.cols(60, 69).zeros();
+  
+  const mat dA(A);
+  const mat dB(B);
+  
+  const sp_mat C1 = A + B;
+  const sp_mat C2 = A - B;
+  const sp_mat C3 = A % B;
+  
+  REQUIRE( accu(abs(mat(C1) - (dA + dB))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(C2) - (dA - dB))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(C3) - (dA % dB))) == Approx(0.0).margin(1e-10) );
+  
+  // results which cancel are not stored
+  REQUIRE( C1.n_nonzero == uword(accu(dA + dB != 0.0)) );
+  REQUIRE( C2.n_nonzero == uword(accu(dA - dB != 0.0)) );
+  REQUIRE( C3.n_nonzero == uword(accu(dA % dB != 0.0)) );
+  
+  const sp_mat D = A - A;
+  
+  REQUIRE( D.n_nonzero == 0 );
+  
+  for(uword c=0; c < C1.n_cols; ++c)
+    {
+    for(uword k = C1.col_ptrs[c] + 1; k < C1.col_ptrs[c+1]; ++k)  { REQUIRE( C1.row_indices[k] > C1.row_indices[k-1] ); }
+    for(uword k = C2.col_ptrs[c] + 1; k < C2.col_ptrs[c+1]; ++k)  { REQUIRE( C2.row_indices[k] > C2.row_indices[k-1] ); }
+    }
+  
+  const sp_mat T = A.t();
+  
+  REQUIRE( accu(abs(mat(T) - dA.t())) == Approx(0.0) );
+  
+  for(uword c=0; c < T.n_cols; ++c)
+    {
+    for(uword k = T.col_ptrs[c] + 1; k < T.col_ptrs[c+1]; ++k)  { REQUIRE( T.row_indices[k] > T.row_indices[k-1] ); }
+    }
+  }
+
+
+
+TEST_CASE("spmat_reductions_test")
+  {
+  // large enough for the reductions to run in parallel when OpenMP is enabled
+  sp_mat A = sprandn<sp_mat>(500, 300, 0.05);
+  
+  // a dense column, a dense row, an empty column and an empty row
+  A.col(7)   = randn<vec>(500);
+  A.row(11)  = randn<rowvec>(300);
+  A.col(20).zeros();
+  A.row(30).zeros();
+  
+  const mat dA(A);
+  
+  REQUIRE( norm(mat(sum(A,0)) - sum(dA,0), "inf") == Approx(0.0).margin(1e-10) );
+  REQUIRE( norm(mat(sum(A,1)) - sum(dA,1), "inf") == Approx(0.0).margin(1e-10) );
+  
+  REQUIRE( norm(mat(mean(A,0)) - mean(dA,0), "inf") == Approx(0.0).margin(1e-12) );
+  REQUIRE( norm(mat(mean(A,1)) - mean(dA,1), "inf") == Approx(0.0).margin(1e-12) );
+  
+  REQUIRE( norm(mat(var(A,0,0)) - var(dA,0,0), "inf") == Approx(0.0).margin(1e-10) );
+  REQUIRE( norm(mat(var(A,1,0)) - var(dA,1,0), "inf") == Approx(0.0).margin(1e-10) );
+  REQUIRE( norm(mat(var(A,1,1)) - var(dA,1,1), "inf") == Approx(0.0).margin(1e-10) );
+  
+  REQUIRE( norm(mat(max(A,0)) - max(dA,0), "inf") == Approx(0.0) );
+  REQUIRE( norm(mat(max(A,1)) - max(dA,1), "inf") == Approx(0.0) );
+  REQUIRE( norm(mat(min(A,0)) - min(dA,0), "inf") == Approx(0.0) );
+  REQUIRE( norm(mat(min(A,1)) - min(dA,1), "inf") == Approx(0.0) );
+  
+  REQUIRE( accu(A) == Approx(accu(dA)) );
+  
+  REQUIRE( norm(A, 1)     == Approx(norm(dA, 1    )) );
+  REQUIRE( norm(A, "inf") == Approx(norm(dA, "inf")) );
+  
+  const sp_vec v = A.col(7);
+  
+  REQUIRE( norm(v, 1) == Approx(norm(vec(v), 1)) );
+  
+  const sp_mat B = sprandn<sp_mat>(500, 300, 0.05) + A;
+  
+  REQUIRE( dot(A, B) == Approx(dot(dA, mat(B))) );
+  
+  sp_cx_mat C = sprandu<sp_cx_mat>(400, 200, 0.05);
+  
+  const cx_mat dC(C);
+  
+  REQUIRE( norm(cx_mat(sum(C,1)) - sum(dC,1), "inf") == Approx(0.0).margin(1e-10) );
+  
+  REQUIRE( norm(mat(var(C,0,1)) - var(dC,0,1), "inf") == Approx(0.0).margin(1e-10) );
+  REQUIRE( norm(mat(var(C,1,1)) - var(dC,1,1), "inf") == Approx(0.0).margin(1e-10) );
+  }
+
+
+
+TEST_CASE("spmat_aux_mem_test")
+  {
+  // 4x3 matrix in CSC format
+  uword row_indices[] = { 0, 3, 1, 0, 2 };
+  uword col_ptrs[]    = { 0, 2, 3, 5 };
+  double values[]     = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+  
+  mat D(4, 3, fill::zeros);
+  D(0,0) = 1.0;  D(3,0) = 2.0;  D(1,1) = 3.0;  D(0,2) = 4.0;  D(2,2) = 5.0;
+  
+  sp_mat A(row_indices, col_ptrs, values, 4, 3, false);
+  
+  REQUIRE( A.mem_state   == 1      );
+  REQUIRE( A.values      == values );
+  REQUIRE( A.row_indices == row_indices );
+  REQUIRE( A.n_nonzero   == 5      );
+  
+  REQUIRE( norm(mat(A) - D, "inf")           == Approx(0.0) );
+  REQUIRE( norm(mat(A.t()) - D.t(), "inf")   == Approx(0.0) );
+  REQUIRE( accu(A.submat(1,1,3,2))           == Approx(8.0) );
+  REQUIRE( accu(A.row(0))                    == Approx(5.0) );
+  
+  // CSR arrays of a matrix are the CSC arrays of its transpose
+  uword csr_col_indices[] = { 0, 2, 1, 2, 0 };
+  uword csr_row_ptrs[]    = { 0, 2, 3, 4, 5 };
+  double csr_values[]     = { 1.0, 4.0, 3.0, 5.0, 2.0 };
+  
+  const sp_mat Dt(csr_col_indices, csr_row_ptrs, csr_values, 3, 4, false);
+  
+  REQUIRE( Dt.mem_state == 1 );
+  REQUIRE( norm(mat(Dt) - D.t(), "inf") == Approx(0.0) );
+  REQUIRE( norm(mat(Dt.t()) - D, "inf") == Approx(0.0) );
+  
+  // changes that keep the sparsity pattern are written to the external arrays
+  A *= 2.0;
+  
+  REQUIRE( A.mem_state == 1    );
+  REQUIRE( values[4]   == Approx(10.0) );
+  
+  // changes to the sparsity pattern move the matrix to its own memory
+  A(3,2) = 1.0;
+  A.sync();
+  
+  REQUIRE( A.mem_state == 0      );
+  REQUIRE( A.values    != values );
+  REQUIRE( A.n_nonzero == 6      );
+  REQUIRE( values[4]   == Approx(10.0) );
+  
+  sp_mat B(row_indices, col_ptrs, values, 4, 3, false);
+  
+  B.shed_col(0);
+  
+  REQUIRE( B.mem_state == 0 );
+  REQUIRE( accu(B)     == Approx(24.0) );
+  
+  // auxiliary memory is not transferred by moves or copies
+  sp_mat C(row_indices, col_ptrs, values, 4, 3, false);
+  sp_mat E(C);
+  
+  REQUIRE( E.mem_state == 0      );
+  REQUIRE( E.values    != values );
+  REQUIRE( accu(E)     == Approx(30.0) );
+  
+  sp_mat F(row_indices, col_ptrs, values, 4, 3);
+  
+  REQUIRE( F.mem_state == 0 );
+  REQUIRE( norm(mat(F) - 2.0*D, "inf") == Approx(0.0) );
+  
+  // column iterators, with heap arrays of exactly n_nonzero elements and trailing empty columns
+  const uword G_n_cols = 6;
+  
+  std::vector<uword>  G_row_indices(row_indices, row_indices + 5);
+  std::vector<uword>  G_col_ptrs(G_n_cols + 1, uword(5));
+  std::vector<double> G_values(values, values + 5);
+  
+  std::copy(col_ptrs, col_ptrs + 4, G_col_ptrs.begin());
+  
+  const sp_mat G(&G_row_indices[0], &G_col_ptrs[0], &G_values[0], 4, G_n_cols, false);
+  
+  REQUIRE( G.mem_state == 1 );
+  
+  for(uword c=0; c < G_n_cols; ++c)
+    {
+    double col_sum = 0.0;
+    
+    for(sp_mat::const_iterator it = G.begin_col(c); it != G.end_col(c); ++it)  { col_sum += (*it); }
+    
+    REQUIRE( col_sum == Approx(accu(G.col(c))) );
+    }
+  
+  uword count = 0;
+  
+  for(sp_mat::const_iterator it = G.begin(); it != G.end(); ++it)  { ++count; }
+  
+  REQUIRE( count == 5 );
+  
+  REQUIRE( (G.begin_col(3) == G.end())               );
+  REQUIRE( (G.end_col(G_n_cols-1) == G.end())        );
+  REQUIRE( (G.begin_col(2) != G.end_col(2))          );
+  REQUIRE( (G.end_col(2)   == G.end())               );
+  
+  // the same, with a non-empty last column
+  const sp_mat H(&G_row_indices[0], col_ptrs, &G_values[0], 4, 3, false);
+  
+  double H_sum = 0.0;
+  
+  for(sp_mat::const_iterator it = H.begin_col(2); it != H.end_col(2); ++it)  { H_sum += (*it); }
+  
+  REQUIRE( H_sum == Approx(accu(H.col(2))) );
+  REQUIRE( (H.end_col(2) == H.end()) );
+  }
+
+
+
+TEST_CASE("spmat_sprandu_sprandn_test")
+  {
+  const double densities[] = { 0.0, 0.01, 0.2, 1.0 };
+  
+  for(uword d=0; d < 4; ++d)
+    {
+    const double density = densities[d];
+    
+    const sp_mat    A = sprandu<sp_mat>(600, 500, density);
+    const sp_mat    B = sprandn<sp_mat>(3, 40000, density);
+    const sp_cx_mat C = sprandu<sp_cx_mat>(200, 100, density);
+    const sp_vec    v = sprandu<sp_vec>(50000, 1, density);
+    
+    REQUIRE( A.col_ptrs[A.n_cols] == A.n_nonzero );
+    REQUIRE( B.col_ptrs[B.n_cols] == B.n_nonzero );
+    REQUIRE( C.col_ptrs[C.n_cols] == C.n_nonzero );
+    REQUIRE( v.col_ptrs[v.n_cols] == v.n_nonzero );
+    
+    // row indices must be strictly increasing within each column
+    bool A_ok = true;
+    
+    for(uword c=0; c < A.n_cols; ++c)
+    for(uword k=A.col_ptrs[c]; k < A.col_ptrs[c+1]; ++k)
+      {
+      if(A.row_indices[k] >= A.n_rows)                                       { A_ok = false; }
+      if( (k > A.col_ptrs[c]) && (A.row_indices[k] <= A.row_indices[k-1]) )  { A_ok = false; }
+      }
+    
+    REQUIRE( A_ok );
+    
+    REQUIRE( (double(A.n_nonzero) / double(A.n_elem)) == Approx(density).margin(0.01) );
+    REQUIRE( (double(B.n_nonzero) / double(B.n_elem)) == Approx(density).margin(0.01) );
+    REQUIRE( (double(v.n_nonzero) / double(v.n_elem)) == Approx(density).margin(0.01) );
+    
+    if(density > 0.1)
+      {
+      const vec a = nonzeros(A);
+      const vec b = nonzeros(B);
+      
+      REQUIRE( a.min() >= 0.0 );
+      REQUIRE( a.max() <= 1.0 );
+      
+      REQUIRE( mean(a) == Approx(0.5).margin(0.02) );
+      REQUIRE( mean(b) == Approx(0.0).margin(0.05) );
+      REQUIRE( var(b)  == Approx(1.0).margin(0.05) );
+      
+      REQUIRE( mean(real(nonzeros(C))) == Approx(0.5).margin(0.05) );
+      REQUIRE( mean(imag(nonzeros(C))) == Approx(0.5).margin(0.05) );
+      }
+    }
+  
+  const sp_mat D = sprandu<sp_mat>(7, 9, 1.0);
+  
+  REQUIRE( D.n_nonzero == D.n_elem );
+  }
+
+
+
+TEST_CASE("spmat_masked_product_test")
+  {
+  // large enough for the masked products to run in parallel when OpenMP is enabled
+  const mat A = randu<mat>(300, 20);
+  const mat B = randu<mat>(20, 250);
+  
+  sp_mat S = sprandu<sp_mat>(300, 250, 0.02);
+  
+  S.col(7).zeros();
+  
+  const mat AB = A * B;
+  
+  const sp_mat C1 = (A * B) % S;
+  const sp_mat C2 = S % (A * B);
+  const sp_mat C3 = (2.0 * A * B) % S;
+  const sp_mat C4 = (A.t().t() * B) % S;
+  const sp_mat C5 = (B.t() * A.t()).t() % S;
+  
+  REQUIRE( C1.n_nonzero == S.n_nonzero );
+  
+  REQUIRE( accu(abs(mat(C1) - (AB % mat(S)))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(C2) - (AB % mat(S)))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(C3) - 2.0 * (AB % mat(S)))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(C4) - (AB % mat(S)))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(C5) - (AB % mat(S)))) == Approx(0.0).margin(1e-10) );
+  
+  // transposed operands
+  const mat At = A.t();
+  const mat Bt = B.t();
+  
+  const sp_mat C6 = (At.t() * Bt.t()) % S;
+  
+  REQUIRE( accu(abs(mat(C6) - (AB % mat(S)))) == Approx(0.0).margin(1e-10) );
+  
+  // sparse object on the left, with scalar and transposed operands
+  const sp_mat C7 = S % (3.0 * At.t() * Bt.t());
+  const sp_mat C8 = S.t() % (Bt * At);
+  
+  REQUIRE( C7.n_nonzero == S.n_nonzero );
+  
+  REQUIRE( accu(abs(mat(C7) - 3.0 * (AB % mat(S)))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(C8) - (AB.t() % mat(S.t())))) == Approx(0.0).margin(1e-10) );
+  
+  // when the mask is dense enough, the full product is used
+  const sp_mat D = sprandu<sp_mat>(300, 250, 0.5);
+  
+  REQUIRE( accu(abs(mat((A * B) % D) - (AB % mat(D)))) == Approx(0.0).margin(1e-10) );
+  
+  // the result may be stored in the mask
+  sp_mat S2 = S;
+  
+  S2 = (A * B) % S2;
+  
+  REQUIRE( accu(abs(mat(S2) - mat(C1))) == Approx(0.0).margin(1e-10) );
+  
+  // complex elements, with conjugate transpose
+  const cx_mat X = randu<cx_mat>(20, 40);
+  const cx_mat Y = randu<cx_mat>(20, 30);
+  
+  const sp_cx_mat T = sprandu<sp_cx_mat>(40, 30, 0.1);
+  
+  const sp_cx_mat Z = (X.t() * Y) % T;
+  
+  REQUIRE( abs(accu(abs(cx_mat(Z) - (X.t() * Y) % cx_mat(T)))) == Approx(0.0).margin(1e-10) );
+  
+  // sparse operands
+  const sp_mat P = sprandu<sp_mat>(300, 200, 0.05);
+  const sp_mat Q = sprandu<sp_mat>(200, 250, 0.05);
+  
+  const mat PQ = mat(P) * mat(Q);
+  
+  const sp_mat E1 = (P * Q) % S;
+  const sp_mat E2 = S % (P * Q);
+  const sp_mat E3 = (P * Q) % (P * Q);
+  
+  REQUIRE( accu(abs(mat(E1) - (PQ % mat(S)))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(E2) - (PQ % mat(S)))) == Approx(0.0).margin(1e-10) );
+  REQUIRE( accu(abs(mat(E3) - (PQ % PQ))) == Approx(0.0).margin(1e-10) );
+  
+  // locations where the product is zero are not stored
+  REQUIRE( E1.n_nonzero == uword(accu((PQ % mat(S)) != 0.0)) );
+  
+  for(uword c=0; c < E1.n_cols; ++c)
+    {
+    for(uword k = E1.col_ptrs[c] + 1; k < E1.col_ptrs[c+1]; ++k)  { REQUIRE( E1.row_indices[k] > E1.row_indices[k-1] ); }
+    }
+  
+  REQUIRE_THROWS( sp_mat((A * B) % sp_mat(10, 10)) );
+  REQUIRE_THROWS( sp_mat((P * Q) % sp_mat(10, 10)) );
+  }
+
+
+
+TEST_CASE("spmat_matrix_market_test")
+  {
+  // large enough for the parser to run in parallel when OpenMP is enabled
+  const sp_mat A = sprandu<sp_mat>(500, 300, 0.05);
+  
+  std::stringstream ss1;
+  
+  REQUIRE( A.save(ss1, mm_ascii) );
+  
+  sp_mat B;
+  
+  REQUIRE( B.load(ss1, mm_ascii) );
+  
+  REQUIRE( B.n_rows    == A.n_rows    );
+  REQUIRE( B.n_cols    == A.n_cols    );
+  REQUIRE( B.n_nonzero == A.n_nonzero );
+  
+  REQUIRE( accu(abs(mat(B) - mat(A))) == Approx(0.0).margin(1e-10) );
+  
+  // complex elements
+  const sp_cx_mat C = sprandu<sp_cx_mat>(40, 50, 0.1);
+  
+  std::stringstream ss2;
+  
+  REQUIRE( C.save(ss2, mm_ascii) );
+  
+  sp_cx_mat D;
+  
+  REQUIRE( D.load(ss2, mm_ascii) );
+  
+  REQUIRE( abs(accu(abs(cx_mat(D) - cx_mat(C)))) == Approx(0.0).margin(1e-10) );
+  
+  // symmetric variant with comments; only the lower triangle is given
+  std::stringstream ss3;
+  
+  ss3 << "%%MatrixMarket matrix coordinate real symmetric\n";
+  ss3 << "% comment\n";
+  ss3 << "%\n";
+  ss3 << "  4 4 5\n";
+  ss3 << "1 1 2.0\n";
+  ss3 << "2 1 -1.5\n";
+  ss3 << "4 2 3\n";
+  ss3 << "\n";
+  ss3 << "3 3 1e-1\n";
+  ss3 << "4 4 5.0\r\n";
+  
+  sp_mat E;
+  
+  REQUIRE( E.load(ss3, mm_ascii) );
+  
+  mat E_expected(4, 4, fill::zeros);
+  
+  E_expected(0,0) =  2.0;
+  E_expected(1,0) = -1.5;  E_expected(0,1) = -1.5;
+  E_expected(3,1) =  3.0;  E_expected(1,3) =  3.0;
+  E_expected(2,2) =  0.1;
+  E_expected(3,3) =  5.0;
+  
+  REQUIRE( E.n_nonzero == 7 );
+  REQUIRE( accu(abs(mat(E) - E_expected)) == Approx(0.0).margin(1e-12) );
+  
+  // skew-symmetric and pattern variants
+  std::stringstream ss4;
+  
+  ss4 << "%%MatrixMarket matrix coordinate real skew-symmetric\n3 3 2\n2 1 4.0\n3 2 -1.0\n";
+  
+  sp_mat F;
+  
+  REQUIRE( F.load(ss4, mm_ascii) );
+  
+  REQUIRE( F(1,0) ==  4.0 );
+  REQUIRE( F(0,1) == -4.0 );
+  REQUIRE( F(2,1) == -1.0 );
+  REQUIRE( F(1,2) ==  1.0 );
+  
+  std::stringstream ss5;
+  
+  ss5 << "%%MatrixMarket matrix coordinate pattern general\n3 5 3\n1 1\n3 5\n2 4\n";
+  
+  sp_mat G;
+  
+  REQUIRE( G.load(ss5, mm_ascii) );
+  
+  REQUIRE( G.n_rows    == 3 );
+  REQUIRE( G.n_cols    == 5 );
+  REQUIRE( G.n_nonzero == 3 );
+  REQUIRE( accu(G) == Approx(3.0) );
+  REQUIRE( G(2,4) == 1.0 );
+  
+  // hermitian variant
+  std::stringstream ss6;
+  
+  ss6 << "%%MatrixMarket matrix coordinate complex hermitian\n2 2 2\n1 1 1.0 0.0\n2 1 2.0 3.0\n";
+  
+  sp_cx_mat H;
+  
+  REQUIRE( H.load(ss6, mm_ascii) );
+  
+  REQUIRE( cx_double(H(1,0)) == cx_double(2.0,  3.0) );
+  REQUIRE( cx_double(H(0,1)) == cx_double(2.0, -3.0) );
+  
+  // malformed input
+  std::stringstream ss7;
+  std::stringstream ss8;
+  std::stringstream ss9;
+  
+  ss7 << "%%MatrixMarket matrix coordinate real general\n3 3 2\n1 1 1.0\n";
+  ss8 << "%%MatrixMarket matrix coordinate real general\n3 3 1\n4 1 1.0\n";
+  ss9 << "%%MatrixMarket matrix coordinate complex general\n3 3 1\n1 1 1.0 2.0\n";
+  
+  sp_mat J;
+  
+  REQUIRE( J.load(ss7, mm_ascii, false) == false );
+  REQUIRE( J.load(ss8, mm_ascii, false) == false );
+  REQUIRE( J.load(ss9, mm_ascii, false) == false );
+  }
+
+
+
+TEST_CASE("spmat_csc_binary_test")
+  {
+  const sp_mat A = sprandu<sp_mat>(200, 100, 0.05);
+  
+  std::stringstream ss;
+  
+  REQUIRE( A.save(ss, csc_binary) );
+  
+  sp_mat B;
+  
+  REQUIRE( B.load(ss, csc_binary) );
+  
+  REQUIRE( B.n_nonzero == A.n_nonzero );
+  REQUIRE( accu(abs(mat(B) - mat(A))) == 0.0 );
+  
+  const std::string name = "spmat_csc_binary_test.bin";
+  
+  REQUIRE( A.save(name, csc_binary) );
+  
+    {
+    sp_mmap<double> F(name);
+    
+    REQUIRE( F.is_open() );
+    
+    const sp_mat& M = F.get_ref();
+    
+    REQUIRE( M.n_rows    == A.n_rows    );
+    REQUIRE( M.n_cols    == A.n_cols    );
+    REQUIRE( M.n_nonzero == A.n_nonzero );
+    
+    REQUIRE( accu(abs(mat(M) - mat(A))) == 0.0 );
+    
+    // copies own their memory
+    sp_mat C = M;
+    
+    C(0,0) = 123.0;
+    
+    REQUIRE( C(0,0) == 123.0 );
+    
+    F.close();
+    
+    REQUIRE( F.is_open() == false );
+    REQUIRE( F.get_ref().n_elem == 0 );
+    
+    REQUIRE( accu(abs(mat(C.cols(1, C.n_cols-1)) - mat(A.cols(1, A.n_cols-1)))) == 0.0 );
+    }
+  
+  // the element type must match
+  sp_mmap<float> G;
+  
+  REQUIRE( G.open(name, false) == false );
+  REQUIRE( G.is_open() == false );
+  
+  // a corrupt header must be rejected before any memory is allocated
+  
+  std::string data = ss.str();
+  
+  std::string data_big = data;
+  
+  const uword dims_big[3] = { uword(1) << (sizeof(uword)*8 - 4), uword(1) << (sizeof(uword)*8 - 4), uword(1) << (sizeof(uword)*8 - 4) };
+  
+  std::memcpy(&data_big[56], dims_big, sizeof(dims_big));
+  
+  std::stringstream ss_big(data_big);
+  
+  sp_mat D;
+  
+  REQUIRE( D.load(ss_big, csc_binary, false) == false );
+  
+  // explicitly stored zeros are rejected, both when loading and when mapping
+  
+  std::string data_zero = data;
+  
+  std::memset(&data_zero[data_zero.size() - sizeof(double)], 0, sizeof(double));
+  
+  std::stringstream ss_zero(data_zero);
+  
+  REQUIRE( D.load(ss_zero, csc_binary, false) == false );
+  
+    {
+    std::ofstream f(name.c_str(), std::fstream::binary);
+    
+    f.write(data_zero.c_str(), std::streamsize(data_zero.size()));
+    }
+  
+  sp_mmap<double> H;
+  
+  REQUIRE( H.open(name, false) == false );
+  
+    {
+    std::ofstream f(name.c_str(), std::fstream::binary);
+    
+    f.write(data_big.c_str(), std::streamsize(data_big.size()));
+    }
+  
+  REQUIRE( H.open(name, false) == false );
+  
+  std::remove(name.c_str());
+  
+  REQUIRE( G.open(name, false) == false );
+  }
@@ -968,6 +968,74 @@ TEST_CASE("sp_subview_iterators_test")
   REQUIRE( sit.row() == 0 );
   REQUIRE( sit.col() == 0 );
   REQUIRE( (double) (*sit) == Approx(2.0) );
+
+  // decrementing from end() must stay within the parent matrix;
+  // external memory has no element after the last one
+
+  uword  d_row_indices[] = { 0, 2, 4, 1, 3, 0, 2, 4 };
+  uword  d_col_ptrs[]    = { 0, 3, 5, 8 };
+  double d_values[]      = { 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0 };
+
+  // [[1.0 0.0 6.0]
+  //  [0.0 4.0 0.0]
+  //  [2.0 0.0 7.0]
+  //  [0.0 5.0 0.0]
+  //  [3.0 0.0 8.0]]
+  const SpMat<double> d(d_row_indices, d_col_ptrs, d_values, 5, 3, false);
+
+  const SpSubview<double> ds = d.submat(1, 1, 3, 2);
+
+  SpSubview<double>::const_iterator dit = ds.end();
+
+  --dit;
+
+  REQUIRE( dit.pos() == 2 );
+  REQUIRE( dit.row() == 1 );
+  REQUIRE( dit.col() == 1 );
+  REQUIRE( (double) (*dit) == Approx(7.0) );
+
+  --dit;
+
+  REQUIRE( dit.pos() == 1 );
+  REQUIRE( dit.row() == 2 );
+  REQUIRE( dit.col() == 0 );
+  REQUIRE( (double) (*dit) == Approx(5.0) );
+
+  --dit;
+
+  REQUIRE( dit.pos() == 0 );
+  REQUIRE( dit.row() == 0 );
+  REQUIRE( dit.col() == 0 );
+  REQUIRE( (double) (*dit) == Approx(4.0) );
+  REQUIRE( dit == ds.begin() );
+
+  // subview below the first row, ending at the last element of the parent
+
+  const SpSubview<double> dt = d.submat(3, 0, 4, 2);
+
+  SpSubview<double>::const_iterator tit = dt.end();
+
+  --tit;
+
+  REQUIRE( tit.pos() == 2 );
+  REQUIRE( tit.row() == 1 );
+  REQUIRE( tit.col() == 2 );
+  REQUIRE( (double) (*tit) == Approx(8.0) );
+
+  --tit;
+
+  REQUIRE( tit.pos() == 1 );
+  REQUIRE( tit.row() == 0 );
+  REQUIRE( tit.col() == 1 );
+  REQUIRE( (double) (*tit) == Approx(5.0) );
+
+  --tit;
+
+  REQUIRE( tit.pos() == 0 );
+  REQUIRE( tit.row() == 1 );
+  REQUIRE( tit.col() == 0 );
+  REQUIRE( (double) (*tit) == Approx(3.0) );
+  REQUIRE( tit == dt.begin() );
   }
 
 